@@ -254,6 +254,7 @@ rst_epilog = """
 .. |BP-F|      replace:: :abbr:`BP-F     (Belief Propagation with Flooding scheduling)`
 .. |BP-HL|     replace:: :abbr:`BP-HL    (Belief Propagation with Horizontal Layered scheduling)`
 .. |BP-P|      replace:: :abbr:`BP-P     (Belief Propagation Peeling)`
+.. |BP-R|      replace:: :abbr:`BP-R     (Belief Propagation with Residual scheduling)`
 .. |BP-VL|     replace:: :abbr:`BP-VL    (Belief Propagation with Vertical Layered scheduling)`
 .. |BPS|       replace:: :abbr:`BPS      (Bit Per Symbol)`
 .. |BSC|       replace:: :abbr:`BSC      (Binary Symmetric Channel)`
@@ -281,6 +282,7 @@ rst_epilog = """
 .. |EP|        replace:: :abbr:`EP       (Event Probability)`
 .. |EXIT|      replace:: :abbr:`EXIT     (EXtrinsic Information Transfer chart)`
 .. |FER|       replace:: :abbr:`FER      (Frame Error Rate)`
+.. |FHT|       replace:: :abbr:`FHT      (Fast Hadamard Transform)`
 .. |FNC|       replace:: :abbr:`FNC      (Flip aNd Check)`
 .. |GA|        replace:: :abbr:`GA       (Gaussian Approximation)`
 .. |GALA|      replace:: :abbr:`GALA     (Gallager A)`
@@ -322,6 +324,7 @@ rst_epilog = """
 .. |MWBF|      replace:: :abbr:`MWBF     (Modified Weighted Bit Flipping)`
 .. |NEON|      replace:: :abbr:`NEON     (ARM SIMD instructions)`
 .. |NMS|       replace:: :abbr:`NMS      (Normalized Min-Sum)`
+.. |NUMA|      replace:: :abbr:`NUMA     (Non-Uniform Memory Access)`
 .. |OMS|       replace:: :abbr:`OMS      (Offset Min-Sum)`
 .. |ONMS|      replace:: :abbr:`ONMS     (Offset Normalized Min-Sum)`
 .. |OOK|       replace:: :abbr:`OOK      (On-Off Keying)`
@@ -340,6 +343,8 @@ rst_epilog = """
 .. |RA|        replace:: :abbr:`RA       (Repeat and Accumulate)`
 .. |release|   replace:: """ + release + """
 .. |RISC|      replace:: :abbr:`RISC     (Reduced Instruction Set Computer)`
+.. |RLD|       replace:: :abbr:`RLD      (Recursive List Decoding)`
+.. |RM|        replace:: :abbr:`RM       (Reed-Muller)`
 .. |ROP|       replace:: :abbr:`ROP      (Received Optical Power)`
 .. |RSC|       replace:: :abbr:`RSC      (Recursive Systematic Convolutional)`
 .. |RS|        replace:: :abbr:`RS       (Reed-Solomon)`
@@ -353,6 +358,7 @@ rst_epilog = """
 .. |SF|        replace:: :abbr:`SF       (Scaling Factor)`
 .. |SFs|       replace:: :abbr:`SFs      (Scaling Factors)`
 .. |SIMD|      replace:: :abbr:`SIMD     (Single Instruction Multiple Data)`
+.. |SMT|       replace:: :abbr:`SMT      (Simultaneous Multi-Threading)`
 .. |SNRs|      replace:: :abbr:`SNRs     (Signal Noise Ratios)`
 .. |SNR|       replace:: :abbr:`SNR      (Signal Noise Ratio)`
 .. |SPC|       replace:: :abbr:`SPC      (Single Parity Check)`
@@ -0,0 +1,54 @@
+#!/bin/bash
+
+if [ -z "$1" ]
+then
+	echo "Usage $0 aff3ct_binary [n_repetitions] [precisions]"
+	echo "  e.g. $0 build/bin/aff3ct 1000 \"8 16 32 64\" (the precisions require a multi-precision build)"
+	exit 1
+fi
+
+aff3ct_bin=$1
+
+n_reps=1000
+if [ ! -z "$2" ]
+then
+	n_reps="$2"
+fi
+
+precs=""
+if [ ! -z "$3" ]
+then
+	precs="$3"
+fi
+
+codes=(
+	"-C POLAR   -K 512  -N 1024 --dec-type SC  --dec-implem FAST"
+	"-C POLAR   -K 512  -N 1024 --dec-type SCL --dec-implem FAST --dec-lists 8 --crc-poly 32-GZIP"
+	"-C RSC     -K 1024         --dec-implem FAST"
+	"-C TURBO   -K 1024         --dec-implem FAST --dec-ite 6"
+	"-C BCH     -K 239  -N 255  --dec-corr-pow 2"
+	"-C RS      -K 239  -N 255  --dec-corr-pow 8"
+	"-C RA      -K 1024 -N 2048"
+	"-C REP     -K 1024 -N 4096"
+	"-C UNCODED -K 1024"
+)
+
+function run_bench
+{
+	local prec_arg=$1
+	for code in "${codes[@]}"
+	do
+		echo "# $aff3ct_bin $code $prec_arg -m 2.0 -M 2.0 --sim-bench $n_reps"
+		$aff3ct_bin $code $prec_arg -m 2.0 -M 2.0 --sim-bench $n_reps || exit 1
+	done
+}
+
+if [ -z "$precs" ]
+then
+	run_bench ""
+else
+	for prec in $precs
+	do
+		run_bench "-p $prec"
+	done
+fi
@@ -17,6 +17,7 @@
 #include "Launcher/Code/Polar/Polar.hpp"
 #include "Launcher/Code/RA/RA.hpp"
 #include "Launcher/Code/Repetition/Repetition.hpp"
+#include "Launcher/Code/RM/RM.hpp"
 #include "Launcher/Code/RS/RS.hpp"
 #include "Launcher/Code/RSC/RSC.hpp"
 #include "Launcher/Code/RSC_DB/RSC_DB.hpp"
@@ -32,6 +33,7 @@
 #include "Factory/Module/Codec/Polar/Codec_polar.hpp"
 #include "Factory/Module/Codec/RA/Codec_RA.hpp"
 #include "Factory/Module/Codec/Repetition/Codec_repetition.hpp"
+#include "Factory/Module/Codec/RM/Codec_RM.hpp"
 #include "Factory/Module/Codec/RSC/Codec_RSC.hpp"
 #include "Factory/Module/Codec/RSC_DB/Codec_RSC_DB.hpp"
 #include "Factory/Module/Codec/Turbo/Codec_turbo.hpp"
@@ -71,7 +73,7 @@ void factory::Launcher::parameters
 
 	tools::add_arg(args, p, class_name+"p+cde-type,C",
 		tools::Text(tools::Including_set("POLAR", "TURBO", "TURBO_DB", "TPC", "LDPC", "REP", "RA", "RSC", "RSC_DB",
-		                                 "BCH", "UNCODED", "RS")),
+		                                 "BCH", "UNCODED", "RS", "RM")),
 		tools::arg_rank::REQ);
 
 	tools::add_arg(args, p, class_name+"p+type",
@@ -325,6 +327,11 @@ launcher::Launcher* factory::Launcher::parameters
 		if (this->sim_type == "BFER") return new launcher::Repetition<launcher::BFER_std<B,R,Q>,B,R,Q>(argc, argv);
 	}
 
+	if (this->cde_type == "RM")
+	{
+		if (this->sim_type == "BFER") return new launcher::RM<launcher::BFER_std<B,R,Q>,B,R,Q>(argc, argv);
+	}
+
 	if (this->cde_type == "BCH")
 	{
 		if (this->sim_type == "BFER") return new launcher::BCH<launcher::BFER_std<B,R,Q>,B,R,Q>(argc, argv);
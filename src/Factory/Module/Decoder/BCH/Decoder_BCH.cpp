@@ -88,6 +88,16 @@ void Decoder_BCH::parameters
 	}
 }
 
+std::vector<std::string> Decoder_BCH::parameters
+::get_implems() const
+{
+	// the 'GENIUS' implementation is not a real decoder (it knows the transmitted codeword)
+	if (this->type == "ALGEBRAIC")
+		return {"STD", "FAST"};
+
+	return Decoder::parameters::get_implems();
+}
+
 template <typename B, typename Q>
 module::Decoder_SIHO<B,Q>* Decoder_BCH::parameters
 ::build(const tools::BCH_polynomial_generator<B> &GF, const std::unique_ptr<module::Encoder<B>>& encoder) const
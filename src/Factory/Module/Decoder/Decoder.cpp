@@ -95,6 +95,33 @@ void Decoder::parameters
 	if (full) headers[p].push_back(std::make_pair("Seed", std::to_string(this->seed)));
 }
 
+std::vector<std::string> Decoder::parameters
+::get_implems() const
+{
+	if (this->type == "ML"   ) return {"STD", "NAIVE"};
+	if (this->type == "CHASE") return {"STD"};
+
+	return {this->implem};
+}
+
+std::string Decoder::parameters
+::get_implem() const
+{
+	return this->implem;
+}
+
+void Decoder::parameters
+::set_implem(const std::string &implem)
+{
+	this->implem = implem;
+}
+
+int Decoder::parameters
+::get_n_threads() const
+{
+	return 1;
+}
+
 template <typename B, typename Q>
 module::Decoder_SIHO<B,Q>* Decoder::parameters
 ::build(const std::unique_ptr<module::Encoder<B>>& encoder) const
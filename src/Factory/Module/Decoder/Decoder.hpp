@@ -2,6 +2,7 @@
 #define FACTORY_DECODER_HPP_
 
 #include <string>
+#include <vector>
 #include <memory>
 #include <map>
 
@@ -49,6 +50,16 @@ struct Decoder : Factory
 		virtual void store          (const tools::Argument_map_value &vals);
 		virtual void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
 
+		// implementations of the current decoder which can be built (the current one if it is not known), they all run
+		// the same algorithm: they can be chosen for their speed only
+		virtual std::vector<std::string> get_implems() const;
+		// current implementation, as one of 'get_implems'
+		virtual std::string get_implem() const;
+		// selects one of the implementations given by 'get_implems'
+		virtual void set_implem(const std::string &implem);
+		// number of threads which decode a frame together (the thread of the decoder included)
+		virtual int get_n_threads() const;
+
 	protected:
 		parameters(const std::string &n, const std::string &p);
 
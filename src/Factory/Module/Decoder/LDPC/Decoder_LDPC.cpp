@@ -1,4 +1,6 @@
 #include <utility>
+#include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Documentation/documentation.h"
@@ -9,6 +11,9 @@
 #include "Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding.hpp"
 #include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered.hpp"
 #include "Module/Decoder/LDPC/BP/Vertical_layered/Decoder_LDPC_BP_vertical_layered.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding_threads.hpp"
+#include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered_threads.hpp"
+#include "Module/Decoder/LDPC/BP/Residual/Decoder_LDPC_BP_residual.hpp"
 #include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA.hpp"
 #include "Tools/Code/LDPC/Update_rule/LSPA/Update_rule_LSPA.hpp"
 #include "Tools/Code/LDPC/Update_rule/MS/Update_rule_MS.hpp"
@@ -84,7 +89,7 @@ void Decoder_LDPC::parameters
 	args.add_link({p+"-h-path"}, {p+"-info-bits", "K"}); // if there is no K, then H is considered regular,
 	                                                     // so K is the N - H's height
 
-	tools::add_options(args.at({p+"-type", "D"}), 0, "BP_FLOODING", "BP_HORIZONTAL_LAYERED", "BP_VERTICAL_LAYERED", "BP_PEELING", "BIT_FLIPPING");
+	tools::add_options(args.at({p+"-type", "D"}), 0, "BP_FLOODING", "BP_HORIZONTAL_LAYERED", "BP_VERTICAL_LAYERED", "BP_RESIDUAL", "BP_PEELING", "BIT_FLIPPING");
 #ifdef __cpp_aligned_new
 	tools::add_options(args.at({p+"-type", "D"}), 0, "BP_HORIZONTAL_LAYERED_LEGACY");
 #endif
@@ -111,6 +116,9 @@ void Decoder_LDPC::parameters
 	tools::add_arg(args, p, class_name+"p+simd",
 		tools::Text(tools::Including_set("INTER", "INTRA")));
 
+	tools::add_arg(args, p, class_name+"p+threads",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
+
 	tools::add_arg(args, p, class_name+"p+min",
 		tools::Text(tools::Including_set("MIN", "MINL", "MINS")));
 
@@ -132,12 +140,22 @@ void Decoder_LDPC::parameters
 	if(vals.exist({p+"-min"        })) this->min             = vals.at      ({p+"-min"        });
 	if(vals.exist({p+"-ite",    "i"})) this->n_ite           = vals.to_int  ({p+"-ite",    "i"});
 	if(vals.exist({p+"-synd-depth" })) this->syndrome_depth  = vals.to_int  ({p+"-synd-depth" });
+	if(vals.exist({p+"-threads"    })) this->n_threads       = vals.to_int  ({p+"-threads"    });
 	if(vals.exist({p+"-off"        })) this->offset          = vals.to_float({p+"-off"        });
 	if(vals.exist({p+"-mwbf-factor"})) this->mwbf_factor     = vals.to_float({p+"-mwbf-factor"});
 	if(vals.exist({p+"-norm"       })) this->norm_factor     = vals.to_float({p+"-norm"       });
 	if(vals.exist({p+"-ppbf-proba" })) this->ppbf_proba      = vals.to_list<float>({p+"-ppbf-proba"});
 	if(vals.exist({p+"-no-synd"    })) this->enable_syndrome = false;
 
+	// the intra-frame threads split the nodes of a frame, the SIMD decoders process the frames or the nodes by vectors
+	if (this->n_threads > 1 && !this->simd_strategy.empty())
+	{
+		std::stringstream message;
+		message << "The intra-frame threads can not be combined with a SIMD strategy ('n_threads' = "
+		        << this->n_threads << ", 'simd_strategy' = " << this->simd_strategy << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	if (!this->H_path.empty())
 	{
 		int M;
@@ -168,6 +186,9 @@ void Decoder_LDPC::parameters
 
 		headers[p].push_back(std::make_pair("Num. of iterations (i)", std::to_string(this->n_ite)));
 
+		if (this->n_threads > 1)
+			headers[p].push_back(std::make_pair("Num. of threads (intra-frame)", std::to_string(this->n_threads)));
+
 		if (this->implem == "NMS")
 			headers[p].push_back(std::make_pair("Normalize factor", std::to_string(this->norm_factor)));
 
@@ -199,12 +220,97 @@ void Decoder_LDPC::parameters
 	}
 }
 
+std::vector<std::string> Decoder_LDPC::parameters
+::get_implems() const
+{
+	// the update rule ('implem') is the decoding algorithm, the implementations differ by their schedule and their
+	// SIMD strategy ("TYPE" or "TYPE/SIMD")
+	const std::vector<std::string> update_rules = {"SPA", "LSPA", "MS", "OMS", "NMS", "AMS"};
+	if ((this->type != "BP_FLOODING" && this->type != "BP_HORIZONTAL_LAYERED" &&
+	     this->type != "BP_HORIZONTAL_LAYERED_LEGACY") ||
+	    std::find(update_rules.begin(), update_rules.end(), this->implem) == update_rules.end())
+		return {this->get_implem()};
+
+	std::vector<std::string> implems = {"BP_FLOODING", "BP_HORIZONTAL_LAYERED"};
+	if (this->n_threads > 1) // the intra-frame threads are not available with a SIMD strategy
+		return implems;
+
+#ifdef __cpp_aligned_new
+	implems.push_back("BP_FLOODING/INTER");
+	implems.push_back("BP_HORIZONTAL_LAYERED/INTER");
+	if (this->implem == "MS" || this->implem == "NMS" || this->implem == "OMS")
+		implems.push_back("BP_HORIZONTAL_LAYERED_LEGACY/INTER");
+#else
+	if (this->implem == "MS" || this->implem == "NMS" || this->implem == "OMS")
+		implems.push_back("BP_HORIZONTAL_LAYERED/INTER");
+#endif
+	if (this->implem == "SPA")
+		implems.push_back("BP_FLOODING/INTRA");
+
+	return implems;
+}
+
+std::string Decoder_LDPC::parameters
+::get_implem() const
+{
+	return this->simd_strategy.empty() ? this->type : this->type + "/" + this->simd_strategy;
+}
+
+void Decoder_LDPC::parameters
+::set_implem(const std::string &implem)
+{
+	const auto pos = implem.find('/');
+	this->type          = implem.substr(0, pos);
+	this->simd_strategy = pos == std::string::npos ? "" : implem.substr(pos +1);
+}
+
+int Decoder_LDPC::parameters
+::get_n_threads() const
+{
+	if ((this->type == "BP_FLOODING" || this->type == "BP_HORIZONTAL_LAYERED") && this->simd_strategy.empty())
+		return this->n_threads;
+
+	return 1;
+}
+
 template <typename B, typename Q>
 module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 ::build_siso(const tools::Sparse_matrix &H, const std::vector<unsigned> &info_bits_pos,
              const std::unique_ptr<module::Encoder<B>>& encoder) const
 {
-	if (this->type == "BP_FLOODING" && this->simd_strategy.empty())
+	if (this->type == "BP_FLOODING" && this->simd_strategy.empty() && this->n_threads > 1)
+	{
+		const auto max_CN_degree = (unsigned int)H.get_cols_max_degree();
+
+		if (this->implem == "MS"  )  return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_MS  <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS  <Q                           >(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "OMS" )  return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_OMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_OMS <Q                           >((Q)this->offset  ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "NMS" )  return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_NMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_NMS <Q                           >(this->norm_factor), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "SPA" )  return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_SPA <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA <Q                           >(max_CN_degree    ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "LSPA")  return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_LSPA<Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA<Q                           >(max_CN_degree    ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "AMS" )
+		{
+			if (this->min == "MIN" ) return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_AMS <Q,tools::min             <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min             <Q>>(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MINL") return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MINS") return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_AMS <Q,tools::min_star        <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star        <Q>>(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
+	}
+	else if (this->type == "BP_HORIZONTAL_LAYERED" && this->simd_strategy.empty() && this->n_threads > 1)
+	{
+		const auto max_CN_degree = (unsigned int)H.get_cols_max_degree();
+
+		if (this->implem == "MS"  )  return new module::Decoder_LDPC_BP_horizontal_layered_threads<B,Q,tools::Update_rule_MS  <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS  <Q                           >(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "OMS" )  return new module::Decoder_LDPC_BP_horizontal_layered_threads<B,Q,tools::Update_rule_OMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_OMS <Q                           >((Q)this->offset  ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "NMS" )  return new module::Decoder_LDPC_BP_horizontal_layered_threads<B,Q,tools::Update_rule_NMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_NMS <Q                           >(this->norm_factor), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "SPA" )  return new module::Decoder_LDPC_BP_horizontal_layered_threads<B,Q,tools::Update_rule_SPA <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA <Q                           >(max_CN_degree    ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "LSPA")  return new module::Decoder_LDPC_BP_horizontal_layered_threads<B,Q,tools::Update_rule_LSPA<Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA<Q                           >(max_CN_degree    ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "AMS" )
+		{
+			if (this->min == "MIN" ) return new module::Decoder_LDPC_BP_horizontal_layered_threads<B,Q,tools::Update_rule_AMS <Q,tools::min             <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min             <Q>>(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MINL") return new module::Decoder_LDPC_BP_horizontal_layered_threads<B,Q,tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MINS") return new module::Decoder_LDPC_BP_horizontal_layered_threads<B,Q,tools::Update_rule_AMS <Q,tools::min_star        <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star        <Q>>(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
+	}
+	else if (this->type == "BP_FLOODING" && this->simd_strategy.empty())
 	{
 		const auto max_CN_degree = (unsigned int)H.get_cols_max_degree();
 
@@ -252,6 +358,22 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 			if (this->min == "MINS") return new module::Decoder_LDPC_BP_vertical_layered<B,Q,tools::Update_rule_AMS <Q,tools::min_star        <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star        <Q>>(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		}
 	}
+	else if (this->type == "BP_RESIDUAL" && this->simd_strategy.empty())
+	{
+		const auto max_CN_degree = (unsigned int)H.get_cols_max_degree();
+
+		if (this->implem == "MS"  )  return new module::Decoder_LDPC_BP_residual<B,Q,tools::Update_rule_MS  <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS  <Q                           >(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "OMS" )  return new module::Decoder_LDPC_BP_residual<B,Q,tools::Update_rule_OMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_OMS <Q                           >((Q)this->offset  ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "NMS" )  return new module::Decoder_LDPC_BP_residual<B,Q,tools::Update_rule_NMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_NMS <Q                           >(this->norm_factor), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "SPA" )  return new module::Decoder_LDPC_BP_residual<B,Q,tools::Update_rule_SPA <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA <Q                           >(max_CN_degree    ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "LSPA")  return new module::Decoder_LDPC_BP_residual<B,Q,tools::Update_rule_LSPA<Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA<Q                           >(max_CN_degree    ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "AMS" )
+		{
+			if (this->min == "MIN" ) return new module::Decoder_LDPC_BP_residual<B,Q,tools::Update_rule_AMS <Q,tools::min             <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min             <Q>>(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MINL") return new module::Decoder_LDPC_BP_residual<B,Q,tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MINS") return new module::Decoder_LDPC_BP_residual<B,Q,tools::Update_rule_AMS <Q,tools::min_star        <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star        <Q>>(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
+	}
 	else if (this->type == "BIT_FLIPPING")
 	{
 		     if (this->implem == "WBF" ) return new module::Decoder_LDPC_bit_flipping_OMWBF<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, (Q)0.               , this->enable_syndrome, this->syndrome_depth, this->n_frames);
@@ -38,6 +38,7 @@ struct Decoder_LDPC : public Decoder
 		bool        enable_syndrome = true;
 		int         syndrome_depth  = 1;
 		int         n_ite           = 10;
+		int         n_threads       = 1;
 
 		std::vector<float> ppbf_proba;
 
@@ -50,6 +51,10 @@ struct Decoder_LDPC : public Decoder
 		void get_description(tools::Argument_map_info &args) const;
 		void store          (const tools::Argument_map_value &vals);
 		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+		std::vector<std::string> get_implems() const;
+		std::string              get_implem () const;
+		void                     set_implem (const std::string &implem);
+		int                      get_n_threads() const;
 
 		// builder
 		template <typename B = int, typename Q = float>
@@ -8,8 +8,16 @@
 #include "Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive_sys.hpp"
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp"
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_inter_sys.hpp"
+#include "Module/Decoder/Polar/BP/Flooding/Decoder_polar_BP_flooding_sys.hpp"
+#include "Module/Decoder/Polar/BP/Flooding/Decoder_polar_BP_flooding_inter_sys.hpp"
+#include "Module/Decoder/Polar/BP/Round_trip/Decoder_polar_BP_round_trip_sys.hpp"
+#include "Module/Decoder/Polar/BP/Round_trip/Decoder_polar_BP_round_trip_inter_sys.hpp"
 #include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_naive.hpp"
 #include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_naive_sys.hpp"
+#include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_fast_sys.hpp"
+#include "Module/Decoder/Polar/SCF/Decoder_polar_DSCF_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_sys.hpp"
@@ -73,7 +81,8 @@ void Decoder_polar::parameters
 	auto p = this->get_prefix();
 	const std::string class_name = "factory::Decoder_polar::parameters::";
 
-	tools::add_options(args.at({p+"-type", "D"}), 0, "SC", "SCL", "SCL_MEM", "ASCL", "ASCL_MEM", "SCAN", "SCF");
+	tools::add_options(args.at({p+"-type", "D"}), 0, "SC", "SCL", "SCL_MEM", "ASCL", "ASCL_MEM", "SCAN", "SCF", "DSCF",
+	                 "BP_FLOODING", "BP_ROUND_TRIP");
 
 	args.at({p+"-implem"})->change_type(tools::Text(tools::Example_set("FAST", "NAIVE")));
 
@@ -83,6 +92,12 @@ void Decoder_polar::parameters
 	tools::add_arg(args, p, class_name+"p+lists,L",
 		tools::Integer(tools::Positive(), tools::Non_zero()));
 
+	tools::add_arg(args, p, class_name+"p+flip-order",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
+
+	tools::add_arg(args, p, class_name+"p+flip-alpha",
+		tools::Real(tools::Positive(), tools::Non_zero()));
+
 	tools::add_arg(args, p, class_name+"p+simd",
 		tools::Text(tools::Including_set("INTRA", "INTER")));
 
@@ -105,12 +120,14 @@ void Decoder_polar::parameters
 
 	if(vals.exist({p+"-ite",         "i"})) this->n_ite         = vals.to_int({p+"-ite",    "i"});
 	if(vals.exist({p+"-lists",       "L"})) this->L             = vals.to_int({p+"-lists",  "L"});
+	if(vals.exist({p+"-flip-order"      })) this->flip_order    = vals.to_int({p+"-flip-order" });
+	if(vals.exist({p+"-flip-alpha"      })) this->flip_alpha    = vals.to_float({p+"-flip-alpha"});
 	if(vals.exist({p+"-simd"            })) this->simd_strategy = vals.at    ({p+"-simd"       });
 	if(vals.exist({p+"-polar-nodes"     })) this->polar_nodes   = vals.at    ({p+"-polar-nodes"});
 	if(vals.exist({p+"-partial-adaptive"})) this->full_adaptive = false;
 
-	// force 1 iteration max if not SCAN (and polar code)
-	if (this->type != "SCAN") this->n_ite = 1;
+	// force 1 iteration max if not SCAN or BP (and polar code)
+	if (this->type != "SCAN" && this->type != "BP_FLOODING" && this->type != "BP_ROUND_TRIP") this->n_ite = 1;
 }
 
 void Decoder_polar::parameters
@@ -125,12 +142,18 @@ void Decoder_polar::parameters
 		if (!this->simd_strategy.empty())
 			headers[p].push_back(std::make_pair("SIMD strategy", this->simd_strategy));
 
-		if (this->type == "SCAN")
+		if (this->type == "SCAN" || this->type == "BP_FLOODING" || this->type == "BP_ROUND_TRIP")
 			headers[p].push_back(std::make_pair("Num. of iterations (i)", std::to_string(this->n_ite)));
 
-		if (this->type == "SCF")
+		if (this->type == "SCF" || this->type == "DSCF")
 			headers[p].push_back(std::make_pair("Num. of flips", std::to_string(this->flips)));
 
+		if (this->type == "DSCF")
+		{
+			headers[p].push_back(std::make_pair("Flip order", std::to_string(this->flip_order)));
+			headers[p].push_back(std::make_pair("Flip alpha", std::to_string(this->flip_alpha)));
+		}
+
 		if (this->type == "SCL" || this->type == "SCL_MEM")
 			headers[p].push_back(std::make_pair("Num. of lists (L)", std::to_string(this->L)));
 
@@ -142,6 +165,9 @@ void Decoder_polar::parameters
 		}
 
 		if ((this->type == "SC"      ||
+		     this->type == "SCAN"    ||
+		     this->type == "SCF"     ||
+		     this->type == "DSCF"    ||
 		     this->type == "SCL"     ||
 		     this->type == "ASCL"    ||
 		     this->type == "SCL_MEM" ||
@@ -150,6 +176,17 @@ void Decoder_polar::parameters
 	}
 }
 
+std::vector<std::string> Decoder_polar::parameters
+::get_implems() const
+{
+	if (this->type == "SC" || this->type == "SCAN" || this->type == "SCF" || this->type == "SCL")
+		return {"NAIVE", "FAST"};
+	if (this->type == "DSCF" || this->type == "ASCL" || this->type == "SCL_MEM" || this->type == "ASCL_MEM")
+		return {"FAST"};
+
+	return Decoder::parameters::get_implems();
+}
+
 template <typename B, typename Q>
 module::Decoder_SISO_SIHO<B,Q>* Decoder_polar::parameters
 ::build_siso(const std::vector<bool> &frozen_bits, const std::unique_ptr<module::Encoder<B>>& encoder) const
@@ -157,6 +194,23 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_polar::parameters
 	if (this->type == "SCAN" && this->systematic)
 	{
 		if (this->implem == "NAIVE") return new module::Decoder_polar_SCAN_naive_sys<B, Q, tools::f_LLR<Q>, tools::v_LLR<Q>, tools::h_LLR<B,Q>>(this->K, this->N_cw, this->n_ite, frozen_bits, this->n_frames);
+		if (this->implem == "FAST")
+		{
+			int idx_r0, idx_r1;
+			auto polar_patterns = tools::Nodes_parser<>::parse_uptr(this->polar_nodes, idx_r0, idx_r1);
+			if (this->simd_strategy == "INTER") return new module::Decoder_polar_SCAN_fast_inter_sys<B, Q>(this->K, this->N_cw, this->n_ite, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, this->n_frames);
+			else                                return new module::Decoder_polar_SCAN_fast_sys      <B, Q>(this->K, this->N_cw, this->n_ite, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, this->n_frames);
+		}
+	}
+	else if (this->type == "BP_FLOODING" && this->systematic)
+	{
+		if (this->simd_strategy == "INTER") return new module::Decoder_polar_BP_flooding_inter_sys<B, Q>(this->K, this->N_cw, this->n_ite, frozen_bits, this->n_frames);
+		else                                return new module::Decoder_polar_BP_flooding_sys      <B, Q>(this->K, this->N_cw, this->n_ite, frozen_bits, this->n_frames);
+	}
+	else if (this->type == "BP_ROUND_TRIP" && this->systematic)
+	{
+		if (this->simd_strategy == "INTER") return new module::Decoder_polar_BP_round_trip_inter_sys<B, Q>(this->K, this->N_cw, this->n_ite, frozen_bits, this->n_frames);
+		else                                return new module::Decoder_polar_BP_round_trip_sys      <B, Q>(this->K, this->N_cw, this->n_ite, frozen_bits, this->n_frames);
 	}
 	else if (this->type == "SCAN" && !this->systematic)
 	{
@@ -211,6 +265,13 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 				auto polar_patterns = tools::Nodes_parser<>::parse_uptr(this->polar_nodes, idx_r0, idx_r1);
 				if (this->type == "SC"  ) return new module::Decoder_polar_SC_fast_sys<B, Q, API_polar>(this->K, this->N_cw, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, this->n_frames);
 			}
+			else
+			{
+				int idx_r0, idx_r1;
+				auto polar_patterns = tools::Nodes_parser<>::parse_uptr(this->polar_nodes, idx_r0, idx_r1);
+				if (this->type == "SCF" ) return new module::Decoder_polar_SCF_fast_sys <B, Q, API_polar>(this->K, this->N_cw, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, *crc, this->flips, this->n_frames);
+				if (this->type == "DSCF") return new module::Decoder_polar_DSCF_fast_sys<B, Q, API_polar>(this->K, this->N_cw, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, *crc, this->flips, this->flip_order, this->flip_alpha, this->n_frames);
+			}
 		}
 	}
 
@@ -253,6 +314,10 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 	}
 	catch (tools::cannot_allocate const&)
 	{
+		if ((this->type == "SCAN" && this->implem == "FAST") || this->type == "BP_FLOODING" ||
+		     this->type == "BP_ROUND_TRIP")
+			return this->template build_siso<B,Q>(frozen_bits, encoder);
+
 		if (this->type.find("SCL") != std::string::npos && this->implem == "FAST")
 		{
 			if (this->simd_strategy == "INTRA")
@@ -32,6 +32,8 @@ struct Decoder_polar : public Decoder
 		int         n_ite         = 1;
 		int         L             = 8;
 		int         T             = 8;
+		int         flip_order    = 2;
+		float       flip_alpha    = 1.f;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Decoder_polar_prefix);
@@ -42,6 +44,7 @@ struct Decoder_polar : public Decoder
 		virtual void get_description(tools::Argument_map_info &args) const;
 		virtual void store          (const tools::Argument_map_value &vals);
 		virtual void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+		virtual std::vector<std::string> get_implems() const;
 
 		// builder
 		template <typename B = int, typename Q = float>
@@ -0,0 +1,109 @@
+#include <utility>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Documentation/documentation.h"
+#include "Module/Decoder/RM/Decoder_RM_FHT.hpp"
+#include "Module/Decoder/RM/Decoder_RM_RLD.hpp"
+#include "Factory/Module/Decoder/RM/Decoder_RM.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::factory;
+
+const std::string aff3ct::factory::Decoder_RM_name   = "Decoder RM";
+const std::string aff3ct::factory::Decoder_RM_prefix = "dec";
+
+Decoder_RM::parameters
+::parameters(const std::string &prefix)
+: Decoder::parameters(Decoder_RM_name, prefix)
+{
+	this->type   = "RLD";
+	this->implem = "STD";
+}
+
+Decoder_RM::parameters* Decoder_RM::parameters
+::clone() const
+{
+	return new Decoder_RM::parameters(*this);
+}
+
+void Decoder_RM::parameters
+::get_description(tools::Argument_map_info &args) const
+{
+	Decoder::parameters::get_description(args);
+
+	auto p = this->get_prefix();
+	const std::string class_name = "factory::Decoder_RM::parameters::";
+
+	tools::add_options(args.at({p+"-type", "D"}), 0, "FHT", "RLD");
+	tools::add_options(args.at({p+"-implem"   }), 0, "STD");
+
+	tools::add_arg(args, p, class_name+"p+lists,L",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
+}
+
+void Decoder_RM::parameters
+::store(const tools::Argument_map_value &vals)
+{
+	Decoder::parameters::store(vals);
+
+	auto p = this->get_prefix();
+
+	if(vals.exist({p+"-lists", "L"})) this->L = vals.to_int({p+"-lists", "L"});
+}
+
+void Decoder_RM::parameters
+::get_headers(std::map<std::string,header_list>& headers, const bool full) const
+{
+	Decoder::parameters::get_headers(headers, full);
+
+	if (this->type == "RLD")
+	{
+		auto p = this->get_prefix();
+
+		headers[p].push_back(std::make_pair("Num. of lists (L)", std::to_string(this->L)));
+	}
+}
+
+template <typename B, typename Q>
+module::Decoder_SIHO<B,Q>* Decoder_RM::parameters
+::build(const std::unique_ptr<module::Encoder<B>>& encoder) const
+{
+	try
+	{
+		return Decoder::parameters::build<B,Q>(encoder);
+	}
+	catch (tools::cannot_allocate const&)
+	{
+		if (this->implem == "STD")
+		{
+			if (this->type == "FHT") return new module::Decoder_RM_FHT<B,Q>(this->K, this->N_cw,          this->n_frames);
+			if (this->type == "RLD") return new module::Decoder_RM_RLD<B,Q>(this->K, this->N_cw, this->L, this->n_frames);
+		}
+	}
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
+template <typename B, typename Q>
+module::Decoder_SIHO<B,Q>* Decoder_RM
+::build(const parameters &params, const std::unique_ptr<module::Encoder<B>>& encoder)
+{
+	return params.template build<B,Q>(encoder);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template aff3ct::module::Decoder_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_RM::parameters::build<B_8 ,Q_8 >(const std::unique_ptr<module::Encoder<B_8 >>&) const;
+template aff3ct::module::Decoder_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_RM::parameters::build<B_16,Q_16>(const std::unique_ptr<module::Encoder<B_16>>&) const;
+template aff3ct::module::Decoder_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_RM::parameters::build<B_32,Q_32>(const std::unique_ptr<module::Encoder<B_32>>&) const;
+template aff3ct::module::Decoder_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_RM::parameters::build<B_64,Q_64>(const std::unique_ptr<module::Encoder<B_64>>&) const;
+template aff3ct::module::Decoder_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_RM::build<B_8 ,Q_8 >(const aff3ct::factory::Decoder_RM::parameters&, const std::unique_ptr<module::Encoder<B_8 >>&);
+template aff3ct::module::Decoder_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_RM::build<B_16,Q_16>(const aff3ct::factory::Decoder_RM::parameters&, const std::unique_ptr<module::Encoder<B_16>>&);
+template aff3ct::module::Decoder_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_RM::build<B_32,Q_32>(const aff3ct::factory::Decoder_RM::parameters&, const std::unique_ptr<module::Encoder<B_32>>&);
+template aff3ct::module::Decoder_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_RM::build<B_64,Q_64>(const aff3ct::factory::Decoder_RM::parameters&, const std::unique_ptr<module::Encoder<B_64>>&);
+#else
+template aff3ct::module::Decoder_SIHO<B,Q>* aff3ct::factory::Decoder_RM::parameters::build<B,Q>(const std::unique_ptr<module::Encoder<B>>& ) const;
+template aff3ct::module::Decoder_SIHO<B,Q>* aff3ct::factory::Decoder_RM::build<B,Q>(const aff3ct::factory::Decoder_RM::parameters&, const std::unique_ptr<module::Encoder<B>>& );
+#endif
+// ==================================================================================== explicit template instantiation
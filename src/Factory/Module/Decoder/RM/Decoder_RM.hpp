@@ -0,0 +1,49 @@
+#ifndef FACTORY_DECODER_RM_HPP
+#define FACTORY_DECODER_RM_HPP
+
+#include <string>
+#include <memory>
+#include <map>
+
+#include "Tools/Arguments/Argument_tools.hpp"
+#include "Module/Encoder/Encoder.hpp"
+#include "Module/Decoder/Decoder_SIHO.hpp"
+#include "Factory/Module/Decoder/Decoder.hpp"
+
+namespace aff3ct
+{
+namespace factory
+{
+extern const std::string Decoder_RM_name;
+extern const std::string Decoder_RM_prefix;
+struct Decoder_RM : public Decoder
+{
+	class parameters : public Decoder::parameters
+	{
+	public:
+		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		int L = 1;
+
+		// ---------------------------------------------------------------------------------------------------- METHODS
+		explicit parameters(const std::string &p = Decoder_RM_prefix);
+		virtual ~parameters() = default;
+		Decoder_RM::parameters* clone() const;
+
+		// parameters construction
+		void get_description(tools::Argument_map_info &args) const;
+		void store          (const tools::Argument_map_value &vals);
+		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+
+		// builder
+		template <typename B = int, typename Q = float>
+		module::Decoder_SIHO<B,Q>* build(const std::unique_ptr<module::Encoder<B>>& encoder = nullptr) const;
+	};
+
+	template <typename B = int, typename Q = float>
+	static module::Decoder_SIHO<B,Q>* build(const parameters &params, const std::unique_ptr<module::Encoder<B>>& encoder = nullptr);
+};
+}
+}
+
+#endif /* FACTORY_DECODER_RM_HPP */
@@ -87,6 +87,16 @@ void Decoder_RS::parameters
 	}
 }
 
+std::vector<std::string> Decoder_RS::parameters
+::get_implems() const
+{
+	// the 'GENIUS' implementation is not a real decoder (it knows the transmitted codeword)
+	if (this->type == "ALGEBRAIC")
+		return {"STD"};
+
+	return Decoder::parameters::get_implems();
+}
+
 template <typename B, typename Q>
 module::Decoder_SIHO<B,Q>* Decoder_RS::parameters
 ::build(const tools::RS_polynomial_generator &GF, const std::unique_ptr<module::Encoder<B>>& encoder) const
@@ -143,6 +143,16 @@ void Decoder_RSC::parameters
 	}
 }
 
+std::vector<std::string> Decoder_RSC::parameters
+::get_implems() const
+{
+	// the 'GENERIC_JSON' implementation also writes the trellis in a file
+	if (this->type == "BCJR")
+		return {"STD", "GENERIC", "FAST", "VERY_FAST"};
+
+	return Decoder::parameters::get_implems();
+}
+
 template <typename B, typename Q, typename QD, tools::proto_max<Q> MAX1, tools::proto_max<QD> MAX2>
 module::Decoder_SISO_SIHO<B,Q>* Decoder_RSC::parameters
 ::_build_siso_seq(const std::vector<std::vector<int>> &trellis,
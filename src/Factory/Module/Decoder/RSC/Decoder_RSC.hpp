@@ -42,6 +42,7 @@ struct Decoder_RSC : public Decoder
 		void get_description(tools::Argument_map_info &args) const;
 		void store          (const tools::Argument_map_value &vals);
 		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+		std::vector<std::string> get_implems() const;
 
 		// builder
 		template <typename B = int, typename Q = float>
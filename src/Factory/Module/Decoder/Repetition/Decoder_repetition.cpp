@@ -64,6 +64,15 @@ void Decoder_repetition::parameters
 	}
 }
 
+std::vector<std::string> Decoder_repetition::parameters
+::get_implems() const
+{
+	if (this->type == "REPETITION")
+		return {"STD", "FAST"};
+
+	return Decoder::parameters::get_implems();
+}
+
 template <typename B, typename Q>
 module::Decoder_SIHO<B,Q>* Decoder_repetition::parameters
 ::build(const std::unique_ptr<module::Encoder<B>>& encoder) const
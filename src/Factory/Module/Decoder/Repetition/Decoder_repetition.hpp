@@ -2,6 +2,7 @@
 #define FACTORY_DECODER_REPETITION_HPP
 
 #include <string>
+#include <vector>
 #include <memory>
 #include <map>
 
@@ -34,6 +35,7 @@ struct Decoder_repetition : public Decoder
 		void get_description(tools::Argument_map_info &args) const;
 		void store          (const tools::Argument_map_value &vals);
 		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+		std::vector<std::string> get_implems() const;
 
 		// builder
 		template <typename B = int, typename Q = float>
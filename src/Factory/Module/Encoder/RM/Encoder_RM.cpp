@@ -0,0 +1,87 @@
+#include <utility>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/RM/rm_functions.h"
+#include "Factory/Module/Encoder/RM/Encoder_RM.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::factory;
+
+const std::string aff3ct::factory::Encoder_RM_name   = "Encoder RM";
+const std::string aff3ct::factory::Encoder_RM_prefix = "enc";
+
+Encoder_RM::parameters
+::parameters(const std::string &prefix)
+: Encoder::parameters(Encoder_RM_name, prefix)
+{
+	this->type = "RM";
+}
+
+Encoder_RM::parameters* Encoder_RM::parameters
+::clone() const
+{
+	return new Encoder_RM::parameters(*this);
+}
+
+void Encoder_RM::parameters
+::get_description(tools::Argument_map_info &args) const
+{
+	Encoder::parameters::get_description(args);
+
+	auto p = this->get_prefix();
+
+	tools::add_options(args.at({p+"-type"}), 0, "RM");
+}
+
+void Encoder_RM::parameters
+::store(const tools::Argument_map_value &vals)
+{
+	Encoder::parameters::store(vals);
+
+	if (this->type == "RM")
+		this->order = tools::rm_order(this->K, this->N_cw);
+}
+
+void Encoder_RM::parameters
+::get_headers(std::map<std::string,header_list>& headers, const bool full) const
+{
+	Encoder::parameters::get_headers(headers, full);
+
+	auto p = this->get_prefix();
+
+	if (this->type == "RM")
+		headers[p].push_back(std::make_pair("Order (r)", std::to_string(this->order)));
+}
+
+template <typename B>
+module::Encoder_RM<B>* Encoder_RM::parameters
+::build() const
+{
+	if (this->type == "RM") return new module::Encoder_RM<B>(this->K, this->N_cw, this->n_frames);
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
+template <typename B>
+module::Encoder_RM<B>* Encoder_RM
+::build(const parameters &params)
+{
+	return params.template build<B>();
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template aff3ct::module::Encoder_RM<B_8 >* aff3ct::factory::Encoder_RM::parameters::build<B_8 >() const;
+template aff3ct::module::Encoder_RM<B_16>* aff3ct::factory::Encoder_RM::parameters::build<B_16>() const;
+template aff3ct::module::Encoder_RM<B_32>* aff3ct::factory::Encoder_RM::parameters::build<B_32>() const;
+template aff3ct::module::Encoder_RM<B_64>* aff3ct::factory::Encoder_RM::parameters::build<B_64>() const;
+template aff3ct::module::Encoder_RM<B_8 >* aff3ct::factory::Encoder_RM::build<B_8 >(const aff3ct::factory::Encoder_RM::parameters&);
+template aff3ct::module::Encoder_RM<B_16>* aff3ct::factory::Encoder_RM::build<B_16>(const aff3ct::factory::Encoder_RM::parameters&);
+template aff3ct::module::Encoder_RM<B_32>* aff3ct::factory::Encoder_RM::build<B_32>(const aff3ct::factory::Encoder_RM::parameters&);
+template aff3ct::module::Encoder_RM<B_64>* aff3ct::factory::Encoder_RM::build<B_64>(const aff3ct::factory::Encoder_RM::parameters&);
+#else
+template aff3ct::module::Encoder_RM<B>* aff3ct::factory::Encoder_RM::parameters::build<B>() const;
+template aff3ct::module::Encoder_RM<B>* aff3ct::factory::Encoder_RM::build<B>(const aff3ct::factory::Encoder_RM::parameters&);
+#endif
+// ==================================================================================== explicit template instantiation
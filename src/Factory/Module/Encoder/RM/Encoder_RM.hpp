@@ -0,0 +1,47 @@
+#ifndef FACTORY_ENCODER_RM_HPP
+#define FACTORY_ENCODER_RM_HPP
+
+#include <string>
+#include <map>
+
+#include "Tools/Arguments/Argument_tools.hpp"
+#include "Module/Encoder/RM/Encoder_RM.hpp"
+#include "Factory/Module/Encoder/Encoder.hpp"
+
+namespace aff3ct
+{
+namespace factory
+{
+extern const std::string Encoder_RM_name;
+extern const std::string Encoder_RM_prefix;
+struct Encoder_RM : public Encoder
+{
+	class parameters : public Encoder::parameters
+	{
+	public:
+		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// deduced parameters
+		int order = 0; // the 'r' of RM(r,m), deduced from K and N
+
+		// ---------------------------------------------------------------------------------------------------- METHODS
+		explicit parameters(const std::string &p = Encoder_RM_prefix);
+		virtual ~parameters() = default;
+		Encoder_RM::parameters* clone() const;
+
+		// parameters construction
+		void get_description(tools::Argument_map_info &args) const;
+		void store          (const tools::Argument_map_value &vals);
+		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+
+		// builder
+		template <typename B = int>
+		module::Encoder_RM<B>* build() const;
+	};
+
+	template <typename B = int>
+	static module::Encoder_RM<B>* build(const parameters &params);
+};
+}
+}
+
+#endif /* FACTORY_ENCODER_RM_HPP */
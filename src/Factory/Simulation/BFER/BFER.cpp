@@ -111,9 +111,57 @@ void BFER::parameters
 		tools::Integer(tools::Positive(), tools::Non_zero()),
 		tools::arg_rank::ADV);
 
+	tools::add_arg(args, p, class_name+"p+err-trk-max",
+		tools::Integer(tools::Positive()),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+err-trk-sampl",
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+err-trk-queue",
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
+
 	tools::add_arg(args, p, class_name+"p+coded",
 		tools::None());
 
+	tools::add_arg(args, p, class_name+"p+chkpt-path",
+		tools::File(tools::openmode::read_write),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+chkpt-freq",
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+resume",
+		tools::None(),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+bench",
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+bench-warmup",
+		tools::Integer(tools::Positive()),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+pin",
+		tools::Text(tools::Including_set("NO", "COMPACT", "SCATTER")),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+pin-no-smt",
+		tools::None(),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+autotune",
+		tools::None(),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+autotune-path",
+		tools::File(tools::openmode::read_write),
+		tools::arg_rank::ADV);
+
 	auto pter = ter->get_prefix();
 
 	tools::add_arg(args, pter, class_name+"p+sigma",
@@ -127,6 +175,14 @@ void BFER::parameters
 #ifdef AFF3CT_MPI
 	tools::add_arg(args, pmnt, class_name+"p+mpi-comm-freq",
 		tools::Integer(tools::Positive(), tools::Non_zero()));
+
+	tools::add_arg(args, p, class_name+"p+mpi-dyn",
+		tools::None(),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+mpi-unit",
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
 #else
 	tools::add_arg(args, pmnt, class_name+"p+red-lazy",
 		tools::None());
@@ -151,10 +207,34 @@ void BFER::parameters
 
 	if(vals.exist({p+"-err-trk-path" })) this->err_track_path      = vals.at    ({p+"-err-trk-path" });
 	if(vals.exist({p+"-err-trk-thold"})) this->err_track_threshold = vals.to_int({p+"-err-trk-thold"});
+	if(vals.exist({p+"-err-trk-sampl"})) this->err_track_sampling  = vals.to_int({p+"-err-trk-sampl"});
+	if(vals.exist({p+"-err-trk-queue"})) this->err_track_queue     = vals.to_int({p+"-err-trk-queue"});
+	if(vals.exist({p+"-err-trk-max"  })) this->err_track_max       = vals.to_int({p+"-err-trk-max"  });
+	else if (this->err_track_queue)      this->err_track_max       = 1000; // default limit of the async. capture
 	if(vals.exist({p+"-err-trk-rev"  })) this->err_track_revert    = true;
 	if(vals.exist({p+"-err-trk"      })) this->err_track_enable    = true;
 	if(vals.exist({p+"-coset",    "c"})) this->coset               = true;
 	if(vals.exist({p+"-coded",       })) this->coded_monitoring    = true;
+	if(vals.exist({p+"-chkpt-path"   })) this->chkpt_path          = vals.at    ({p+"-chkpt-path"   });
+	if(vals.exist({p+"-chkpt-freq"   })) this->chkpt_freq = seconds(vals.to_int({p+"-chkpt-freq"   }));
+	if(vals.exist({p+"-resume"       })) this->resume              = true;
+
+	if (vals.exist({p+"-chkpt-path"}) || vals.exist({p+"-chkpt-freq"}) || this->resume)
+		this->chkpt_enable = true;
+
+	if(vals.exist({p+"-bench"        })) this->bench               = vals.to_int({p+"-bench"        });
+	if(vals.exist({p+"-bench-warmup" })) this->bench_warmup        = vals.to_int({p+"-bench-warmup" });
+
+	if(vals.exist({p+"-pin"          })) this->pin_policy          = vals.at    ({p+"-pin"          });
+	if(vals.exist({p+"-pin-no-smt"   })) this->pin_no_smt          = true;
+	if(vals.exist({p+"-autotune"     })) this->autotune            = true;
+	if(vals.exist({p+"-autotune-path"})) this->autotune_path       = vals.at    ({p+"-autotune-path"});
+
+	if (vals.exist({p+"-autotune-path"}))
+		this->autotune = true;
+
+	if (this->bench)
+		this->n_threads = 1;
 
 	if (this->err_track_revert)
 	{
@@ -172,6 +252,12 @@ void BFER::parameters
 
 #ifdef AFF3CT_MPI
 	if(vals.exist({pmnt+"-mpi-comm-freq"})) this->mnt_mpi_comm_freq = milliseconds(vals.to_int({pmnt+"-mpi-comm-freq"}));
+	if(vals.exist({p   +"-mpi-dyn"      })) this->mpi_dynamic       = true;
+	if(vals.exist({p   +"-mpi-unit"     }))
+	{
+		this->mpi_dynamic = true;
+		this->mpi_unit    = vals.to_int({p+"-mpi-unit"});
+	}
 #else
 	if(vals.exist({pmnt+"-red-lazy"})) this->mnt_red_lazy = true;
 	if(vals.exist({pmnt+"-red-lazy-freq"}))
@@ -198,6 +284,8 @@ void BFER::parameters
 	std::string pmnt = mnt_er->get_prefix();
 #ifdef AFF3CT_MPI
 	headers[pmnt].push_back(std::make_pair("MPI comm. freq. (ms)", std::to_string(this->mnt_mpi_comm_freq.count())));
+	headers[p].push_back(std::make_pair("MPI scheduling", this->mpi_dynamic ? "dynamic (unit: " +
+	                                    std::to_string(this->mpi_unit) + " frames)" : "static"));
 #else
 	headers[pmnt].push_back(std::make_pair("Lazy reduction", this->mnt_red_lazy ? "on" : "off"));
 	if (this->mnt_red_lazy)
@@ -217,12 +305,44 @@ void BFER::parameters
 	if (this->err_track_threshold)
 		headers[p].push_back(std::make_pair("Bad frames threshold", std::to_string(this->err_track_threshold)));
 
+	if (this->err_track_enable)
+	{
+		if (this->err_track_max)
+			headers[p].push_back(std::make_pair("Bad frames max. per noise", std::to_string(this->err_track_max)));
+		if (this->err_track_sampling > 1)
+			headers[p].push_back(std::make_pair("Bad frames sampling", "1/" + std::to_string(this->err_track_sampling)));
+		headers[p].push_back(std::make_pair("Bad frames capture", this->err_track_queue ?
+		                                    "async (queue: " + std::to_string(this->err_track_queue) + ")" : "sync"));
+	}
+
 	if (this->err_track_enable || this->err_track_revert)
 	{
 		std::string path = this->err_track_path + std::string("_$noise.[src,enc,chn]");
 		headers[p].push_back(std::make_pair("Bad frames base path", path));
 	}
 
+	if (this->bench)
+	{
+		headers[p].push_back(std::make_pair("Benchmark repetitions", std::to_string(this->bench)));
+		headers[p].push_back(std::make_pair("Benchmark warm-up", std::to_string(this->bench_warmup)));
+	}
+
+	headers[p].push_back(std::make_pair("Thread pinning", this->pin_policy + (this->pin_policy != "NO" &&
+	                                                                          this->pin_no_smt ? " (no SMT)" : "")));
+
+	if (this->autotune)
+		headers[p].push_back(std::make_pair("Autotuning cache", this->autotune_path));
+
+	headers[p].push_back(std::make_pair("Checkpointing", this->chkpt_enable ? "on" : "off"));
+
+	if (this->chkpt_enable)
+	{
+		headers[p].push_back(std::make_pair("Checkpoint path", this->chkpt_path));
+		if (this->chkpt_freq.count())
+			headers[p].push_back(std::make_pair("Checkpoint freq. (s)", std::to_string(this->chkpt_freq.count())));
+		headers[p].push_back(std::make_pair("Resume", this->resume ? "yes" : "no"));
+	}
+
 	if (this->src != nullptr && this->cdc != nullptr)
 	{
 		const auto bit_rate = (float)this->src->K / (float)this->cdc->N;
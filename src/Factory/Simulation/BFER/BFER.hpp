@@ -36,13 +36,29 @@ struct BFER : Simulation
 		int         err_track_threshold = 0;
 		bool        err_track_revert    = false;
 		bool        err_track_enable    = false;
+		int         err_track_max       = 0;
+		int         err_track_sampling  = 1;
+		int         err_track_queue     = 0;
 		bool        coset               = false;
 		bool        coded_monitoring    = false;
 		bool        ter_sigma           = false;
 		bool        mnt_mutinfo         = false;
+		std::string chkpt_path          = "checkpoint";
+		bool        chkpt_enable        = false;
+		bool        resume              = false;
+		unsigned    bench               = 0;
+		unsigned    bench_warmup        = 10;
+		std::string autotune_path       = "autotune.txt";
+		bool        autotune            = false;
+		std::string pin_policy          = "NO";
+		bool        pin_no_smt          = false;
+
+		std::chrono::seconds chkpt_freq = std::chrono::seconds(0);
 
 #ifdef AFF3CT_MPI
 		std::chrono::milliseconds mnt_mpi_comm_freq = std::chrono::milliseconds(1000);
+		bool                      mpi_dynamic       = false;
+		unsigned                  mpi_unit          = 1000;
 #else
 		std::chrono::milliseconds mnt_red_lazy_freq = std::chrono::milliseconds(0);
 		bool                      mnt_red_lazy      = false;
@@ -4,6 +4,7 @@
 #include "Tools/Documentation/documentation.h"
 #include "Simulation/BFER/Iterative/SystemC/SC_BFER_ite.hpp"
 #include "Simulation/BFER/Iterative/Threads/BFER_ite_threads.hpp"
+#include "Simulation/BFER/Iterative/Dataflow/BFER_ite_dataflow.hpp"
 #include "Factory/Simulation/BFER/BFER_ite.hpp"
 
 using namespace aff3ct;
@@ -103,6 +104,16 @@ void BFER_ite::parameters
 
 	tools::add_arg(args, p, class_name+"p+crc-start",
 		tools::Integer(tools::Positive()));
+
+#if !defined(AFF3CT_SYSTEMC_SIMU)
+	tools::add_arg(args, p, class_name+"p+dataflow",
+		tools::None(),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+dataflow-queue",
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
+#endif
 }
 
 void BFER_ite::parameters
@@ -114,6 +125,14 @@ void BFER_ite::parameters
 
 	if(vals.exist({p+"-ite",  "I"})) this->n_ite     = vals.to_int({p+"-ite",  "I"});
 	if(vals.exist({p+"-crc-start"})) this->crc_start = vals.to_int({p+"-crc-start"});
+#if !defined(AFF3CT_SYSTEMC_SIMU)
+	if(vals.exist({p+"-dataflow" })) this->dataflow  = true;
+	if(vals.exist({p+"-dataflow-queue"}))
+	{
+		this->dataflow       = true;
+		this->dataflow_queue = vals.to_int({p+"-dataflow-queue"});
+	}
+#endif
 
 	this->mnt_mutinfo = false;
 }
@@ -130,6 +149,12 @@ void BFER_ite::parameters
 	if (this->crc != nullptr && this->crc->type != "NO")
 		headers[p].push_back(std::make_pair("CRC start ite.", std::to_string(this->crc_start)));
 
+#if !defined(AFF3CT_SYSTEMC_SIMU)
+	headers[p].push_back(std::make_pair("Dataflow runtime", this->dataflow ? "on" : "off"));
+	if (this->dataflow_queue)
+		headers[p].push_back(std::make_pair("Dataflow queue size", std::to_string(this->dataflow_queue)));
+#endif
+
 	if (this->src    != nullptr) { this->src   ->get_headers(headers, full); }
 	if (this->crc    != nullptr) { this->crc   ->get_headers(headers, full); }
 	if (this->cdc    != nullptr) { this->cdc   ->get_headers(headers, full); }
@@ -156,7 +181,10 @@ simulation::BFER_ite<B,R,Q>* BFER_ite::parameters
 #if defined(AFF3CT_SYSTEMC_SIMU)
 	return new simulation::SC_BFER_ite<B,R,Q>(*this);
 #else
-	return new simulation::BFER_ite_threads<B,R,Q>(*this);
+	if (this->dataflow)
+		return new simulation::BFER_ite_dataflow<B,R,Q>(*this);
+	else
+		return new simulation::BFER_ite_threads<B,R,Q>(*this);
 #endif
 }
 
@@ -33,8 +33,10 @@ struct BFER_ite : BFER
 	public:
 		// ------------------------------------------------------------------------------------------------- PARAMETERS
 		// optional parameters
-		int n_ite     = 15;
-		int crc_start = 2;
+		int  n_ite          = 15;
+		int  crc_start      = 2;
+		bool dataflow       = false;
+		int  dataflow_queue = 0;
 
 		// module parameters
 		tools::auto_cloned_unique_ptr<Interleaver::parameters> itl;
@@ -1,11 +1,13 @@
 #include <utility>
 #include <sstream>
+#include <mipp.h>
 #ifdef AFF3CT_MPI
 #include <mpi.h>
 #endif
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Documentation/documentation.h"
+#include "Tools/Perf/cpu_features.h"
 #include "Factory/Simulation/Simulation.hpp"
 
 using namespace aff3ct;
@@ -79,6 +81,10 @@ void Simulation::parameters
 
 	tools::add_arg(args, p, class_name+"p+seed,S",
 		tools::Integer(tools::Positive()));
+
+	tools::add_arg(args, p, class_name+"p+cache-path",
+		tools::Folder(tools::openmode::read_write),
+		tools::arg_rank::ADV);
 }
 
 void Simulation::parameters
@@ -96,6 +102,7 @@ void Simulation::parameters
 	if(vals.exist({p+"-stop-time"     })) this->stop_time   = seconds(vals.to_int({p+"-stop-time"   }));
 	if(vals.exist({p+"-max-fra",   "n"})) this->max_frame   =         vals.to_int({p+"-max-fra", "n"});
 	if(vals.exist({p+"-seed",      "S"})) this->global_seed =         vals.to_int({p+"-seed",    "S"});
+	if(vals.exist({p+"-cache-path"    })) this->cache_path  =         vals.to_folder({p+"-cache-path"});
 	if(vals.exist({p+"-stats"         })) this->statistics  = true;
 	if(vals.exist({p+"-dbg"           })) this->debug       = true;
 	if(vals.exist({p+"-crit-nostop"   })) this->crit_nostop = true;
@@ -180,6 +187,13 @@ void Simulation::parameters
 
 	headers[p].push_back(std::make_pair("Multi-threading (t)", threads));
 
+	if (!this->cache_path.empty())
+		headers[p].push_back(std::make_pair("Construction cache", this->cache_path));
+
+	// SIMD instructions used by the binary and supported by the CPU
+	headers[p].push_back(std::make_pair("SIMD (binary)", std::string(mipp::InstructionFullType)));
+	headers[p].push_back(std::make_pair("SIMD (CPU)", tools::get_cpu_simd_isas()));
+
 #ifdef AFF3CT_MPI
 	headers[p].push_back(std::make_pair("MPI size", std::to_string(this->mpi_size)));
 #endif
@@ -28,6 +28,7 @@ struct Simulation : Launcher
 		// optional parameters
 		std::chrono::seconds stop_time       = std::chrono::seconds(0);
 		std::string          meta            = "";
+		std::string          cache_path      = "";
 		unsigned             max_frame       = 0;
 		bool                 debug           = false;
 		bool                 debug_hex       = false;
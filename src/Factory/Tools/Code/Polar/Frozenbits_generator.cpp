@@ -1,3 +1,4 @@
+#include <sstream>
 #include <utility>
 
 #include "Tools/Exception/exception.hpp"
@@ -7,6 +8,8 @@
 #include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_TV.hpp"
 #include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_GA.hpp"
 #include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_BEC.hpp"
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_TV_native.hpp"
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_DE.hpp"
 #include "Factory/Tools/Code/Polar/Frozenbits_generator.hpp"
 
 using namespace aff3ct;
@@ -51,7 +54,7 @@ void Frozenbits_generator::parameters
 		tools::Real(tools::Positive(), tools::Non_zero()));
 
 	tools::add_arg(args, p, class_name+"p+gen-method",
-		tools::Text(tools::Including_set("GA", "FILE", "5G", "TV", "BEC")));
+		tools::Text(tools::Including_set("GA", "FILE", "5G", "TV", "BEC", "TV_NATIVE", "DE")));
 
 	tools::add_arg(args, p, class_name+"p+awgn-path",
 		tools::Path(tools::openmode::read));
@@ -97,7 +100,10 @@ void Frozenbits_generator::parameters
 #endif
 	if (this->type == "TV" || this->type == "FILE")
 		headers[p].push_back(std::make_pair("Path", this->path_fb));
-	if (!this->dump_channels_path.empty() && (this->type == "GA" || this->type == "BEC"))
+	if (this->type == "TV_NATIVE" || this->type == "DE")
+		headers[p].push_back(std::make_pair("Channel type", this->channel_type));
+	if (!this->dump_channels_path.empty() && (this->type == "GA"        || this->type == "BEC" ||
+	                                          this->type == "TV_NATIVE" || this->type == "DE"))
 		headers[p].push_back(std::make_pair("Dump channels path", this->dump_channels_path));
 }
 
@@ -110,6 +116,23 @@ tools::Frozenbits_generator* Frozenbits_generator::parameters
 	if (this->type == "5G")   return new tools::Frozenbits_generator_5G  (this->K, this->N_cw                              );
 	if (this->type == "BEC")  return new tools::Frozenbits_generator_BEC (this->K, this->N_cw, this->dump_channels_path    );
 
+	if ((this->type == "TV_NATIVE" || this->type == "DE") && this->channel_type != "AWGN" && this->channel_type != "BSC")
+	{
+		std::stringstream message;
+		message << "The '" << this->type << "' frozen bits generation method only supports the 'AWGN' and 'BSC' "
+		        << "channels ('channel_type' = " << this->channel_type << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the bit channels are evaluated once per noise value and shared by the simulation threads (see
+	// Frozenbits_generator::generate), the evaluation is spread over all the hardware threads
+	if (this->type == "TV_NATIVE")
+		return new tools::Frozenbits_generator_TV_native(this->K, this->N_cw, this->channel_type, 64, 0,
+		                                                 this->dump_channels_path);
+	if (this->type == "DE")
+		return new tools::Frozenbits_generator_DE(this->K, this->N_cw, this->channel_type, 1023, 0.25, 0,
+		                                          this->dump_channels_path);
+
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
 
@@ -29,6 +29,7 @@ struct Frozenbits_generator : public Factory
 		std::string path_fb            = "conf/cde/awgn_polar_codes/TV";
 		std::string path_pb            = "../lib/polar_bounds/bin/polar_bounds";
 		std::string dump_channels_path = "";
+		std::string channel_type       = "AWGN"; // the channel seen by the TV_NATIVE and DE constructions
 		float       noise              = -1.f;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
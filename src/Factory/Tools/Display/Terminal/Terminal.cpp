@@ -3,6 +3,7 @@
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Documentation/documentation.h"
 #include "Tools/Display/Terminal/Standard/Terminal_std.hpp"
+#include "Tools/Display/Terminal/JSON/Terminal_JSON.hpp"
 #include "Factory/Tools/Display/Terminal/Terminal.hpp"
 
 using namespace aff3ct;
@@ -36,7 +37,7 @@ void Terminal::parameters
 	const std::string class_name = "factory::Terminal::parameters::";
 
 	tools::add_arg(args, p, class_name+"p+type",
-		tools::Text(tools::Including_set("STD")));
+		tools::Text(tools::Including_set("STD", "JSON")));
 
 	tools::add_arg(args, p, class_name+"p+no",
 		tools::None());
@@ -68,7 +69,8 @@ void Terminal::parameters
 tools::Terminal* Terminal::parameters
 ::build(const std::vector<std::unique_ptr<tools::Reporter>> &reporters) const
 {
-	if (this->type == "STD") return new tools::Terminal_std(reporters);
+	if (this->type == "STD" ) return new tools::Terminal_std (reporters);
+	if (this->type == "JSON") return new tools::Terminal_JSON(reporters);
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
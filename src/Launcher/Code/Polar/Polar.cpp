@@ -58,12 +58,19 @@ void Polar<L,B,R,Q>
 
 	L::store_args();
 
+	// the DSCF metric is computed on the quantized LLRs: the default alpha is scaled by their fixed-point position
+	auto pdec = dec_polar->get_prefix();
+	if (!std::is_floating_point<Q>::value && !this->arg_vals.exist({pdec+"-flip-alpha"}))
+		dec_polar->flip_alpha /= (float)(1 << this->params.qnt->n_decimals);
+
 	auto pfbg = this->params_cdc->fbg->get_prefix();
 
 	if (!this->arg_vals.exist({pfbg+"-gen-method"}))
 		if (this->params.chn->type == "BEC")
 			this->params_cdc->fbg->type = "BEC";
 
+	this->params_cdc->fbg->channel_type = this->params.chn->type;
+
 	params_cdc->enc->n_frames = this->params.src->n_frames;
 	if (params_cdc->pct != nullptr)
 		params_cdc->pct->n_frames = this->params.src->n_frames;
@@ -0,0 +1,29 @@
+#ifndef LAUNCHER_RM_HPP_
+#define LAUNCHER_RM_HPP_
+
+#include <iostream>
+
+#include "Factory/Module/Codec/RM/Codec_RM.hpp"
+
+namespace aff3ct
+{
+namespace launcher
+{
+template <class L, typename B = int, typename R = float, typename Q = R>
+class RM : public L
+{
+protected:
+	factory::Codec_RM::parameters *params_cdc;
+
+public:
+	RM(const int argc, const char **argv, std::ostream &stream = std::cout);
+	virtual ~RM() = default;
+
+protected:
+	virtual void get_description_args();
+	virtual void store_args();
+};
+}
+}
+
+#endif /* LAUNCHER_RM_HPP_ */
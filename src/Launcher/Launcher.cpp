@@ -7,6 +7,7 @@
 #endif
 
 #include "Tools/Display/Terminal/Terminal.hpp"
+#include "Tools/Display/Terminal/JSON/Terminal_JSON.hpp"
 #include "Tools/general_utils.h"
 #include "Tools/system_functions.h"
 #include "Tools/Display/rang_format/rang_format.h"
@@ -163,6 +164,10 @@ int Launcher::launch()
 		return EXIT_FAILURE;
 	}
 
+	// the text (parameters, legends, statistics) must not be mixed with the records written in the standard output
+	if (this->is_stdout_reserved())
+		tools::Terminal_JSON::reserve_stdout();
+
 	// write the command and he curve name in the PyBER format
 #ifdef AFF3CT_MPI
 	if (this->params_common.mpi_rank == 0)
@@ -226,5 +231,13 @@ int Launcher::launch()
 #endif
 			stream << rang::tag::comment << "End of the simulation." << std::endl;
 
+	tools::Terminal_JSON::release_stdout();
+
 	return exit_code;
 }
+
+bool Launcher
+::is_stdout_reserved() const
+{
+	return false;
+}
@@ -92,6 +92,14 @@ protected:
 	 */
 	virtual simulation::Simulation* build_simu() = 0;
 
+	/*!
+	 * \brief Tells if the standard output is reserved to the machine readable records of the terminal (the text of
+	 *        the simulation is then written in the error output).
+	 *
+	 * \return false by default.
+	 */
+	virtual bool is_stdout_reserved() const;
+
 	void print_header();
 
 private:
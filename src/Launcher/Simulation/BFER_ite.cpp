@@ -210,6 +210,13 @@ simulation::Simulation* BFER_ite<B,R,Q>
 	return factory::BFER_ite::build<B,R,Q>(params);
 }
 
+template <typename B, typename R, typename Q>
+bool BFER_ite<B,R,Q>
+::is_stdout_reserved() const
+{
+	return !params.ter->disabled && params.ter->type == "JSON";
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -222,6 +222,13 @@ simulation::Simulation* BFER_std<B,R,Q>
 	return factory::BFER_std::build<B,R,Q>(params);
 }
 
+template <typename B, typename R, typename Q>
+bool BFER_std<B,R,Q>
+::is_stdout_reserved() const
+{
+	return !params.ter->disabled && params.ter->type == "JSON";
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
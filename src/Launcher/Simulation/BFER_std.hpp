@@ -26,6 +26,8 @@ protected:
 	virtual void store_args();
 
 	virtual simulation::Simulation* build_simu();
+
+	virtual bool is_stdout_reserved() const;
 };
 }
 }
@@ -125,6 +125,13 @@ simulation::Simulation* EXIT<B,R>
 #endif
 }
 
+template <typename B, typename R>
+bool EXIT<B,R>
+::is_stdout_reserved() const
+{
+	return !params.ter->disabled && params.ter->type == "JSON";
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
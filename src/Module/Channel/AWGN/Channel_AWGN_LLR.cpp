@@ -72,6 +72,13 @@ void Channel_AWGN_LLR<R>
 	}
 }
 
+template <typename R>
+void Channel_AWGN_LLR<R>
+::set_seed(const int seed)
+{
+	this->noise_generator->set_seed(seed);
+}
+
 template<typename R>
 void Channel_AWGN_LLR<R>::check_noise()
 {
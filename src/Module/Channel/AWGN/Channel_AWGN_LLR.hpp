@@ -30,6 +30,8 @@ public:
 
 	virtual ~Channel_AWGN_LLR() = default;
 
+	virtual void set_seed(const int seed);
+
 	void add_noise(const R *X_N, R *Y_N, const int frame_id = -1); using Channel<R>::add_noise;
 
 protected:
@@ -55,6 +55,13 @@ void Channel_binary_erasure<R>
 		Y_N[i] = event_draw[i] ? tools::unknown_symbol_val<R>() : X_N[i];
 }
 
+template <typename R>
+void Channel_binary_erasure<R>
+::set_seed(const int seed)
+{
+	this->event_generator->set_seed(seed);
+}
+
 template<typename R>
 void Channel_binary_erasure<R>::check_noise()
 {
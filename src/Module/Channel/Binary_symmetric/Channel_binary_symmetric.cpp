@@ -60,6 +60,13 @@ void Channel_binary_symmetric<R>
 		Y_N[i] = event_draw[i] != (X_N[i] == (R)0.0) ? (R)0.0 : (R)1.0;
 }
 
+template <typename R>
+void Channel_binary_symmetric<R>
+::set_seed(const int seed)
+{
+	this->event_generator->set_seed(seed);
+}
+
 template<typename R>
 void Channel_binary_symmetric<R>::check_noise()
 {
@@ -30,6 +30,8 @@ public:
 
 	virtual ~Channel_binary_symmetric() = default;
 
+	virtual void set_seed(const int seed);
+
 protected:
 	void _add_noise(const R *X_N, R *Y_N, const int frame_id = -1);
 	virtual void check_noise();
@@ -83,6 +83,13 @@ public:
 
 	virtual void set_noise(const tools::Noise<R>& noise);
 
+	/*!
+	 * \brief Sets the seed of the noise generator (nothing is done if the Channel does not draw random numbers).
+	 *
+	 * \param seed: the new seed.
+	 */
+	virtual void set_seed(const int seed);
+
 	/*!
 	 * \brief Adds the noise to a perfectly clear signal.
 	 *
@@ -80,6 +80,12 @@ void Channel<R>
 	this->check_noise();
 }
 
+template <typename R>
+void Channel<R>
+::set_seed(const int seed)
+{
+}
+
 template<typename R>
 const tools::Noise <R> *Channel<R>
 ::current_noise() const
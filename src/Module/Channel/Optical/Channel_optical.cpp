@@ -28,6 +28,13 @@ void Channel_optical<R>
 	noise_generator->generate(X_N, Y_N, this->N, this->n->get_noise());
 }
 
+template <typename R>
+void Channel_optical<R>
+::set_seed(const int seed)
+{
+	this->noise_generator->set_seed(seed);
+}
+
 template<typename R>
 void Channel_optical<R>
 ::check_noise()
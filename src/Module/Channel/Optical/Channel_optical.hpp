@@ -30,6 +30,8 @@ public:
 
 	virtual ~Channel_optical() = default;
 
+	virtual void set_seed(const int seed);
+
 	void _add_noise(const R *X_N, R *Y_N, const int frame_id = -1);
 
 protected:
@@ -156,6 +156,13 @@ void Channel_Rayleigh_LLR<R>
 	}
 }
 
+template <typename R>
+void Channel_Rayleigh_LLR<R>
+::set_seed(const int seed)
+{
+	this->noise_generator->set_seed(seed);
+}
+
 template<typename R>
 void Channel_Rayleigh_LLR<R>::check_noise()
 {
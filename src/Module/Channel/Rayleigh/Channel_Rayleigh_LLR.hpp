@@ -35,6 +35,8 @@ public:
 
 	virtual ~Channel_Rayleigh_LLR() = default;
 
+	virtual void set_seed(const int seed);
+
 	virtual void add_noise_wg(const R *X_N, R *H_N, R *Y_N, const int frame_id = -1); using Channel<R>::add_noise_wg;
 
 protected:
@@ -134,6 +134,13 @@ void Channel_Rayleigh_LLR_user<R>
 	}
 }
 
+template <typename R>
+void Channel_Rayleigh_LLR_user<R>
+::set_seed(const int seed)
+{
+	this->noise_generator->set_seed(seed);
+}
+
 template<typename R>
 void Channel_Rayleigh_LLR_user<R>
 ::check_noise()
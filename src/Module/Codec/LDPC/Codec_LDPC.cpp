@@ -7,6 +7,7 @@
 #include "Tools/Exception/exception.hpp"
 #include "Factory/Module/Encoder/Encoder.hpp"
 #include "Factory/Module/Puncturer/Puncturer.hpp"
+#include "Module/Encoder/LDPC/From_H/Encoder_LDPC_from_H.hpp"
 #include "Module/Codec/LDPC/Codec_LDPC.hpp"
 
 using namespace aff3ct;
@@ -49,45 +50,15 @@ Codec_LDPC<B,Q>
 	}
 
 	// ---------------------------------------------------------------------------------------------------------- tools
-	if (enc_params.type == "LDPC")
-	{
-		G = tools::LDPC_matrix_handler::read(enc_params.G_path, &info_bits_pos);
-	}
-	else if (enc_params.type == "LDPC_DVBS2")
-	{
-		dvbs2 = tools::build_dvbs2(this->K, this->N);
-		H     = tools::build_H(*dvbs2);
-	}
-
-	if (H.get_n_connections() == 0)
-	{
-		tools::LDPC_matrix_handler::Positions_vector* ibp = nullptr;
-		std::vector<bool>* pct = nullptr;
-
-		if (info_bits_pos.empty())
-			ibp = &info_bits_pos;
-
-		if (pct_params != nullptr && pct_params->pattern.empty())
-			pct = &pct_params->pattern;
-
-		H = tools::LDPC_matrix_handler::read(dec_params.H_path, ibp, pct);
-	}
+	const bool read_pattern = pct_params != nullptr && pct_params->pattern.empty();
+	desc = tools::LDPC_descriptor::get(enc_params.type, this->K, this->N, enc_params.N_cw, enc_params.G_path,
+	                                   dec_params.H_path, dec_params.H_reorder, enc_params.G_method,
+	                                   enc_params.G_save_path, read_pattern);
 
-	if (dec_params.H_reorder != "NONE")
-	{	// reorder the H matrix following the check node degrees
-		H.sort_cols_per_density(dec_params.H_reorder == "ASC" ? tools::Matrix::Sort::ASCENDING :
-		                                                        tools::Matrix::Sort::DESCENDING);
-	}
+	if (read_pattern)
+		pct_params->pattern = desc->pct_pattern;
 
-	if (info_bits_pos.empty())
-	{
-		if (enc_params.type == "LDPC_H")
-			this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, G, H));
-	}
-	else
-	{
-		tools::LDPC_matrix_handler::check_info_pos(info_bits_pos, enc_params.K, enc_params.N_cw);
-	}
+	info_bits_pos = desc->info_bits_pos;
 
 	// ---------------------------------------------------------------------------------------------------- allocations
 	if (pct_params == nullptr)
@@ -113,15 +84,19 @@ Codec_LDPC<B,Q>
 		}
 	}
 
-	try
+	if (enc_params.type == "LDPC_H")
 	{
-		this->get_encoder();
+		this->set_encoder(new module::Encoder_LDPC_from_H<B>(enc_params.K, enc_params.N_cw, desc->H, desc->G,
+		                                                     desc->G_info_bits_pos, enc_params.n_frames));
 	}
-	catch (tools::runtime_error const&)
-	{ // encoder not set when building encoder LDPC_H
+	else
+	{
 		try
 		{
-			this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, G, H, *dvbs2));
+			if (desc->dvbs2 != nullptr)
+				this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, desc->G, desc->H, *desc->dvbs2));
+			else
+				this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, desc->G, desc->H));
 		}
 		catch(tools::cannot_allocate const&)
 		{
@@ -145,11 +120,11 @@ Codec_LDPC<B,Q>
 
 	try
 	{
-		this->set_decoder_siso_siho(factory::Decoder_LDPC::build_siso<B,Q>(dec_params, H, info_bits_pos, this->get_encoder()));
+		this->set_decoder_siso_siho(factory::Decoder_LDPC::build_siso<B,Q>(dec_params, desc->H, info_bits_pos, this->get_encoder()));
 	}
 	catch (const std::exception&)
 	{
-		this->set_decoder_siho(factory::Decoder_LDPC::build<B,Q>(dec_params, H, info_bits_pos, this->get_encoder()));
+		this->set_decoder_siho(factory::Decoder_LDPC::build<B,Q>(dec_params, desc->H, info_bits_pos, this->get_encoder()));
 	}
 }
 
@@ -7,9 +7,8 @@
 #include "Factory/Module/Encoder/LDPC/Encoder_LDPC.hpp"
 #include "Factory/Module/Puncturer/LDPC/Puncturer_LDPC.hpp"
 #include "Factory/Module/Decoder/LDPC/Decoder_LDPC.hpp"
-#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
-#include "Tools/Code/LDPC/Standard/DVBS2/DVBS2_constants.hpp"
 #include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
+#include "Tools/Code/LDPC/Descriptor/LDPC_descriptor.hpp"
 #include "Module/Codec/Codec_SISO_SIHO.hpp"
 
 namespace aff3ct
@@ -20,11 +19,8 @@ template <typename B = int, typename Q = float>
 class Codec_LDPC : public Codec_SISO_SIHO<B,Q>
 {
 protected:
-	tools::Sparse_matrix H;
-	tools::Sparse_matrix G;
+	std::shared_ptr<const tools::LDPC_descriptor> desc; // H, G, ... shared by all the codecs built with the same params
 	tools::LDPC_matrix_handler::Positions_vector info_bits_pos;
-	std::vector<bool> pctPattern;
-	std::unique_ptr<tools::dvbs2_values> dvbs2;
 
 public:
 	Codec_LDPC(const factory::Encoder_LDPC::parameters   &enc_params,
@@ -128,12 +128,13 @@ Codec_polar<B,Q>
 	{
 		if (!adaptive_fb)
 		{
-			if(fb_params.type == "BEC")
+			if(fb_params.type == "BEC" || ((fb_params.type == "TV_NATIVE" || fb_params.type == "DE") &&
+			                               fb_params.channel_type == "BSC"))
 			{
 				auto ep = tools::Event_probability<float>(fb_params.noise);
 				fb_generator->set_noise(ep);
 			}
-			else /* type = GA, TV or FILE */
+			else /* type = GA, TV, FILE, or TV_NATIVE and DE on the AWGN channel */
 			{
 				auto sigma = tools::Sigma<float>(fb_params.noise);
 				fb_generator->set_noise(sigma);
@@ -0,0 +1,23 @@
+#ifndef CODEC_RM_HPP_
+#define CODEC_RM_HPP_
+
+#include "Factory/Module/Encoder/RM/Encoder_RM.hpp"
+#include "Factory/Module/Decoder/RM/Decoder_RM.hpp"
+#include "Module/Codec/Codec_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B = int, typename Q = float>
+class Codec_RM : public Codec_SIHO<B,Q>
+{
+public:
+	Codec_RM(const factory::Encoder_RM::parameters &enc_params,
+	         const factory::Decoder_RM::parameters &dec_params);
+	virtual ~Codec_RM() = default;
+};
+}
+}
+
+#endif /* CODEC_RM_HPP_ */
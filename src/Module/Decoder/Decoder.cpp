@@ -82,3 +82,19 @@ void Decoder
 {
 
 }
+
+bool Decoder
+::is_padded(const Socket &s, const int frame_size) const
+{
+	const auto n_pad_frames = this->simd_inter_frame_level - this->n_inter_frame_rest;
+	return this->n_inter_frame_rest != 0 &&
+	       s.get_padbytes() >= (size_t)(n_pad_frames * frame_size) * s.get_datatype_size();
+}
+
+void Decoder
+::set_wave_padding(Socket &s, const int frame_size)
+{
+	const auto n_pad_frames = this->simd_inter_frame_level - this->n_inter_frame_rest;
+	if (this->n_inter_frame_rest != 0)
+		Module::set_padding(s, (size_t)(n_pad_frames * frame_size));
+}
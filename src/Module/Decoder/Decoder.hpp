@@ -63,6 +63,25 @@ public:
 	int get_n_dec_waves() const;
 
 	virtual void reset();
+
+protected:
+	/*!
+	 * \brief Tells if a socket has enough padding to hold the last partial SIMD wave in place.
+	 *
+	 * \param s:          a socket of the decoder.
+	 * \param frame_size: number of elements in one frame of the socket.
+	 *
+	 * \return true if the last wave is partial and if it can be read/written directly in the socket data.
+	 */
+	bool is_padded(const Socket &s, const int frame_size) const;
+
+	/*!
+	 * \brief Requests the padding of a socket to the size of the full SIMD waves (nothing when all the waves are full).
+	 *
+	 * \param s:          a socket of the decoder.
+	 * \param frame_size: number of elements in one frame of the socket.
+	 */
+	void set_wave_padding(Socket &s, const int frame_size);
 };
 }
 }
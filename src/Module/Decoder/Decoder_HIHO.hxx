@@ -14,8 +14,8 @@ template <typename B>
 Decoder_HIHO<B>
 ::Decoder_HIHO(const int K, const int N, const int n_frames, const int simd_inter_frame_level)
 : Decoder(K, N, n_frames, simd_inter_frame_level),
-  Y_N    (this->n_inter_frame_rest ? this->simd_inter_frame_level * this->N : 0),
-  V_KN   (this->n_inter_frame_rest ? this->simd_inter_frame_level * this->N : 0)
+  Y_N    (this->simd_inter_frame_level > 1 ? this->simd_inter_frame_level * this->N : 0),
+  V_KN   (this->simd_inter_frame_level > 1 ? this->simd_inter_frame_level * this->N : 0)
 {
 	const std::string name = "Decoder_HIHO";
 	this->set_name(name);
@@ -23,10 +23,21 @@ Decoder_HIHO<B>
 	auto &p1 = this->create_task("decode_hiho", (int)dec::tsk::decode_hiho);
 	auto &p1s_Y_N = this->template create_socket_in <B>(p1, "Y_N", this->N * this->n_frames);
 	auto &p1s_V_K = this->template create_socket_out<B>(p1, "V_K", this->K * this->n_frames);
+	this->set_wave_padding(p1s_Y_N, this->N);
+	this->set_wave_padding(p1s_V_K, this->K);
 	this->create_codelet(p1, [this, &p1s_Y_N, &p1s_V_K]() -> int
 	{
-		this->decode_hiho(static_cast<B*>(p1s_Y_N.get_dataptr()),
-		                  static_cast<B*>(p1s_V_K.get_dataptr()));
+		auto Y_N = static_cast<B*>(p1s_Y_N.get_dataptr());
+		auto V_K = static_cast<B*>(p1s_V_K.get_dataptr());
+
+		// the last partial wave is decoded in place when the sockets are padded, without the staging copies
+		if (this->is_padded(p1s_Y_N, this->N) && this->is_padded(p1s_V_K, this->K))
+			for (auto w = 0; w < this->n_dec_waves; w++)
+				this->_decode_hiho(Y_N + w * this->N * this->simd_inter_frame_level,
+				                   V_K + w * this->K * this->simd_inter_frame_level,
+				                   w * this->simd_inter_frame_level);
+		else
+			this->decode_hiho(Y_N, V_K);
 
 		return 0;
 	});
@@ -37,10 +48,21 @@ Decoder_HIHO<B>
 	auto &p2 = this->create_task("decode_hiho_cw", (int)dec::tsk::decode_hiho_cw);
 	auto &p2s_Y_N = this->template create_socket_in <B>(p2, "Y_N", this->N * this->n_frames);
 	auto &p2s_V_N = this->template create_socket_out<B>(p2, "V_N", this->N * this->n_frames);
+	this->set_wave_padding(p2s_Y_N, this->N);
+	this->set_wave_padding(p2s_V_N, this->N);
 	this->create_codelet(p2, [this, &p2s_Y_N, &p2s_V_N]() -> int
 	{
-		this->decode_hiho_cw(static_cast<B*>(p2s_Y_N.get_dataptr()),
-		                     static_cast<B*>(p2s_V_N.get_dataptr()));
+		auto Y_N = static_cast<B*>(p2s_Y_N.get_dataptr());
+		auto V_N = static_cast<B*>(p2s_V_N.get_dataptr());
+
+		// the last partial wave is decoded in place when the sockets are padded, without the staging copies
+		if (this->is_padded(p2s_Y_N, this->N) && this->is_padded(p2s_V_N, this->N))
+			for (auto w = 0; w < this->n_dec_waves; w++)
+				this->_decode_hiho_cw(Y_N + w * this->N * this->simd_inter_frame_level,
+				                      V_N + w * this->N * this->simd_inter_frame_level,
+				                      w * this->simd_inter_frame_level);
+		else
+			this->decode_hiho_cw(Y_N, V_N);
 
 		return 0;
 	});
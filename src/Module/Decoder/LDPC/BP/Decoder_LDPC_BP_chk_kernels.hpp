@@ -0,0 +1,86 @@
+#ifndef DECODER_LDPC_BP_CHK_KERNELS_HPP_
+#define DECODER_LDPC_BP_CHK_KERNELS_HPP_
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \brief Leaves the outputs of the check nodes unchanged.
+ */
+struct Chk_out_identity
+{
+	template <typename V>
+	inline V operator()(const V &v) const { return v; }
+};
+
+/*!
+ * \brief Check node kernels of the BP decoders, for a flooding or a layered schedule.
+ *
+ * The kernels of the degrees in [chk_degree_min; chk_degree_max] are unrolled at compile time: the inputs and the
+ * outputs of the check node stay in local arrays (no store into the messages during the update rule calls), so the
+ * state of the rule can be kept in registers. The other degrees are processed by a generic kernel. The kernels only
+ * depend on their parameters, so several threads can process distinct check nodes with their own update rule.
+ *
+ * \tparam V:           type of the messages (R, or mipp::Reg<R> in the inter-frame SIMD decoders)
+ * \tparam Update_rule: update rule of the check nodes
+ * \tparam Out:         function applied to the outputs of the check nodes (a saturation for instance)
+ */
+template <typename V, class Update_rule, class Out = Chk_out_identity>
+class Decoder_LDPC_BP_chk_kernels
+{
+public:
+	static constexpr int chk_degree_min = 3;
+	static constexpr int chk_degree_max = 32;
+
+	// flooding schedule: the messages of the check node 'c' are at the 'transpose_ptr' positions in 'msg_var_to_chk'
+	// and in 'msg_chk_to_var'
+	using flooding_t = void (*)(Update_rule &up_rule, const Out &out, const V *msg_var_to_chk, V *msg_chk_to_var,
+	                            const int c, const int degree, const uint32_t *transpose_ptr);
+
+	// layered schedule: the variable nodes are updated in place, 'k' is the position of the messages of the check node
+	// 'c' (moved to the next check node), 'contributions' is a buffer of 'degree' values for the generic kernel
+	using layered_t = void (*)(Update_rule &up_rule, const Out &out, V *contributions, const int c,
+	                           const uint32_t *var_ids, const int degree, V *var_nodes, V *messages, int &k);
+
+	/*!
+	 * \brief Chooses the kernels from the degree profile of H.
+	 *
+	 * \return the kernel of each check node degree (indexed by the degree)
+	 */
+	static std::vector<flooding_t> get_flooding_kernels(const tools::Sparse_matrix &H);
+	static std::vector<layered_t > get_layered_kernels (const tools::Sparse_matrix &H);
+
+	template <int D>
+	static void flooding        (Update_rule &up_rule, const Out &out, const V *msg_var_to_chk, V *msg_chk_to_var,
+	                             const int c, const int degree, const uint32_t *transpose_ptr);
+	static void flooding_generic(Update_rule &up_rule, const Out &out, const V *msg_var_to_chk, V *msg_chk_to_var,
+	                             const int c, const int degree, const uint32_t *transpose_ptr);
+
+	template <int D>
+	static void layered         (Update_rule &up_rule, const Out &out, V *contributions, const int c,
+	                             const uint32_t *var_ids, const int degree, V *var_nodes, V *messages, int &k);
+	static void layered_generic (Update_rule &up_rule, const Out &out, V *contributions, const int c,
+	                             const uint32_t *var_ids, const int degree, V *var_nodes, V *messages, int &k);
+
+private:
+	template <int D>
+	static flooding_t get_flooding_kernel(const int degree, std::integral_constant<int,D                 >);
+	static flooding_t get_flooding_kernel(const int degree, std::integral_constant<int,chk_degree_min -1>);
+
+	template <int D>
+	static layered_t  get_layered_kernel (const int degree, std::integral_constant<int,D                 >);
+	static layered_t  get_layered_kernel (const int degree, std::integral_constant<int,chk_degree_min -1>);
+};
+}
+}
+
+#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP_chk_kernels.hxx"
+
+#endif /* DECODER_LDPC_BP_CHK_KERNELS_HPP_ */
@@ -0,0 +1,168 @@
+#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP_chk_kernels.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename V, class Update_rule, class Out>
+std::vector<typename Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>::flooding_t>
+Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>
+::get_flooding_kernels(const tools::Sparse_matrix &H)
+{
+	std::vector<flooding_t> kernels(H.get_cols_max_degree() +1, &flooding_generic);
+	for (size_t c = 0; c < H.get_n_cols(); c++)
+	{
+		const auto chk_degree = (int)H[c].size();
+		kernels[chk_degree] = get_flooding_kernel(chk_degree, std::integral_constant<int,chk_degree_max>());
+	}
+	return kernels;
+}
+
+template <typename V, class Update_rule, class Out>
+std::vector<typename Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>::layered_t>
+Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>
+::get_layered_kernels(const tools::Sparse_matrix &H)
+{
+	std::vector<layered_t> kernels(H.get_cols_max_degree() +1, &layered_generic);
+	for (size_t c = 0; c < H.get_n_cols(); c++)
+	{
+		const auto chk_degree = (int)H[c].size();
+		kernels[chk_degree] = get_layered_kernel(chk_degree, std::integral_constant<int,chk_degree_max>());
+	}
+	return kernels;
+}
+
+template <typename V, class Update_rule, class Out>
+template <int D>
+void Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>
+::flooding(Update_rule &up_rule, const Out &out, const V *msg_var_to_chk, V *msg_chk_to_var, const int c,
+           const int /*degree*/, const uint32_t *transpose_ptr)
+{
+	V ins[D], outs[D];
+
+	up_rule.begin_chk_node_in(c, D);
+	for (auto v = 0; v < D; v++)
+	{
+		ins[v] = msg_var_to_chk[transpose_ptr[v]];
+		up_rule.compute_chk_node_in(v, ins[v]);
+	}
+	up_rule.end_chk_node_in();
+
+	up_rule.begin_chk_node_out(c, D);
+	for (auto v = 0; v < D; v++)
+		outs[v] = out(up_rule.compute_chk_node_out(v, ins[v]));
+	up_rule.end_chk_node_out();
+
+	for (auto v = 0; v < D; v++)
+		msg_chk_to_var[transpose_ptr[v]] = outs[v];
+}
+
+template <typename V, class Update_rule, class Out>
+void Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>
+::flooding_generic(Update_rule &up_rule, const Out &out, const V *msg_var_to_chk, V *msg_chk_to_var, const int c,
+                   const int degree, const uint32_t *transpose_ptr)
+{
+	up_rule.begin_chk_node_in(c, degree);
+	for (auto v = 0; v < degree; v++)
+		up_rule.compute_chk_node_in(v, msg_var_to_chk[transpose_ptr[v]]);
+	up_rule.end_chk_node_in();
+
+	up_rule.begin_chk_node_out(c, degree);
+	for (auto v = 0; v < degree; v++)
+		msg_chk_to_var[transpose_ptr[v]] = out(up_rule.compute_chk_node_out(v, msg_var_to_chk[transpose_ptr[v]]));
+	up_rule.end_chk_node_out();
+}
+
+template <typename V, class Update_rule, class Out>
+template <int D>
+void Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>
+::layered(Update_rule &up_rule, const Out &out, V * /*contributions*/, const int c, const uint32_t *var_ids,
+          const int /*degree*/, V *var_nodes, V *messages, int &k)
+{
+	V contribs[D], outs[D];
+
+	up_rule.begin_chk_node_in(c, D);
+	for (auto v = 0; v < D; v++)
+	{
+		contribs[v] = var_nodes[var_ids[v]] - messages[k + v];
+		up_rule.compute_chk_node_in(v, contribs[v]);
+	}
+	up_rule.end_chk_node_in();
+
+	up_rule.begin_chk_node_out(c, D);
+	for (auto v = 0; v < D; v++)
+		outs[v] = out(up_rule.compute_chk_node_out(v, contribs[v]));
+	up_rule.end_chk_node_out();
+
+	for (auto v = 0; v < D; v++)
+	{
+		messages[k + v] = outs[v];
+		var_nodes[var_ids[v]] = contribs[v] + outs[v];
+	}
+	k += D;
+}
+
+template <typename V, class Update_rule, class Out>
+void Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>
+::layered_generic(Update_rule &up_rule, const Out &out, V *contributions, const int c, const uint32_t *var_ids,
+                  const int degree, V *var_nodes, V *messages, int &k)
+{
+	up_rule.begin_chk_node_in(c, degree);
+	for (auto v = 0; v < degree; v++)
+	{
+		contributions[v] = var_nodes[var_ids[v]] - messages[k + v];
+		up_rule.compute_chk_node_in(v, contributions[v]);
+	}
+	up_rule.end_chk_node_in();
+
+	up_rule.begin_chk_node_out(c, degree);
+	for (auto v = 0; v < degree; v++)
+	{
+		messages[k + v] = out(up_rule.compute_chk_node_out(v, contributions[v]));
+		var_nodes[var_ids[v]] = contributions[v] + messages[k + v];
+	}
+	up_rule.end_chk_node_out();
+	k += degree;
+}
+
+template <typename V, class Update_rule, class Out>
+template <int D>
+typename Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>::flooding_t
+Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>
+::get_flooding_kernel(const int degree, std::integral_constant<int,D>)
+{
+	if (degree == D)
+		return &Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>::template flooding<D>;
+	else
+		return get_flooding_kernel(degree, std::integral_constant<int,D -1>());
+}
+
+template <typename V, class Update_rule, class Out>
+typename Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>::flooding_t
+Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>
+::get_flooding_kernel(const int /*degree*/, std::integral_constant<int,chk_degree_min -1>)
+{
+	return &Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>::flooding_generic;
+}
+
+template <typename V, class Update_rule, class Out>
+template <int D>
+typename Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>::layered_t
+Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>
+::get_layered_kernel(const int degree, std::integral_constant<int,D>)
+{
+	if (degree == D)
+		return &Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>::template layered<D>;
+	else
+		return get_layered_kernel(degree, std::integral_constant<int,D -1>());
+}
+
+template <typename V, class Update_rule, class Out>
+typename Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>::layered_t
+Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>
+::get_layered_kernel(const int /*degree*/, std::integral_constant<int,chk_degree_min -1>)
+{
+	return &Decoder_LDPC_BP_chk_kernels<V,Update_rule,Out>::layered_generic;
+}
+}
+}
@@ -8,6 +8,7 @@
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
 #include "Module/Decoder/Decoder_SISO_SIHO.hpp"
 #include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP.hpp"
+#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP_chk_kernels.hpp"
 
 namespace aff3ct
 {
@@ -21,6 +22,10 @@ protected:
 
 	Update_rule up_rule;
 
+	// check node kernel of each degree, chosen from the degree profile of H
+	using Chk_kernels = Decoder_LDPC_BP_chk_kernels<R,Update_rule>;
+	const std::vector<typename Chk_kernels::flooding_t> chk_kernels;
+
 	std::vector<uint32_t      > transpose;
 	std::vector<R             > post;       // a posteriori information
 	std::vector<std::vector<R>> msg_chk_to_var; // check    nodes to variable nodes messages
@@ -44,7 +49,7 @@ protected:
 	void _decode_siho   (const R *Y_N,  B *V_K,  const int frame_id);
 	void _decode_siho_cw(const R *Y_N,  B *V_N,  const int frame_id);
 
-	        void _decode               (const R *Y_N, const int frame_id);
+	virtual void _decode               (const R *Y_N, const int frame_id);
 	        void _initialize_var_to_chk(const R *Y_N, const std::vector<R> &msg_chk_to_var, std::vector<R> &msg_var_to_chk);
 	virtual void _decode_single_ite    (              const std::vector<R> &msg_var_to_chk, std::vector<R> &msg_chk_to_var);
 	        void _compute_post         (const R *Y_N, const std::vector<R> &msg_chk_to_var, std::vector<R> &post);
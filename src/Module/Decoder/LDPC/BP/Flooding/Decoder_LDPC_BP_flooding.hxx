@@ -24,6 +24,7 @@ Decoder_LDPC_BP_flooding<B,R,Update_rule>
   Decoder_LDPC_BP       (K, N, n_ite, _H, enable_syndrome, syndrome_depth     ),
   info_bits_pos         (info_bits_pos                                        ),
   up_rule               (up_rule                                              ),
+  chk_kernels           (Chk_kernels::get_flooding_kernels(this->H)           ),
   transpose             (this->H.get_n_connections()                          ),
   post                  (N, -1                                                ),
   msg_chk_to_var        (n_frames, std::vector<R>(this->H.get_n_connections())),
@@ -219,17 +220,8 @@ void Decoder_LDPC_BP_flooding<B,R,Update_rule>
 	for (auto c = 0; c < n_chk_nodes; c++)
 	{
 		const auto chk_degree = (int)this->H.get_col_to_rows()[c].size();
-
-		this->up_rule.begin_chk_node_in(c, chk_degree);
-		for (auto v = 0; v < chk_degree; v++)
-			this->up_rule.compute_chk_node_in(v, msg_var_to_chk[transpose_ptr[v]]);
-		this->up_rule.end_chk_node_in();
-
-		this->up_rule.begin_chk_node_out(c, chk_degree);
-		for (auto v = 0; v < chk_degree; v++)
-			msg_chk_to_var[transpose_ptr[v]] = this->up_rule.compute_chk_node_out(v, msg_var_to_chk[transpose_ptr[v]]);
-		this->up_rule.end_chk_node_out();
-
+		this->chk_kernels[chk_degree](this->up_rule, Chk_out_identity(), msg_var_to_chk.data(), msg_chk_to_var.data(),
+		                              c, chk_degree, transpose_ptr);
 		transpose_ptr += chk_degree;
 	}
 }
@@ -10,6 +10,8 @@
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
 #include "Module/Decoder/Decoder_SISO_SIHO.hpp"
 #include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP.hpp"
+#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP_chk_kernels.hpp"
+#include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered_inter.hpp"
 
 namespace aff3ct
 {
@@ -25,6 +27,11 @@ protected:
 
 	const R sat_val;
 
+	// check node kernel of each degree, chosen from the degree profile of H
+	using Chk_kernels = Decoder_LDPC_BP_chk_kernels<mipp::Reg<R>,Update_rule,Chk_out_saturate<R>>;
+	const Chk_out_saturate<R> chk_out;
+	const std::vector<typename Chk_kernels::flooding_t> chk_kernels;
+
 	std::vector<uint32_t> transpose;
 
 	mipp::vector<mipp::Reg<R>>              post;       // a posteriori information
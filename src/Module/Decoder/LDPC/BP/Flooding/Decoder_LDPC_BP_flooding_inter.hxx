@@ -30,6 +30,8 @@ Decoder_LDPC_BP_flooding_inter<B,R,Update_rule>
   info_bits_pos         (info_bits_pos                                                                      ),
   up_rule               (up_rule                                                                            ),
   sat_val               ((R)((1 << ((sizeof(R) * 8 -2) - (int)std::log2(this->H.get_rows_max_degree()))) -1)),
+  chk_out               (this->sat_val                                                                      ),
+  chk_kernels           (Chk_kernels::get_flooding_kernels(this->H)                                         ),
   transpose             (this->H.get_n_connections()                                                        ),
   post                  (N, -1                                                                              ),
   msg_chk_to_var        (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(this->H.get_n_connections())         ),
@@ -272,20 +274,8 @@ void Decoder_LDPC_BP_flooding_inter<B,R,Update_rule>
 	for (auto c = 0; c < n_chk_nodes; c++)
 	{
 		const auto chk_degree = (int)this->H.get_col_to_rows()[c].size();
-
-		this->up_rule.begin_chk_node_in(c, chk_degree);
-		for (auto v = 0; v < chk_degree; v++)
-			this->up_rule.compute_chk_node_in(v, msg_var_to_chk[transpose_ptr[v]]);
-		this->up_rule.end_chk_node_in();
-
-		this->up_rule.begin_chk_node_out(c, chk_degree);
-		for (auto v = 0; v < chk_degree; v++)
-		{
-			auto val = saturate<R>(this->up_rule.compute_chk_node_out(v, msg_var_to_chk[transpose_ptr[v]]), this->sat_val);
-			msg_chk_to_var[transpose_ptr[v]] = val;
-		}
-		this->up_rule.end_chk_node_out();
-
+		this->chk_kernels[chk_degree](this->up_rule, this->chk_out, msg_var_to_chk.data(), msg_chk_to_var.data(), c,
+		                              chk_degree, transpose_ptr);
 		transpose_ptr += chk_degree;
 	}
 }
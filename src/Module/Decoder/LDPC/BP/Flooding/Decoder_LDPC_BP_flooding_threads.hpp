@@ -0,0 +1,62 @@
+#ifndef DECODER_LDPC_BP_FLOODING_THREADS_HPP_
+#define DECODER_LDPC_BP_FLOODING_THREADS_HPP_
+
+#include <vector>
+#include <cstdint>
+
+#include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Thread_team/Thread_team.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \brief Flooding BP decoder that splits the decoding of a single frame over a team of threads.
+ *
+ * In the flooding schedule, all the check nodes (resp. variable nodes) are independent: each thread updates a
+ * contiguous range of nodes with the same number of connections and the two phases are separated by spin barriers.
+ */
+template <typename B = int, typename R = float, class Update_rule = tools::Update_rule_SPA<R>>
+class Decoder_LDPC_BP_flooding_threads : public Decoder_LDPC_BP_flooding<B,R,Update_rule>
+{
+protected:
+	tools::Thread_team team;
+
+	std::vector<Update_rule> up_rules; // the state of the update rule is private to each thread
+
+	std::vector<uint32_t> var_offsets; // offset of the first message of each variable node
+	std::vector<uint32_t> chk_offsets; // offset of the first message of each check    node
+	std::vector<uint32_t> var_parts;   // variable nodes of each thread ('n_threads' +1 bounds)
+	std::vector<uint32_t> chk_parts;   // check    nodes of each thread ('n_threads' +1 bounds)
+	std::vector<uint8_t > synd_valid;  // partial syndrome of each thread
+
+public:
+	Decoder_LDPC_BP_flooding_threads(const int K, const int N, const int n_ite,
+	                                 const tools::Sparse_matrix &H,
+	                                 const std::vector<uint32_t> &info_bits_pos,
+	                                 const Update_rule &up_rule,
+	                                 const int n_threads,
+	                                 const bool enable_syndrome = true,
+	                                 const int syndrome_depth = 1,
+	                                 const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_flooding_threads() = default;
+
+protected:
+	void _decode(const R *Y_N, const int frame_id);
+
+	void _initialize_var_to_chk(const R *Y_N, const R *msg_chk_to_var, R *msg_var_to_chk, const int first_var,
+	                            const int last_var);
+	void _decode_chk_nodes     (Update_rule &up_rule, const R *msg_var_to_chk, R *msg_chk_to_var, const int first_chk,
+	                            const int last_chk);
+	void _compute_post         (const R *Y_N, const R *msg_chk_to_var, R *post, const int first_var,
+	                            const int last_var);
+};
+}
+}
+
+#include "Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding_threads.hxx"
+
+#endif /* DECODER_LDPC_BP_FLOODING_THREADS_HPP_ */
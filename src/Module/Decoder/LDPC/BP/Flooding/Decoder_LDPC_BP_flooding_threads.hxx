@@ -0,0 +1,162 @@
+#include <string>
+#include <algorithm>
+
+#include "Tools/Code/LDPC/Syndrome/LDPC_syndrome.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding_threads.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class Update_rule>
+Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::Decoder_LDPC_BP_flooding_threads(const int K, const int N, const int n_ite,
+                                   const tools::Sparse_matrix &_H,
+                                   const std::vector<uint32_t> &info_bits_pos,
+                                   const Update_rule &up_rule,
+                                   const int n_threads,
+                                   const bool enable_syndrome,
+                                   const int syndrome_depth,
+                                   const int n_frames)
+: Decoder(K, N, n_frames, 1),
+  Decoder_LDPC_BP_flooding<B,R,Update_rule>(K, N, n_ite, _H, info_bits_pos, up_rule, enable_syndrome, syndrome_depth,
+                                            n_frames),
+  team       ((size_t)std::max(n_threads, 0)),
+  up_rules   (n_threads, up_rule             ),
+  var_offsets(this->H.get_n_rows() +1, 0     ),
+  chk_offsets(this->H.get_n_cols() +1, 0     ),
+  synd_valid (n_threads, 0                   )
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_threads<" + this->up_rule.get_name() + ">";
+	this->set_name(name);
+
+	const auto &var_to_chk = this->H.get_row_to_cols();
+	const auto &chk_to_var = this->H.get_col_to_rows();
+
+	for (size_t v = 0; v < var_to_chk.size(); v++)
+		this->var_offsets[v +1] = this->var_offsets[v] + (uint32_t)var_to_chk[v].size();
+	for (size_t c = 0; c < chk_to_var.size(); c++)
+		this->chk_offsets[c +1] = this->chk_offsets[c] + (uint32_t)chk_to_var[c].size();
+
+	this->var_parts = tools::Thread_team::split(var_to_chk, 0, var_to_chk.size(), n_threads);
+	this->chk_parts = tools::Thread_team::split(chk_to_var, 0, chk_to_var.size(), n_threads);
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_decode(const R *Y_N, const int frame_id)
+{
+	const auto cur_depth = this->cur_syndrome_depth;
+	auto new_depth = cur_depth;
+
+	this->team.run([&](const size_t tid)
+	{
+		auto &up_rule        = this->up_rules[tid];
+		auto *msg_chk_to_var = this->msg_chk_to_var[frame_id].data();
+		auto *msg_var_to_chk = this->msg_var_to_chk[frame_id].data();
+		const auto first_var = (int)this->var_parts[tid], last_var = (int)this->var_parts[tid +1];
+		const auto first_chk = (int)this->chk_parts[tid], last_chk = (int)this->chk_parts[tid +1];
+		auto depth = cur_depth;
+
+		up_rule.begin_decoding(this->n_ite);
+
+		auto ite = 0;
+		for (; ite < this->n_ite; ite++)
+		{
+			up_rule.begin_ite(ite);
+			this->_initialize_var_to_chk(Y_N, msg_chk_to_var, msg_var_to_chk, first_var, last_var);
+			this->team.barrier(tid);
+			this->_decode_chk_nodes(up_rule, msg_var_to_chk, msg_chk_to_var, first_chk, last_chk);
+			this->team.barrier(tid);
+			up_rule.end_ite();
+
+			if (this->enable_syndrome && ite != this->n_ite -1)
+			{
+				this->_compute_post(Y_N, msg_chk_to_var, this->post.data(), first_var, last_var);
+				this->team.barrier(tid);
+				this->synd_valid[tid] = tools::LDPC_syndrome::check_soft(this->post.data(), this->H, first_chk,
+				                                                         last_chk);
+				this->team.barrier(tid);
+
+				// all the threads take the same decision
+				const auto syndrome = std::all_of(this->synd_valid.begin(), this->synd_valid.end(),
+				                                  [](const uint8_t s) { return s != 0; });
+				depth = syndrome ? (depth +1) % this->syndrome_depth : 0;
+				if (syndrome && depth == 0)
+					break;
+			}
+		}
+		if (ite == this->n_ite)
+			this->_compute_post(Y_N, msg_chk_to_var, this->post.data(), first_var, last_var);
+
+		up_rule.end_decoding();
+
+		if (tid == 0)
+			new_depth = depth;
+	});
+
+	this->cur_syndrome_depth = new_depth;
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_initialize_var_to_chk(const R *Y_N, const R *msg_chk_to_var, R *msg_var_to_chk, const int first_var,
+                         const int last_var)
+{
+	auto *msg_chk_to_var_ptr = msg_chk_to_var + this->var_offsets[first_var];
+	auto *msg_var_to_chk_ptr = msg_var_to_chk + this->var_offsets[first_var];
+
+	for (auto v = first_var; v < last_var; v++)
+	{
+		const auto var_degree = (int)(this->var_offsets[v +1] - this->var_offsets[v]);
+
+		auto sum_msg_chk_to_var = (R)0;
+		for (auto c = 0; c < var_degree; c++)
+			sum_msg_chk_to_var += msg_chk_to_var_ptr[c];
+
+		const auto tmp = Y_N[v] + sum_msg_chk_to_var;
+		for (auto c = 0; c < var_degree; c++)
+			msg_var_to_chk_ptr[c] = tmp - msg_chk_to_var_ptr[c];
+
+		msg_chk_to_var_ptr += var_degree;
+		msg_var_to_chk_ptr += var_degree;
+	}
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_decode_chk_nodes(Update_rule &up_rule, const R *msg_var_to_chk, R *msg_chk_to_var, const int first_chk,
+                    const int last_chk)
+{
+	auto transpose_ptr = this->transpose.data() + this->chk_offsets[first_chk];
+
+	for (auto c = first_chk; c < last_chk; c++)
+	{
+		const auto chk_degree = (int)(this->chk_offsets[c +1] - this->chk_offsets[c]);
+		this->chk_kernels[chk_degree](up_rule, Chk_out_identity(), msg_var_to_chk, msg_chk_to_var, c, chk_degree,
+		                              transpose_ptr);
+		transpose_ptr += chk_degree;
+	}
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_compute_post(const R *Y_N, const R *msg_chk_to_var, R *post, const int first_var, const int last_var)
+{
+	const auto *msg_chk_to_var_ptr = msg_chk_to_var + this->var_offsets[first_var];
+
+	for (auto v = first_var; v < last_var; v++)
+	{
+		const auto var_degree = (int)(this->var_offsets[v +1] - this->var_offsets[v]);
+
+		auto sum_msg_chk_to_var = (R)0;
+		for (auto c = 0; c < var_degree; c++)
+			sum_msg_chk_to_var += msg_chk_to_var_ptr[c];
+
+		post[v] = Y_N[v] + sum_msg_chk_to_var;
+
+		msg_chk_to_var_ptr += var_degree;
+	}
+}
+}
+}
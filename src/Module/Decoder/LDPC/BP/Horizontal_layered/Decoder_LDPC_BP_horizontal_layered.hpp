@@ -8,6 +8,7 @@
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
 #include "Module/Decoder/Decoder_SISO_SIHO.hpp"
 #include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP.hpp"
+#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP_chk_kernels.hpp"
 
 namespace aff3ct
 {
@@ -21,6 +22,10 @@ protected:
 
 	Update_rule up_rule;
 
+	// check node kernel of each degree, chosen from the degree profile of H
+	using Chk_kernels = Decoder_LDPC_BP_chk_kernels<R,Update_rule>;
+	const std::vector<typename Chk_kernels::layered_t> chk_kernels;
+
 	// data structures for iterative decoding
 	std::vector<std::vector<R>> var_nodes;
 	std::vector<std::vector<R>> messages;
@@ -44,9 +49,13 @@ protected:
 	void _decode_siho   (const R *Y_N,  B *V_K,  const int frame_id);
 	void _decode_siho_cw(const R *Y_N,  B *V_N,  const int frame_id);
 
-	void _load             (const R *Y_N, const int frame_id);
-	void _decode           (const int frame_id);
-	void _decode_single_ite(std::vector<R> &var_nodes, std::vector<R> &messages);
+	        void _load             (const R *Y_N, const int frame_id);
+	virtual void _decode           (const int frame_id);
+	        void _decode_single_ite(std::vector<R> &var_nodes, std::vector<R> &messages);
+
+	// the rule and the contributions are given so that several threads can process distinct check nodes
+	inline void _decode_chk_node(Update_rule &up_rule, R *contributions, const int c, R *var_nodes, R *messages,
+	                             int &k);
 };
 }
 }
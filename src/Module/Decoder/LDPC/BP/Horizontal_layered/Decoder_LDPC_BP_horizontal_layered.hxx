@@ -22,6 +22,7 @@ Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>
   Decoder_LDPC_BP       (K, N, n_ite, _H, enable_syndrome, syndrome_depth     ),
   info_bits_pos         (info_bits_pos                                        ),
   up_rule               (up_rule                                              ),
+  chk_kernels           (Chk_kernels::get_layered_kernels(this->H)            ),
   var_nodes             (n_frames, std::vector<R>(N                          )),
   messages              (n_frames, std::vector<R>(this->H.get_n_connections())),
   contributions         (this->H.get_cols_max_degree()                        ),
@@ -146,30 +147,21 @@ template <typename B, typename R, class Update_rule>
 void Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>
 ::_decode_single_ite(std::vector<R> &var_nodes, std::vector<R> &messages)
 {
-	auto kr = 0;
-	auto kw = 0;
+	auto k = 0;
 
 	// horizontal layered scheduling
 	const auto n_chk_nodes = (int)this->H.get_n_cols();
 	for (auto c = 0; c < n_chk_nodes; c++)
-	{
-		const auto chk_degree = (int)this->H[c].size();
-		this->up_rule.begin_chk_node_in(c, chk_degree);
-		for (auto v = 0; v < chk_degree; v++)
-		{
-			this->contributions[v] = var_nodes[this->H[c][v]] - messages[kr++];
-			this->up_rule.compute_chk_node_in(v, this->contributions[v]);
-		}
-		this->up_rule.end_chk_node_in();
-
-		this->up_rule.begin_chk_node_out(c, chk_degree);
-		for (auto v = 0; v < chk_degree; v++)
-		{
-			messages[kw] = this->up_rule.compute_chk_node_out(v, this->contributions[v]);
-			var_nodes[this->H[c][v]] = this->contributions[v] + messages[kw++];
-		}
-		this->up_rule.end_chk_node_out();
-	}
+		this->_decode_chk_node(this->up_rule, this->contributions.data(), c, var_nodes.data(), messages.data(), k);
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>
+::_decode_chk_node(Update_rule &up_rule, R *contributions, const int c, R *var_nodes, R *messages, int &k)
+{
+	const auto chk_degree = (int)this->H[c].size();
+	this->chk_kernels[chk_degree](up_rule, Chk_out_identity(), contributions, c, this->H[c].data(), chk_degree,
+	                              var_nodes, messages, k);
+}
 }
 }
-}
\ No newline at end of file
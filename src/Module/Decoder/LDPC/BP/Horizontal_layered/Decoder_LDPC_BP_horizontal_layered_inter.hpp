@@ -9,11 +9,21 @@
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
 #include "Module/Decoder/Decoder_SISO_SIHO.hpp"
 #include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP.hpp"
+#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP_chk_kernels.hpp"
 
 namespace aff3ct
 {
 namespace module
 {
+// saturates the outputs of the check nodes (fixed-point)
+template <typename R>
+struct Chk_out_saturate
+{
+	const R sat_val;
+	explicit Chk_out_saturate(const R sat_val) : sat_val(sat_val) {}
+	inline mipp::Reg<R> operator()(const mipp::Reg<R> &v) const;
+};
+
 template <typename B = int, typename R = float, class Update_rule = tools::Update_rule_NMS_simd<R>>
 class Decoder_LDPC_BP_horizontal_layered_inter : public Decoder_SISO_SIHO<B,R>, public Decoder_LDPC_BP
 {
@@ -24,6 +34,11 @@ protected:
 
 	const R sat_val;
 
+	// check node kernel of each degree, chosen from the degree profile of H
+	using Chk_kernels = Decoder_LDPC_BP_chk_kernels<mipp::Reg<R>,Update_rule,Chk_out_saturate<R>>;
+	const Chk_out_saturate<R> chk_out;
+	const std::vector<typename Chk_kernels::layered_t> chk_kernels;
+
 	// data structures for iterative decoding
 	std::vector<mipp::vector<mipp::Reg<R>>> var_nodes;
 	std::vector<mipp::vector<mipp::Reg<R>>> messages;
@@ -31,6 +31,13 @@ inline mipp::Reg<int8_t> saturate(const mipp::Reg<int8_t> v, const int8_t s)
 	return mipp::sat(v, (int8_t)-s, (int8_t)+s);
 }
 
+template <typename R>
+mipp::Reg<R> Chk_out_saturate<R>
+::operator()(const mipp::Reg<R> &v) const
+{
+	return saturate<R>(v, this->sat_val);
+}
+
 template <typename B, typename R, class Update_rule>
 Decoder_LDPC_BP_horizontal_layered_inter<B,R,Update_rule>
 ::Decoder_LDPC_BP_horizontal_layered_inter(const int K, const int N, const int n_ite,
@@ -46,6 +53,8 @@ Decoder_LDPC_BP_horizontal_layered_inter<B,R,Update_rule>
   info_bits_pos         (info_bits_pos                                                                      ),
   up_rule               (up_rule                                                                            ),
   sat_val               ((R)((1 << ((sizeof(R) * 8 -2) - (int)std::log2(this->H.get_rows_max_degree()))) -1)),
+  chk_out               (this->sat_val                                                                      ),
+  chk_kernels           (Chk_kernels::get_layered_kernels(this->H)                                          ),
   var_nodes             (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(N)                                   ),
   messages              (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(this->H.get_n_connections())         ),
   contributions         (this->H.get_cols_max_degree()                                                      ),
@@ -198,29 +207,15 @@ template <typename B, typename R, class Update_rule>
 void Decoder_LDPC_BP_horizontal_layered_inter<B,R,Update_rule>
 ::_decode_single_ite(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &messages)
 {
-	auto kr = 0;
-	auto kw = 0;
+	auto k = 0;
 
 	// horizontal layered scheduling
 	const auto n_chk_nodes = (int)this->H.get_n_cols();
 	for (auto c = 0; c < n_chk_nodes; c++)
 	{
 		const auto chk_degree = (int)this->H[c].size();
-		this->up_rule.begin_chk_node_in(c, chk_degree);
-		for (auto v = 0; v < chk_degree; v++)
-		{
-			this->contributions[v] = var_nodes[this->H[c][v]] - messages[kr++];
-			this->up_rule.compute_chk_node_in(v, this->contributions[v]);
-		}
-		this->up_rule.end_chk_node_in();
-
-		this->up_rule.begin_chk_node_out(c, chk_degree);
-		for (auto v = 0; v < chk_degree; v++)
-		{
-			messages[kw] = saturate<R>(this->up_rule.compute_chk_node_out(v, this->contributions[v]), this->sat_val);
-			var_nodes[this->H[c][v]] = this->contributions[v] + messages[kw++];
-		}
-		this->up_rule.end_chk_node_out();
+		this->chk_kernels[chk_degree](this->up_rule, this->chk_out, this->contributions.data(), c, this->H[c].data(),
+		                              chk_degree, var_nodes.data(), messages.data(), k);
 	}
 }
 
@@ -0,0 +1,63 @@
+#ifndef DECODER_LDPC_BP_HORIZONTAL_LAYERED_THREADS_HPP_
+#define DECODER_LDPC_BP_HORIZONTAL_LAYERED_THREADS_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Thread_team/Thread_team.hpp"
+#include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \brief Horizontal layered BP decoder that splits the decoding of a single frame over a team of threads.
+ *
+ * The check nodes are reordered by a greedy coloring of H: the check nodes of a color (a layer) do not share any
+ * variable node, so they are updated concurrently by the threads and the layers are separated by spin barriers.
+ */
+template <typename B = int, typename R = float, class Update_rule = tools::Update_rule_SPA<R>>
+class Decoder_LDPC_BP_horizontal_layered_threads : public Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>
+{
+protected:
+	tools::Thread_team team;
+
+	// the state of the update rule and the contributions are private to each thread
+	std::vector<Update_rule   > up_rules;
+	std::vector<std::vector<R>> contributions_th;
+
+	std::vector<uint32_t> msg_offsets; // offset of the first message of each check node
+	std::vector<uint32_t> layers;      // first check node of each layer (+ the number of check nodes)
+	std::vector<uint32_t> layer_parts; // check nodes of each thread in each layer ('n_threads' +1 bounds per layer)
+	std::vector<uint32_t> synd_parts;  // check nodes verified by each thread in the syndrome
+	std::vector<uint8_t > synd_valid;  // partial syndrome of each thread
+
+public:
+	Decoder_LDPC_BP_horizontal_layered_threads(const int K, const int N, const int n_ite,
+	                                           const tools::Sparse_matrix &H,
+	                                           const std::vector<unsigned> &info_bits_pos,
+	                                           const Update_rule &up_rule,
+	                                           const int n_threads,
+	                                           const bool enable_syndrome = true,
+	                                           const int syndrome_depth = 1,
+	                                           const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_horizontal_layered_threads() = default;
+
+	size_t get_n_layers() const;
+
+protected:
+	void _decode(const int frame_id);
+
+private:
+	static tools::Sparse_matrix reorder_per_color(const tools::Sparse_matrix &H);
+};
+}
+}
+
+#include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered_threads.hxx"
+
+#endif /* DECODER_LDPC_BP_HORIZONTAL_LAYERED_THREADS_HPP_ */
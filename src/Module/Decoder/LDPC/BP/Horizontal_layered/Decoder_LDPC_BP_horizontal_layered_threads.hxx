@@ -0,0 +1,175 @@
+#include <string>
+#include <algorithm>
+
+#include "Tools/Code/LDPC/Syndrome/LDPC_syndrome.hpp"
+#include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered_threads.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class Update_rule>
+Decoder_LDPC_BP_horizontal_layered_threads<B,R,Update_rule>
+::Decoder_LDPC_BP_horizontal_layered_threads(const int K, const int N, const int n_ite,
+                                             const tools::Sparse_matrix &_H,
+                                             const std::vector<unsigned> &info_bits_pos,
+                                             const Update_rule &up_rule,
+                                             const int n_threads,
+                                             const bool enable_syndrome,
+                                             const int syndrome_depth,
+                                             const int n_frames)
+: Decoder(K, N, n_frames, 1),
+  Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>(K, N, n_ite, reorder_per_color(_H), info_bits_pos, up_rule,
+                                                      enable_syndrome, syndrome_depth, n_frames),
+  team            ((size_t)std::max(n_threads, 0)                          ),
+  up_rules        (n_threads, up_rule                                      ),
+  contributions_th(n_threads, std::vector<R>(this->H.get_cols_max_degree())),
+  msg_offsets     (this->H.get_n_cols() +1, 0                              ),
+  synd_valid      (n_threads, 0                                            )
+{
+	const std::string name = "Decoder_LDPC_BP_horizontal_layered_threads<" + this->up_rule.get_name() + ">";
+	this->set_name(name);
+
+	const auto n_chk_nodes = (int)this->H.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+		this->msg_offsets[c +1] = this->msg_offsets[c] + (uint32_t)this->H[c].size();
+
+	// the check nodes are sorted per color: a new layer starts at the first check node that shares a variable node
+	// with the current layer
+	std::vector<uint32_t> var_layer(this->H.get_n_rows(), 0);
+	uint32_t cur_layer = 1;
+	for (auto c = 0; c < n_chk_nodes; c++)
+	{
+		const auto conflict = std::any_of(this->H[c].begin(), this->H[c].end(),
+		                                  [&](const uint32_t v) { return var_layer[v] == cur_layer; });
+		if (conflict || c == 0)
+		{
+			this->layers.push_back((uint32_t)c);
+			cur_layer += conflict ? 1 : 0;
+		}
+
+		for (auto v : this->H[c])
+			var_layer[v] = cur_layer;
+	}
+	this->layers.push_back((uint32_t)n_chk_nodes);
+
+	const auto &chk_to_var = this->H.get_col_to_rows();
+	for (size_t l = 0; l < this->get_n_layers(); l++)
+	{
+		const auto parts = tools::Thread_team::split(chk_to_var, this->layers[l], this->layers[l +1], n_threads);
+		this->layer_parts.insert(this->layer_parts.end(), parts.begin(), parts.end());
+	}
+	this->synd_parts = tools::Thread_team::split(chk_to_var, 0, n_chk_nodes, n_threads);
+}
+
+template <typename B, typename R, class Update_rule>
+size_t Decoder_LDPC_BP_horizontal_layered_threads<B,R,Update_rule>
+::get_n_layers() const
+{
+	return this->layers.size() -1;
+}
+
+template <typename B, typename R, class Update_rule>
+tools::Sparse_matrix Decoder_LDPC_BP_horizontal_layered_threads<B,R,Update_rule>
+::reorder_per_color(const tools::Sparse_matrix &_H)
+{
+	const auto H = _H.turn(tools::Sparse_matrix::Way::VERTICAL);
+	const auto n_chk_nodes = (int)H.get_n_cols();
+
+	// greedy coloring: each check node takes the first color not used by the check nodes it shares a variable with
+	std::vector<int> colors(n_chk_nodes, -1);
+	std::vector<int> used_by; // last check node that marked each color as used
+	auto n_colors = 0;
+	for (auto c = 0; c < n_chk_nodes; c++)
+	{
+		for (auto v : H[c])
+			for (auto c2 : H.get_cols_from_row(v))
+				if (colors[c2] >= 0)
+					used_by[colors[c2]] = c;
+
+		auto color = 0;
+		while (color < n_colors && used_by[color] == c)
+			color++;
+
+		if (color == n_colors)
+		{
+			used_by.push_back(-1);
+			n_colors++;
+		}
+		colors[c] = color;
+	}
+
+	// stable sort of the check nodes per color
+	std::vector<int> order(n_chk_nodes);
+	for (auto c = 0; c < n_chk_nodes; c++)
+		order[c] = c;
+	std::stable_sort(order.begin(), order.end(), [&](const int c1, const int c2) { return colors[c1] < colors[c2]; });
+
+	tools::Sparse_matrix H_colored(H.get_n_rows(), H.get_n_cols());
+	for (auto c = 0; c < n_chk_nodes; c++)
+		for (auto v : H[order[c]])
+			H_colored.add_connection(v, c);
+
+	return H_colored;
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_horizontal_layered_threads<B,R,Update_rule>
+::_decode(const int frame_id)
+{
+	const auto n_threads = this->team.get_n_threads();
+	const auto n_layers  = this->get_n_layers();
+	const auto cur_depth = this->cur_syndrome_depth;
+	auto new_depth = cur_depth;
+
+	this->team.run([&](const size_t tid)
+	{
+		auto &up_rule       = this->up_rules[tid];
+		auto *contributions = this->contributions_th[tid].data();
+		auto *var_nodes     = this->var_nodes[frame_id].data();
+		auto *messages      = this->messages [frame_id].data();
+		auto depth = cur_depth;
+
+		up_rule.begin_decoding(this->n_ite);
+
+		for (auto ite = 0; ite < this->n_ite; ite++)
+		{
+			up_rule.begin_ite(ite);
+			for (size_t l = 0; l < n_layers; l++)
+			{
+				const auto first = (int)this->layer_parts[l * (n_threads +1) + tid    ];
+				const auto last  = (int)this->layer_parts[l * (n_threads +1) + tid +1];
+
+				auto k = (int)this->msg_offsets[first];
+				for (auto c = first; c < last; c++)
+					this->_decode_chk_node(up_rule, contributions, c, var_nodes, messages, k);
+
+				this->team.barrier(tid);
+			}
+			up_rule.end_ite();
+
+			if (this->enable_syndrome)
+			{
+				this->synd_valid[tid] = tools::LDPC_syndrome::check_soft(var_nodes, this->H, this->synd_parts[tid],
+				                                                         this->synd_parts[tid +1]);
+				this->team.barrier(tid);
+
+				// all the threads take the same decision
+				const auto syndrome = std::all_of(this->synd_valid.begin(), this->synd_valid.end(),
+				                                  [](const uint8_t s) { return s != 0; });
+				depth = syndrome ? (depth +1) % this->syndrome_depth : 0;
+				if (syndrome && depth == 0)
+					break;
+			}
+		}
+
+		up_rule.end_decoding();
+
+		if (tid == 0)
+			new_depth = depth;
+	});
+
+	this->cur_syndrome_depth = new_depth;
+}
+}
+}
@@ -0,0 +1,78 @@
+#ifndef DECODER_LDPC_BP_RESIDUAL_HPP_
+#define DECODER_LDPC_BP_RESIDUAL_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/Bucket_queue.hpp"
+#include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \brief BP decoder with informed dynamic scheduling (node-wise residual BP with lazy residuals).
+ *
+ * The check nodes with the largest residuals are updated first. The exact residual (the change of the outgoing
+ * messages if the check node was updated now) would require to recompute all the check nodes that share a variable
+ * node with the updated one. Instead, the priority of a check node is a heuristic estimate of its residual: the largest
+ * change of one of its incoming values since its last update (not a bound, several inputs may have changed), so the
+ * messages are only computed when the check node is selected.
+ *
+ * To avoid the greediness of the plain residual scheduling (a few check nodes updated again and again), the queue is
+ * built at the beginning of each iteration and is not modified during the iteration: each check node is updated at
+ * most once per iteration and its priority changes are taken into account at the next iteration. The check nodes
+ * whose incoming values did not change are not updated. At the beginning of the decoding, all the check nodes have
+ * the highest priority: the first iteration is a layered iteration.
+ *
+ * A selected check node is updated by the degree-specialized kernel of the horizontal layered decoder.
+ *
+ * The syndrome is updated after each check node update (when a hard decision flips), so the decoding stops as soon
+ * as the codeword is valid instead of at the end of the iteration.
+ */
+template <typename B = int, typename R = float, class Update_rule = tools::Update_rule_SPA<R>>
+class Decoder_LDPC_BP_residual : public Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>
+{
+protected:
+	static constexpr int n_buckets = 64; // the residuals are quantized per power of 2
+
+	std::vector<uint32_t> msg_offsets; // offset of the first message of each check node
+	std::vector<uint32_t> var_offsets; // offset of the first check node of each variable node in 'var_chk_ids'
+	std::vector<uint32_t> var_chk_ids; // check nodes of each variable node
+	std::vector<R       > prev_msgs;   // outgoing messages of the updated check node before its update
+	std::vector<R       > prev_vars;   // variable nodes of the updated check node before its update
+	std::vector<uint8_t > chk_parity;  // 1 if the check node is not satisfied by the hard decisions
+	int                   n_unsat_chk; // number of check nodes not satisfied by the hard decisions
+	std::vector<int     > chk_bucket;  // priority of each check node since its last update (-1 if none)
+	tools::Bucket_queue   queue;       // check nodes ordered by priority (estimate of the residual)
+
+public:
+	Decoder_LDPC_BP_residual(const int K, const int N, const int n_ite,
+	                         const tools::Sparse_matrix &H,
+	                         const std::vector<unsigned> &info_bits_pos,
+	                         const Update_rule &up_rule,
+	                         const bool enable_syndrome = true,
+	                         const int syndrome_depth = 1,
+	                         const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_residual() = default;
+
+protected:
+	void _decode(const int frame_id);
+
+	void _update_chk_node(const int c, R *var_nodes, R *messages);
+
+	void _init_syndrome(const R *var_nodes);
+
+	bool _check_syndrome();
+
+	static inline int _get_bucket(const float residual);
+};
+}
+}
+
+#include "Module/Decoder/LDPC/BP/Residual/Decoder_LDPC_BP_residual.hxx"
+
+#endif /* DECODER_LDPC_BP_RESIDUAL_HPP_ */
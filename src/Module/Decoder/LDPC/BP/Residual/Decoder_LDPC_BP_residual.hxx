@@ -0,0 +1,198 @@
+#include <string>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#include "Module/Decoder/LDPC/BP/Residual/Decoder_LDPC_BP_residual.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class Update_rule>
+Decoder_LDPC_BP_residual<B,R,Update_rule>
+::Decoder_LDPC_BP_residual(const int K, const int N, const int n_ite,
+                           const tools::Sparse_matrix &_H,
+                           const std::vector<unsigned> &info_bits_pos,
+                           const Update_rule &up_rule,
+                           const bool enable_syndrome,
+                           const int syndrome_depth,
+                           const int n_frames)
+: Decoder(K, N, n_frames, 1),
+  Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>(K, N, n_ite, _H, info_bits_pos, up_rule, enable_syndrome,
+                                                      syndrome_depth, n_frames),
+  msg_offsets(this->H.get_n_cols() +1, 0     ),
+  var_offsets(this->H.get_n_rows() +1, 0     ),
+  var_chk_ids(this->H.get_n_connections()    ),
+  prev_msgs  (this->H.get_cols_max_degree()  ),
+  prev_vars  (this->H.get_cols_max_degree()  ),
+  chk_parity (this->H.get_n_cols(), 0        ),
+  n_unsat_chk(0                              ),
+  chk_bucket (this->H.get_n_cols(), -1       ),
+  queue      (this->H.get_n_cols(), n_buckets)
+{
+	const std::string name = "Decoder_LDPC_BP_residual<" + this->up_rule.get_name() + ">";
+	this->set_name(name);
+
+	const auto n_chk_nodes = (int)this->H.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+		this->msg_offsets[c +1] = this->msg_offsets[c] + (uint32_t)this->H[c].size();
+
+	// flat copy of the check nodes of each variable node, they are read after each check node update
+	const auto n_var_nodes = (int)this->H.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		const auto &chks = this->H.get_cols_from_row(v);
+		this->var_offsets[v +1] = this->var_offsets[v] + (uint32_t)chks.size();
+		std::copy(chks.begin(), chks.end(), this->var_chk_ids.begin() + this->var_offsets[v]);
+	}
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_residual<B,R,Update_rule>
+::_decode(const int frame_id)
+{
+	auto *var_nodes = this->var_nodes[frame_id].data();
+	auto *messages  = this->messages [frame_id].data();
+
+	this->up_rule.begin_decoding(this->n_ite);
+
+	// all the check nodes are updated in the first iteration
+	const auto n_chk_nodes = (int)this->H.get_n_cols();
+	this->queue.clear();
+	for (auto c = n_chk_nodes -1; c >= 0; c--)
+		this->queue.update((uint32_t)c, n_buckets -1);
+
+	std::fill(this->chk_bucket.begin(), this->chk_bucket.end(), -1);
+
+	if (this->enable_syndrome)
+		this->_init_syndrome(var_nodes);
+
+	// with a syndrome depth of 1, stop at the first check node update that satisfies all the check nodes
+	const auto early_stop = this->enable_syndrome && this->syndrome_depth == 1;
+
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		this->up_rule.begin_ite(ite);
+		// the queue is not modified during the iteration: each check node is updated at most once per iteration
+		while (!this->queue.empty())
+		{
+			this->_update_chk_node((int)this->queue.pop(), var_nodes, messages);
+			if (early_stop && this->n_unsat_chk == 0)
+				break;
+		}
+		this->up_rule.end_ite();
+
+		if (this->_check_syndrome())
+			break;
+
+		// the check nodes whose incoming values changed since their last update enter the queue for the next iteration
+		for (auto c = n_chk_nodes -1; c >= 0; c--)
+			if (this->chk_bucket[c] >= 0)
+				this->queue.update((uint32_t)c, this->chk_bucket[c]);
+
+		// no message would change anymore
+		if (this->queue.empty())
+			break;
+	}
+
+	this->up_rule.end_decoding();
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_residual<B,R,Update_rule>
+::_update_chk_node(const int c, R *var_nodes, R *messages)
+{
+	const auto *var_ids    = this->H[c].data();
+	const auto  chk_degree = (int)this->H[c].size();
+	const auto  k          = (int)this->msg_offsets[c];
+	auto       *prev_msgs  = this->prev_msgs.data();
+	auto       *prev_vars  = this->prev_vars.data();
+
+	// the previous values are saved so that the check node can be updated by the layered kernel of its degree
+	for (auto v = 0; v < chk_degree; v++)
+	{
+		prev_msgs[v] = messages [k + v];
+		prev_vars[v] = var_nodes[var_ids[v]];
+	}
+
+	auto k_end = k;
+	this->_decode_chk_node(this->up_rule, this->contributions.data(), c, var_nodes, messages, k_end);
+
+	// the parities and the priorities of the check nodes of each changed variable node are updated in a single pass
+	for (auto v = 0; v < chk_degree; v++)
+	{
+		const auto var_id = var_ids[v];
+		const auto var    = var_nodes[var_id];
+		const auto delta  = std::abs((float)messages[k + v] - (float)prev_msgs[v]);
+
+		// the hard decision of the variable node flipped: all its check nodes change of parity
+		const auto flip = this->enable_syndrome && ((var < 0) != (prev_vars[v] < 0));
+		if (!flip && !(delta > 0.f))
+			continue;
+
+		// the incoming value of the other check nodes of the variable node has changed by 'delta': their priority is
+		// the largest change since their last update (no branch per check node, the queue is built at the end of the
+		// iteration)
+		const auto bucket = delta > 0.f ? _get_bucket(delta) : -1;
+		const auto first  = this->var_chk_ids.data() + this->var_offsets[var_id   ];
+		const auto last   = this->var_chk_ids.data() + this->var_offsets[var_id +1];
+		for (auto chk = first; chk < last; chk++)
+		{
+			if (flip)
+			{
+				this->chk_parity[*chk] ^= 1;
+				this->n_unsat_chk += this->chk_parity[*chk] ? 1 : -1;
+			}
+			this->chk_bucket[*chk] = std::max(this->chk_bucket[*chk], bucket);
+		}
+	}
+
+	// the inputs of the updated check node did not change
+	this->chk_bucket[c] = -1;
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_residual<B,R,Update_rule>
+::_init_syndrome(const R *var_nodes)
+{
+	this->n_unsat_chk = 0;
+	const auto n_chk_nodes = (int)this->H.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+	{
+		uint8_t parity = 0;
+		for (auto v : this->H[c])
+			parity ^= var_nodes[v] < 0 ? 1 : 0;
+
+		this->chk_parity[c] = parity;
+		this->n_unsat_chk += parity;
+	}
+}
+
+template <typename B, typename R, class Update_rule>
+bool Decoder_LDPC_BP_residual<B,R,Update_rule>
+::_check_syndrome()
+{
+	// same as 'check_syndrome_soft' but the syndrome is already known
+	if (this->enable_syndrome)
+	{
+		const auto syndrome = this->n_unsat_chk == 0;
+		this->cur_syndrome_depth = syndrome ? (this->cur_syndrome_depth +1) % this->syndrome_depth : 0;
+		return syndrome && (this->cur_syndrome_depth == 0);
+	}
+	else
+		return false;
+}
+
+template <typename B, typename R, class Update_rule>
+int Decoder_LDPC_BP_residual<B,R,Update_rule>
+::_get_bucket(const float residual)
+{
+	// binary exponent of the residual (cheaper than 'std::ilogb', 0 and +inf fall in the first and the last buckets)
+	uint32_t bits;
+	std::memcpy(&bits, &residual, sizeof(bits));
+	const auto bucket = (int)(bits >> 23) - 127 + n_buckets / 2;
+	return std::min(std::max(bucket, 0), n_buckets -1);
+}
+}
+}
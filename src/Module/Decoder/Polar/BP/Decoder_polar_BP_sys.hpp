@@ -0,0 +1,65 @@
+#ifndef DECODER_POLAR_BP_SYS_HPP_
+#define DECODER_POLAR_BP_SYS_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Code/Polar/Frozenbits_notifier.hpp"
+#include "Module/Decoder/Decoder_SISO_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_BP_sys
+ *
+ * \brief Belief Propagation (BP) decoder on the factor graph of the polar code (min-sum processing elements).
+ *
+ * The stage 0 is on the side of the u bits (the frozen bits are known) and the stage m is on the side of the
+ * channel. The left (l) messages go from the channel to the u bits and the right (r) messages go from the u bits to
+ * the channel. The schedule of the processing elements is given by the sub-classes. The decoding stops as soon as
+ * the hard decisions on the u bits, once encoded, give the hard decisions on the codeword.
+ * The LLRs are stored element by element with the frames of the SIMD inter-frame level interleaved.
+ */
+template <typename B = int, typename R = float>
+class Decoder_polar_BP_sys : public Decoder_SISO_SIHO<B,R>, public tools::Frozenbits_notifier
+{
+protected:
+	const int m;        // coded bits log-length
+	const int max_iter;
+
+	const std::vector<bool>& frozen_bits;
+
+	std::vector<mipp::vector<R>> l;     // left messages  (m+1 stages)
+	std::vector<mipp::vector<R>> r;     // right messages (m+1 stages)
+	mipp::vector<B>              u_hat; // hard decisions on the u bits
+	mipp::vector<B>              x_hat; // hard decisions on the codeword bits
+
+public:
+	Decoder_polar_BP_sys(const int &K, const int &N, const int &max_iter, const std::vector<bool> &frozen_bits,
+	                     const int n_frames = 1);
+	virtual ~Decoder_polar_BP_sys() = default;
+
+protected:
+	void _decode_siso   (const R *Y_N1, R *Y_N2, const int frame_id);
+	void _decode_siho   (const R *Y_N,  B *V_K,  const int frame_id);
+	void _decode_siho_cw(const R *Y_N,  B *V_N,  const int frame_id);
+
+	virtual void _load       (const R *Y_N);
+	        void _decode     (             );
+	virtual void _decode_ite (             ) = 0;
+	        bool _early_stop (             );
+	        void _store      (B *V_KN, const bool coded = false) const;
+
+	// processing elements of the stage 's': from (l[s+1], r[s]) to l[s] or to r[s+1]
+	void _update_l(const int s, const R *l_in, const R *r_in, R *l_out);
+	void _update_r(const int s, const R *l_in, const R *r_in, R *r_out);
+};
+}
+}
+
+#include "Module/Decoder/Polar/BP/Decoder_polar_BP_sys.hxx"
+
+#endif /* DECODER_POLAR_BP_SYS_HPP_ */
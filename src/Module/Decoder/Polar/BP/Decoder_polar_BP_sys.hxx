@@ -0,0 +1,212 @@
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <cmath>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/utils.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Module/Decoder/Polar/BP/Decoder_polar_BP_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R>
+Decoder_polar_BP_sys<B,R>
+::Decoder_polar_BP_sys(const int &K, const int &N, const int &max_iter, const std::vector<bool> &frozen_bits,
+                       const int n_frames)
+: Decoder               (K, N, n_frames, 1),
+  Decoder_SISO_SIHO<B,R>(K, N, n_frames, 1),
+  m                     ((int)std::log2(N)),
+  max_iter              (max_iter),
+  frozen_bits           (frozen_bits),
+  l                     (this->m +1, mipp::vector<R>(N * this->simd_inter_frame_level)),
+  r                     (this->m +1, mipp::vector<R>(N * this->simd_inter_frame_level)),
+  u_hat                 (N * this->simd_inter_frame_level),
+  x_hat                 (N * this->simd_inter_frame_level)
+{
+	const std::string name = "Decoder_polar_BP_sys";
+	this->set_name(name);
+
+	static_assert(sizeof(B) == sizeof(R), "");
+
+	if (!tools::is_power_of_2(this->N))
+	{
+		std::stringstream message;
+		message << "'N' has to be a power of 2 ('N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->N != (int)frozen_bits.size())
+	{
+		std::stringstream message;
+		message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+		        << ", 'N' = " << N << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto k = 0; for (auto i = 0; i < this->N; i++) if (frozen_bits[i] == 0) k++;
+	if (this->K != k)
+	{
+		std::stringstream message;
+		message << "The number of information bits in the frozen_bits is invalid ('K' = " << K << ", 'k' = "
+		        << k << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (max_iter <= 0)
+	{
+		std::stringstream message;
+		message << "'max_iter' has to be greater than 0 ('max_iter' = " << max_iter << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R>
+void Decoder_polar_BP_sys<B,R>
+::_load(const R *Y_N)
+{
+	const auto n_frames = this->simd_inter_frame_level;
+
+	if (n_frames == 1)
+		std::copy(Y_N, Y_N + this->N, this->l[this->m].begin());
+	else
+	{
+		std::vector<const R*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++) frames[f] = Y_N + f * this->N;
+		tools::Reorderer<R>::apply(frames, this->l[this->m].data(), this->N);
+	}
+
+	for (auto s = 0; s < this->m; s++)
+		std::fill(this->l[s].begin(), this->l[s].end(), (R)0);
+	for (auto s = 1; s <= this->m; s++)
+		std::fill(this->r[s].begin(), this->r[s].end(), (R)0);
+	for (auto i = 0; i < this->N; i++)
+		std::fill(this->r[0].begin() + (i +0) * n_frames,
+		          this->r[0].begin() + (i +1) * n_frames,
+		          this->frozen_bits[i] ? tools::sat_val<R>() : (R)0);
+}
+
+template <typename B, typename R>
+void Decoder_polar_BP_sys<B,R>
+::_decode()
+{
+	for (auto ite = 0; ite < this->max_iter; ite++)
+	{
+		this->_decode_ite();
+		if (this->_early_stop())
+			break;
+	}
+}
+
+template <typename B, typename R>
+bool Decoder_polar_BP_sys<B,R>
+::_early_stop()
+{
+	const auto n_vals = this->N * this->simd_inter_frame_level;
+
+	for (auto i = 0; i < n_vals; i++)
+	{
+		this->u_hat[i] = (B)(tools::v_LLR(this->l[     0][i], this->r[     0][i]) < 0);
+		this->x_hat[i] = (B)(tools::v_LLR(this->l[this->m][i], this->r[this->m][i]) < 0);
+	}
+
+	// encode the u bits in place (the stages of the polar transform can be applied in any order)
+	for (auto s = 0; s < this->m; s++)
+	{
+		const auto n_half = (1 << s) * this->simd_inter_frame_level;
+		for (auto j = 0; j < n_vals; j += 2 * n_half)
+			for (auto i = 0; i < n_half; i++)
+				this->u_hat[j + i] ^= this->u_hat[j + n_half + i];
+	}
+
+	return std::equal(this->u_hat.begin(), this->u_hat.end(), this->x_hat.begin());
+}
+
+template <typename B, typename R>
+void Decoder_polar_BP_sys<B,R>
+::_update_l(const int s, const R *l_in, const R *r_in, R *l_out)
+{
+	const auto n_half = (1 << s) * this->simd_inter_frame_level;
+	const auto n_vals = this->N * this->simd_inter_frame_level;
+
+	for (auto j = 0; j < n_vals; j += 2 * n_half)
+	{
+		const auto a = j, b = j + n_half;
+		tools::fv_LLR(l_in + a, l_in + b, r_in + b, l_out + a, n_half);
+		tools::vf_LLR(l_in + b, r_in + a, l_in + a, l_out + b, n_half);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_polar_BP_sys<B,R>
+::_update_r(const int s, const R *l_in, const R *r_in, R *r_out)
+{
+	const auto n_half = (1 << s) * this->simd_inter_frame_level;
+	const auto n_vals = this->N * this->simd_inter_frame_level;
+
+	for (auto j = 0; j < n_vals; j += 2 * n_half)
+	{
+		const auto a = j, b = j + n_half;
+		tools::fv_LLR(r_in + a, l_in + b, r_in + b, r_out + a, n_half);
+		tools::vf_LLR(r_in + b, r_in + a, l_in + a, r_out + b, n_half);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_polar_BP_sys<B,R>
+::_decode_siso(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	this->_load(Y_N1);
+	this->_decode();
+
+	const auto n_frames = this->simd_inter_frame_level;
+	if (n_frames == 1)
+		std::copy(this->r[this->m].begin(), this->r[this->m].begin() + this->N, Y_N2);
+	else
+	{
+		std::vector<R*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++) frames[f] = Y_N2 + f * this->N;
+		tools::Reorderer<R>::apply_rev(this->r[this->m].data(), frames, this->N);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_polar_BP_sys<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_load(Y_N);
+	this->_decode();
+	this->_store(V_K);
+}
+
+template <typename B, typename R>
+void Decoder_polar_BP_sys<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	this->_load(Y_N);
+	this->_decode();
+	this->_store(V_N, true);
+}
+
+template <typename B, typename R>
+void Decoder_polar_BP_sys<B,R>
+::_store(B *V_KN, const bool coded) const
+{
+	const auto n_frames = this->simd_inter_frame_level;
+
+	for (auto f = 0; f < n_frames; f++)
+		if (!coded)
+		{
+			auto k = 0;
+			for (auto i = 0; i < this->N; i++)
+				if (!this->frozen_bits[i]) // the information bits are the systematic bits
+					V_KN[f * this->K + k++] = this->x_hat[i * n_frames + f];
+		}
+		else
+			for (auto i = 0; i < this->N; i++)
+				V_KN[f * this->N + i] = this->x_hat[i * n_frames + f];
+}
+}
+}
@@ -0,0 +1,21 @@
+#include <string>
+#include <mipp.h>
+
+#include "Module/Decoder/Polar/BP/Flooding/Decoder_polar_BP_flooding_inter_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R>
+Decoder_polar_BP_flooding_inter_sys<B,R>
+::Decoder_polar_BP_flooding_inter_sys(const int &K, const int &N, const int &max_iter,
+                                      const std::vector<bool> &frozen_bits, const int n_frames)
+: Decoder                           (K, N, n_frames, mipp::nElReg<R>()),
+  Decoder_polar_BP_flooding_sys<B,R>(K, N, max_iter, frozen_bits, n_frames)
+{
+	const std::string name = "Decoder_polar_BP_flooding_inter_sys";
+	this->set_name(name);
+}
+}
+}
@@ -0,0 +1,40 @@
+#ifndef DECODER_POLAR_BP_FLOODING_SYS_HPP_
+#define DECODER_POLAR_BP_FLOODING_SYS_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Module/Decoder/Polar/BP/Decoder_polar_BP_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_BP_flooding_sys
+ *
+ * \brief Polar BP decoder with a flooding schedule: all the processing elements of all the stages are updated at
+ *        each iteration from the messages of the previous iteration.
+ */
+template <typename B = int, typename R = float>
+class Decoder_polar_BP_flooding_sys : public Decoder_polar_BP_sys<B,R>
+{
+protected:
+	std::vector<mipp::vector<R>> l_next; // left  messages of the next iteration
+	std::vector<mipp::vector<R>> r_next; // right messages of the next iteration
+
+public:
+	Decoder_polar_BP_flooding_sys(const int &K, const int &N, const int &max_iter,
+	                              const std::vector<bool> &frozen_bits, const int n_frames = 1);
+	virtual ~Decoder_polar_BP_flooding_sys() = default;
+
+protected:
+	void _load      (const R *Y_N);
+	void _decode_ite(            );
+};
+}
+}
+
+#include "Module/Decoder/Polar/BP/Flooding/Decoder_polar_BP_flooding_sys.hxx"
+
+#endif /* DECODER_POLAR_BP_FLOODING_SYS_HPP_ */
@@ -0,0 +1,48 @@
+#include <algorithm>
+#include <string>
+
+#include "Module/Decoder/Polar/BP/Flooding/Decoder_polar_BP_flooding_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R>
+Decoder_polar_BP_flooding_sys<B,R>
+::Decoder_polar_BP_flooding_sys(const int &K, const int &N, const int &max_iter,
+                                const std::vector<bool> &frozen_bits, const int n_frames)
+: Decoder                  (K, N, n_frames, 1),
+  Decoder_polar_BP_sys<B,R>(K, N, max_iter, frozen_bits, n_frames),
+  l_next                   (this->l),
+  r_next                   (this->r)
+{
+	const std::string name = "Decoder_polar_BP_flooding_sys";
+	this->set_name(name);
+}
+
+template <typename B, typename R>
+void Decoder_polar_BP_flooding_sys<B,R>
+::_load(const R *Y_N)
+{
+	Decoder_polar_BP_sys<B,R>::_load(Y_N);
+
+	// the channel LLRs and the frozen bits are never updated: they have to be in both the message sets
+	std::copy(this->l[this->m].begin(), this->l[this->m].end(), this->l_next[this->m].begin());
+	std::copy(this->r[      0].begin(), this->r[      0].end(), this->r_next[      0].begin());
+}
+
+template <typename B, typename R>
+void Decoder_polar_BP_flooding_sys<B,R>
+::_decode_ite()
+{
+	for (auto s = 0; s < this->m; s++)
+	{
+		this->_update_l(s, this->l[s +1].data(), this->r[s].data(), this->l_next[s   ].data());
+		this->_update_r(s, this->l[s +1].data(), this->r[s].data(), this->r_next[s +1].data());
+	}
+
+	std::swap(this->l, this->l_next);
+	std::swap(this->r, this->r_next);
+}
+}
+}
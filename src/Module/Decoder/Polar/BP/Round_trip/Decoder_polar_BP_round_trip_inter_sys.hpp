@@ -0,0 +1,31 @@
+#ifndef DECODER_POLAR_BP_ROUND_TRIP_INTER_SYS_HPP_
+#define DECODER_POLAR_BP_ROUND_TRIP_INTER_SYS_HPP_
+
+#include <vector>
+
+#include "Module/Decoder/Polar/BP/Round_trip/Decoder_polar_BP_round_trip_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_BP_round_trip_inter_sys
+ *
+ * \brief Inter-frame version of the Decoder_polar_BP_round_trip_sys: mipp::nElReg<R>() frames are decoded at
+ *        once, one per SIMD lane.
+ */
+template <typename B = int, typename R = float>
+class Decoder_polar_BP_round_trip_inter_sys : public Decoder_polar_BP_round_trip_sys<B,R>
+{
+public:
+	Decoder_polar_BP_round_trip_inter_sys(const int &K, const int &N, const int &max_iter,
+	                                      const std::vector<bool> &frozen_bits, const int n_frames = 1);
+	virtual ~Decoder_polar_BP_round_trip_inter_sys() = default;
+};
+}
+}
+
+#include "Module/Decoder/Polar/BP/Round_trip/Decoder_polar_BP_round_trip_inter_sys.hxx"
+
+#endif /* DECODER_POLAR_BP_ROUND_TRIP_INTER_SYS_HPP_ */
@@ -0,0 +1,34 @@
+#ifndef DECODER_POLAR_BP_ROUND_TRIP_SYS_HPP_
+#define DECODER_POLAR_BP_ROUND_TRIP_SYS_HPP_
+
+#include <vector>
+
+#include "Module/Decoder/Polar/BP/Decoder_polar_BP_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_BP_round_trip_sys
+ *
+ * \brief Polar BP decoder with a round-trip schedule: at each iteration the left messages are propagated stage by
+ *        stage from the channel to the u bits, then the right messages are propagated back to the channel.
+ */
+template <typename B = int, typename R = float>
+class Decoder_polar_BP_round_trip_sys : public Decoder_polar_BP_sys<B,R>
+{
+public:
+	Decoder_polar_BP_round_trip_sys(const int &K, const int &N, const int &max_iter,
+	                                const std::vector<bool> &frozen_bits, const int n_frames = 1);
+	virtual ~Decoder_polar_BP_round_trip_sys() = default;
+
+protected:
+	void _decode_ite();
+};
+}
+}
+
+#include "Module/Decoder/Polar/BP/Round_trip/Decoder_polar_BP_round_trip_sys.hxx"
+
+#endif /* DECODER_POLAR_BP_ROUND_TRIP_SYS_HPP_ */
@@ -0,0 +1,31 @@
+#include <string>
+
+#include "Module/Decoder/Polar/BP/Round_trip/Decoder_polar_BP_round_trip_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R>
+Decoder_polar_BP_round_trip_sys<B,R>
+::Decoder_polar_BP_round_trip_sys(const int &K, const int &N, const int &max_iter,
+                                  const std::vector<bool> &frozen_bits, const int n_frames)
+: Decoder                  (K, N, n_frames, 1),
+  Decoder_polar_BP_sys<B,R>(K, N, max_iter, frozen_bits, n_frames)
+{
+	const std::string name = "Decoder_polar_BP_round_trip_sys";
+	this->set_name(name);
+}
+
+template <typename B, typename R>
+void Decoder_polar_BP_round_trip_sys<B,R>
+::_decode_ite()
+{
+	for (auto s = this->m -1; s >= 0; s--)
+		this->_update_l(s, this->l[s +1].data(), this->r[s].data(), this->l[s].data());
+
+	for (auto s = 0; s < this->m; s++)
+		this->_update_r(s, this->l[s +1].data(), this->r[s].data(), this->r[s +1].data());
+}
+}
+}
@@ -409,9 +409,9 @@ void Decoder_polar_SC_fast_sys<B,R,API_polar>
 			if (!fast_deinterleave)
 			{
 				std::stringstream message;
-				message << "Inverse transposition only supports NEON, SSE4.1 and AVX2 instruction sets and the "
-				           "frame size 'N' has to be greater than 128 for NEON/SSE4.1 and greater than 256 for AVX2 "
-				           "('N' = " << this->N << "). "
+				message << "Inverse transposition only supports NEON, SSE4.1, AVX2 and AVX-512BW instruction sets and "
+				           "the frame size 'N' has to be greater than 128 for NEON/SSE4.1, greater than 256 for AVX2 "
+				           "and greater than 512 for AVX-512BW ('N' = " << this->N << "). "
 				           "To ensure the portability please do not compile with the -DAFF3CT_POLAR_BIT_PACKING "
 				           "definition.";
 				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
@@ -458,9 +458,9 @@ void Decoder_polar_SC_fast_sys<B,R,API_polar>
 			if (!fast_deinterleave)
 			{
 				std::stringstream message;
-				message << "Inverse transposition only supports NEON, SSE4.1 and AVX2 instruction sets and the "
-				           "frame size 'N' has to be greater than 128 for NEON/SSE4.1 and greater than 256 for AVX2 "
-				           "('N' = " << this->N << "). "
+				message << "Inverse transposition only supports NEON, SSE4.1, AVX2 and AVX-512BW instruction sets and "
+				           "the frame size 'N' has to be greater than 128 for NEON/SSE4.1, greater than 256 for AVX2 "
+				           "and greater than 512 for AVX-512BW ('N' = " << this->N << "). "
 				           "To ensure the portability please do not compile with the -DAFF3CT_POLAR_BIT_PACKING "
 				           "definition.";
 				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
@@ -19,7 +19,7 @@ Decoder_polar_SC_naive<B,R,F,G,H>
 ::Decoder_polar_SC_naive(const int& K, const int& N, const std::vector<bool>& frozen_bits, const int n_frames)
 : Decoder          (K, N, n_frames, 1),
   Decoder_SIHO<B,R>(K, N, n_frames, 1),
-  m((int)std::log2(N)), frozen_bits(frozen_bits), polar_tree(m +1)
+  m((int)std::log2(N)), frozen_bits(frozen_bits), lambda((m +1) * N), s((m +1) * N)
 {
 	const std::string name = "Decoder_polar_SC_naive";
 	this->set_name(name);
@@ -47,33 +47,13 @@ Decoder_polar_SC_naive<B,R,F,G,H>
 		        << k << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
-
-	this->recursive_allocate_nodes_contents(this->polar_tree.get_root(), this->N);
-	this->recursive_initialize_frozen_bits(this->polar_tree.get_root(), frozen_bits);
-}
-
-template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G, tools::proto_h<B,R> H>
-Decoder_polar_SC_naive<B,R,F,G,H>
-::~Decoder_polar_SC_naive()
-{
-	this->recursive_deallocate_nodes_contents(this->polar_tree.get_root());
-}
-
-template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G, tools::proto_h<B,R> H>
-void Decoder_polar_SC_naive<B,R,F,G,H>
-::notify_frozenbits_update()
-{
-	this->recursive_initialize_frozen_bits(this->polar_tree.get_root(), frozen_bits);
 }
 
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G, tools::proto_h<B,R> H>
 void Decoder_polar_SC_naive<B,R,F,G,H>
 ::_load(const R *Y_N)
 {
-	auto *contents = this->polar_tree.get_root()->get_contents();
-
-	for (auto i = 0; i < this->N; i++)
-		contents->lambda[i] = Y_N[i];
+	std::copy(Y_N, Y_N + this->N, this->lambda.begin());
 }
 
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G, tools::proto_h<B,R> H>
@@ -85,7 +65,7 @@ void Decoder_polar_SC_naive<B,R,F,G,H>
 //	auto d_load = std::chrono::steady_clock::now() - t_load;
 
 //	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
-	this->recursive_decode(this->polar_tree.get_root());
+	this->recursive_decode(0, this->N);
 //	auto d_decod = std::chrono::steady_clock::now() - t_decod;
 
 //	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
@@ -106,7 +86,7 @@ void Decoder_polar_SC_naive<B,R,F,G,H>
 //	auto d_load = std::chrono::steady_clock::now() - t_load;
 
 //	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
-	this->recursive_decode(this->polar_tree.get_root());
+	this->recursive_decode(0, this->N);
 //	auto d_decod = std::chrono::steady_clock::now() - t_decod;
 
 //	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
@@ -124,111 +104,50 @@ void Decoder_polar_SC_naive<B,R,F,G,H>
 {
 	if (!coded)
 	{
-		auto k = 0;
-		this->recursive_store(this->polar_tree.get_root(), V, k);
-	}
-	else
-	{
-		auto *contents_root = this->polar_tree.get_root()->get_c();
-		std::copy(contents_root->s.begin(), contents_root->s.begin() + this->N, V);
-	}
-}
-
-template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G, tools::proto_h<B,R> H>
-void Decoder_polar_SC_naive<B,R,F,G,H>
-::recursive_allocate_nodes_contents(tools::Binary_node<Contents_SC<B,R>>* node_curr, const int vector_size)
-{
-	if (node_curr != nullptr)
-	{
-		node_curr->set_contents(new Contents_SC<B,R>(vector_size));
-
-		this->recursive_allocate_nodes_contents(node_curr->get_left() , vector_size / 2);
-		this->recursive_allocate_nodes_contents(node_curr->get_right(), vector_size / 2);
-	}
-}
+		const auto off_leaves = this->m * this->N;
 
-template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G, tools::proto_h<B,R> H>
-void Decoder_polar_SC_naive<B,R,F,G,H>
-::recursive_initialize_frozen_bits(const tools::Binary_node<Contents_SC<B,R>>* node_curr,
-                                   const std::vector<bool>& frozen_bits)
-{
-	auto *contents = node_curr->get_contents();
-
-	if (!node_curr->is_leaf()) // stop condition
-	{
-		this->recursive_initialize_frozen_bits(node_curr->get_left(),  frozen_bits); // recursive call
-		this->recursive_initialize_frozen_bits(node_curr->get_right(), frozen_bits); // recursive call
+		auto k = 0;
+		for (auto i = 0; i < this->N; i++)
+			if (!frozen_bits[i])
+				V[k++] = this->s[off_leaves + i];
 	}
 	else
-		contents->is_frozen_bit = frozen_bits[node_curr->get_lane_id()];
+		std::copy(this->s.begin(), this->s.begin() + this->N, V);
 }
 
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G, tools::proto_h<B,R> H>
 void Decoder_polar_SC_naive<B,R,F,G,H>
-::recursive_decode(const tools::Binary_node<Contents_SC<B,R>>* node_curr)
+::recursive_decode(const int off, const int size)
 {
-	if (!node_curr->is_leaf()) // stop condition
+	if (size > 1) // stop condition
 	{
-		const auto size = (int)node_curr->get_c()->lambda.size();
-		const auto size_2 = size / 2;
-
-		const auto *node_left  = node_curr->get_left(); // get left node
-		const auto *node_right = node_curr->get_right(); // get right node
+		const auto size_2    = size / 2;
+		const auto off_left  = off + this->N;          // offset of the left node
+		const auto off_right = off + this->N + size_2; // offset of the right node
 
 		for (auto i = 0; i < size_2; i++)
-			node_left->get_c()->lambda[i] = F(node_curr->get_c()->lambda[        i],  // apply f()
-			                                  node_curr->get_c()->lambda[size_2 +i]);
+			this->lambda[off_left + i] = F(this->lambda[off          + i],  // apply f()
+			                               this->lambda[off + size_2 + i]);
 
-		this->recursive_decode(node_left); // recursive call
+		this->recursive_decode(off_left, size_2); // recursive call
 
 		for (auto i = 0; i < size_2; i++)
-			node_right->get_c()->lambda[i] = G(node_curr->get_c()->lambda[        i], // apply g()
-			                                   node_curr->get_c()->lambda[size_2 +i],
-			                                   node_left->get_c()->s     [        i]);
+			this->lambda[off_right + i] = G(this->lambda[off          + i], // apply g()
+			                                this->lambda[off + size_2 + i],
+			                                this->s     [off_left     + i]);
 
-		this->recursive_decode(node_right); // recursive call
+		this->recursive_decode(off_right, size_2); // recursive call
 
 		for (auto i = 0; i < size_2; i++)
-			node_curr->get_c()->s[i] = node_left ->get_c()->s[i] ^ node_right->get_c()->s[i]; // bit xor
+			this->s[off + i] = this->s[off_left + i] ^ this->s[off_right + i]; // bit xor
 
 		for (auto i = 0; i < size_2; i++)
-			node_curr->get_c()->s[size_2 +i] = node_right->get_c()->s[i]; // bit eq
+			this->s[off + size_2 + i] = this->s[off_right + i]; // bit eq
 	}
 	else // specific leaf treatment
 	{
-		node_curr->get_c()->s[0] = (!node_curr->get_c()->is_frozen_bit && // if this is a frozen bit then s == 0
-		                            H(node_curr->get_c()->lambda[0])); // apply h()
-	}
-}
-
-template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G, tools::proto_h<B,R> H>
-void Decoder_polar_SC_naive<B,R,F,G,H>
-::recursive_store(const tools::Binary_node<Contents_SC<B,R>>* node_curr, B *V_K, int &k) const
-{
-	auto *contents = node_curr->get_contents();
-
-	if (!node_curr->is_leaf()) // stop condition
-	{
-		this->recursive_store(node_curr->get_left(),  V_K, k); // recursive call
-		this->recursive_store(node_curr->get_right(), V_K, k); // recursive call
-	}
-	else
-		if (!frozen_bits[node_curr->get_lane_id()])
-			V_K[k++] = contents->s[0];
-}
-
-template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G, tools::proto_h<B,R> H>
-void Decoder_polar_SC_naive<B,R,F,G,H>
-::recursive_deallocate_nodes_contents(tools::Binary_node<Contents_SC<B,R>>* node_curr)
-{
-	if (node_curr != nullptr)
-	{
-		this->recursive_deallocate_nodes_contents(node_curr->get_left()); // recursive call
-		this->recursive_deallocate_nodes_contents(node_curr->get_right()); // recursive call
-
-		auto *contents = node_curr->get_contents();
-		delete contents;
-		node_curr->set_contents(nullptr);
+		this->s[off] = (!frozen_bits[off - this->m * this->N] && // if this is a frozen bit then s == 0
+		                H(this->lambda[off])); // apply h()
 	}
 }
 }
@@ -0,0 +1,34 @@
+#ifndef DECODER_POLAR_SCAN_FAST_INTER_SYS_HPP_
+#define DECODER_POLAR_SCAN_FAST_INTER_SYS_HPP_
+
+#include <vector>
+#include <memory>
+
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_SCAN_fast_inter_sys
+ *
+ * \brief Inter-frame version of the Decoder_polar_SCAN_fast_sys: mipp::nElReg<R>() frames are decoded at once, one per
+ *        SIMD lane.
+ */
+template <typename B = int, typename R = float>
+class Decoder_polar_SCAN_fast_inter_sys : public Decoder_polar_SCAN_fast_sys<B,R>
+{
+public:
+	Decoder_polar_SCAN_fast_inter_sys(const int &K, const int &N, const int &max_iter,
+	                                  const std::vector<bool> &frozen_bits,
+	                                  std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+	                                  const int idx_r0, const int idx_r1, const int n_frames = 1);
+	virtual ~Decoder_polar_SCAN_fast_inter_sys() = default;
+};
+}
+}
+
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_inter_sys.hxx"
+
+#endif /* DECODER_POLAR_SCAN_FAST_INTER_SYS_HPP_ */
@@ -0,0 +1,23 @@
+#include <string>
+#include <mipp.h>
+
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_inter_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R>
+Decoder_polar_SCAN_fast_inter_sys<B,R>
+::Decoder_polar_SCAN_fast_inter_sys(const int &K, const int &N, const int &max_iter,
+                                    const std::vector<bool> &frozen_bits,
+                                    std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+                                    const int idx_r0, const int idx_r1, const int n_frames)
+: Decoder                         (K, N, n_frames, mipp::nElReg<R>()),
+  Decoder_polar_SCAN_fast_sys<B,R>(K, N, max_iter, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, n_frames)
+{
+	const std::string name = "Decoder_polar_SCAN_fast_inter_sys";
+	this->set_name(name);
+}
+}
+}
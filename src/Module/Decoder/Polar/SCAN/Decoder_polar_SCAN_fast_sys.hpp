@@ -0,0 +1,72 @@
+#ifndef DECODER_POLAR_SCAN_FAST_SYS_HPP_
+#define DECODER_POLAR_SCAN_FAST_SYS_HPP_
+
+#include <vector>
+#include <memory>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Code/Polar/Frozenbits_notifier.hpp"
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+#include "Module/Decoder/Decoder_SISO_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_SCAN_fast_sys
+ *
+ * \brief Soft Cancellation (SCAN) decoder working on the pruned tree of the Pattern_polar_parser.
+ *
+ * The rate-0, rate-1, repetition and single parity check nodes directly produce their feedback (beta) messages
+ * instead of being recursively decoded, the result is the same as the one of the naive SCAN decoder (min-sum). The
+ * LLRs are stored element by element with the frames of the SIMD inter-frame level interleaved, so that the same
+ * vectorized kernels process one frame (intra-frame) or several frames (inter-frame).
+ */
+template <typename B = int, typename R = float>
+class Decoder_polar_SCAN_fast_sys : public Decoder_SISO_SIHO<B,R>, public tools::Frozenbits_notifier
+{
+protected:
+	const int m;        // coded bits log-length
+	const int max_iter;
+
+	const std::vector<bool>& frozen_bits;
+	tools::Pattern_polar_parser polar_patterns;
+
+	mipp::vector<R>              alpha; // LLRs going down the tree (one node per depth)
+	std::vector<mipp::vector<R>> beta;  // LLRs going up the tree (all the nodes of a depth)
+	mipp::vector<B>              s;     // hard decisions (codeword bits after the last iteration)
+
+public:
+	Decoder_polar_SCAN_fast_sys(const int &K, const int &N, const int &max_iter, const std::vector<bool> &frozen_bits,
+	                            std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+	                            const int idx_r0, const int idx_r1, const int n_frames = 1);
+	virtual ~Decoder_polar_SCAN_fast_sys() = default;
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	void _decode_siso   (const R *Y_N1, R *Y_N2, const int frame_id);
+	void _decode_siho   (const R *Y_N,  B *V_K,  const int frame_id);
+	void _decode_siho_cw(const R *Y_N,  B *V_N,  const int frame_id);
+
+	void _load  (const R *Y_N);
+	void _decode(               );
+	void _store (B *V_KN, const bool coded = false) const;
+
+private:
+	void recursive_decode(const int depth, const int off, int &node_id, const bool last_ite);
+
+	void rate0_node(const int depth, const int off, const int n_elmts);
+	void rate1_node(const int depth, const int off, const int n_elmts);
+	void rep_node  (const int depth, const int off, const int n_elmts);
+	void spc_node  (const int depth, const int off, const int n_elmts);
+	void decide    (const int depth, const int off, const int n_elmts);
+};
+}
+}
+
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hxx"
+
+#endif /* DECODER_POLAR_SCAN_FAST_SYS_HPP_ */
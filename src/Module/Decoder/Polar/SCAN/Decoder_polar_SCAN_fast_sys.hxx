@@ -0,0 +1,342 @@
+#include <type_traits>
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <limits>
+#include <cmath>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/utils.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R>
+Decoder_polar_SCAN_fast_sys<B,R>
+::Decoder_polar_SCAN_fast_sys(const int &K, const int &N, const int &max_iter, const std::vector<bool> &frozen_bits,
+                              std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+                              const int idx_r0, const int idx_r1, const int n_frames)
+: Decoder               (K, N, n_frames, 1),
+  Decoder_SISO_SIHO<B,R>(K, N, n_frames, 1),
+  m                     ((int)std::log2(N)),
+  max_iter              (max_iter),
+  frozen_bits           (frozen_bits),
+  polar_patterns        (N, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1),
+  alpha                 (2 * N * this->simd_inter_frame_level),
+  beta                  (this->m +1, mipp::vector<R>(N * this->simd_inter_frame_level)),
+  s                     (1 * N * this->simd_inter_frame_level)
+{
+	const std::string name = "Decoder_polar_SCAN_fast_sys";
+	this->set_name(name);
+
+	static_assert(sizeof(B) == sizeof(R), "");
+
+	if (!tools::is_power_of_2(this->N))
+	{
+		std::stringstream message;
+		message << "'N' has to be a power of 2 ('N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->N != (int)frozen_bits.size())
+	{
+		std::stringstream message;
+		message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+		        << ", 'N' = " << N << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto k = 0; for (auto i = 0; i < this->N; i++) if (frozen_bits[i] == 0) k++;
+	if (this->K != k)
+	{
+		std::stringstream message;
+		message << "The number of information bits in the frozen_bits is invalid ('K' = " << K << ", 'k' = "
+		        << k << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (max_iter <= 0)
+	{
+		std::stringstream message;
+		message << "'max_iter' has to be greater than 0 ('max_iter' = " << max_iter << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->simd_inter_frame_level != 1 && this->simd_inter_frame_level != mipp::nElReg<R>())
+	{
+		std::stringstream message;
+		message << "'simd_inter_frame_level' has to be equal to 1 or to 'mipp::nElReg<R>()' "
+		        << "('simd_inter_frame_level' = " << this->simd_inter_frame_level
+		        << ", 'mipp::nElReg<R>()' = " << mipp::nElReg<R>() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCAN_fast_sys<B,R>
+::notify_frozenbits_update()
+{
+	polar_patterns.notify_frozenbits_update();
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCAN_fast_sys<B,R>
+::_load(const R *Y_N)
+{
+	const auto n_frames = this->simd_inter_frame_level;
+
+	if (n_frames == 1)
+		std::copy(Y_N, Y_N + this->N, this->alpha.begin());
+	else
+	{
+		std::vector<const R*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++) frames[f] = Y_N + f * this->N;
+		tools::Reorderer<R>::apply(frames, this->alpha.data(), this->N);
+	}
+
+	// same initial feedback as the naive SCAN decoder: nothing is known but the frozen bits
+	for (auto d = 0; d < this->m; d++)
+		std::fill(this->beta[d].begin(), this->beta[d].end(), (R)0);
+	for (auto i = 0; i < this->N; i++)
+		std::fill(this->beta[this->m].begin() + (i +0) * n_frames,
+		          this->beta[this->m].begin() + (i +1) * n_frames,
+		          this->frozen_bits[i] ? tools::sat_val<R>() : (R)0);
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCAN_fast_sys<B,R>
+::_decode()
+{
+	for (auto ite = 0; ite < this->max_iter; ite++)
+	{
+		int first_node_id = 0;
+		this->recursive_decode(0, 0, first_node_id, ite == this->max_iter -1);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCAN_fast_sys<B,R>
+::_decode_siso(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	this->_load(Y_N1);
+	this->_decode();
+
+	const auto n_frames = this->simd_inter_frame_level;
+	if (n_frames == 1)
+		std::copy(this->beta[0].begin(), this->beta[0].begin() + this->N, Y_N2);
+	else
+	{
+		std::vector<R*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++) frames[f] = Y_N2 + f * this->N;
+		tools::Reorderer<R>::apply_rev(this->beta[0].data(), frames, this->N);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCAN_fast_sys<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_load(Y_N);
+	this->_decode();
+	this->_store(V_K);
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCAN_fast_sys<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	this->_load(Y_N);
+	this->_decode();
+	this->_store(V_N, true);
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCAN_fast_sys<B,R>
+::_store(B *V_KN, const bool coded) const
+{
+	const auto n_frames = this->simd_inter_frame_level;
+
+	for (auto f = 0; f < n_frames; f++)
+		if (!coded)
+		{
+			auto k = 0;
+			for (auto i = 0; i < this->N; i++)
+				if (!this->frozen_bits[i]) // the information bits are the systematic bits
+					V_KN[f * this->K + k++] = this->s[i * n_frames + f];
+		}
+		else
+			for (auto i = 0; i < this->N; i++)
+				V_KN[f * this->N + i] = this->s[i * n_frames + f];
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCAN_fast_sys<B,R>
+::recursive_decode(const int depth, const int off, int &node_id, const bool last_ite)
+{
+	const auto n_frames = this->simd_inter_frame_level;
+	const auto n_elmts  = this->N >> depth;
+	const auto node_type = polar_patterns.get_node_type(node_id);
+
+	switch (node_type)
+	{
+		case tools::polar_node_t::RATE_0: this->rate0_node(depth, off, n_elmts); break;
+		case tools::polar_node_t::RATE_1: this->rate1_node(depth, off, n_elmts); break;
+		case tools::polar_node_t::REP:    this->rep_node  (depth, off, n_elmts); break;
+		case tools::polar_node_t::SPC:    this->spc_node  (depth, off, n_elmts); break;
+		default:
+		{
+			// the nodes with a rate-0 or a repetition left child are processed as standard nodes
+			const auto n_elm_2 = n_elmts >> 1;
+			const auto n_vals  = n_elm_2 * n_frames;
+
+			const auto a_up = this->alpha.data() + 2 * (this->N - n_elmts) * n_frames;
+			const auto a_dn = a_up + n_vals;
+			const auto a_ch = this->alpha.data() + 2 * (this->N - n_elm_2) * n_frames;
+			const auto b_l  = this->beta[depth +1].data() + off * n_frames;
+			const auto b_r  = b_l + n_vals;
+			const auto b    = this->beta[depth].data() + off * n_frames;
+
+			tools::fv_LLR(a_up, a_dn, b_r, a_ch, n_vals); // the right child feedback is from the previous iteration
+			this->recursive_decode(depth +1, off, ++node_id, last_ite);
+
+			tools::vf_LLR(a_dn, b_l, a_up, a_ch, n_vals);
+			this->recursive_decode(depth +1, off + n_elm_2, ++node_id, last_ite);
+
+			tools::fv_LLR(b_l, b_r, a_dn, b,          n_vals);
+			tools::vf_LLR(b_r, b_l, a_up, b + n_vals, n_vals);
+
+			if (last_ite)
+			{
+				const auto s = this->s.data() + off * n_frames;
+				for (auto i = 0; i < n_vals; i++)
+					s[i] ^= s[n_vals + i];
+			}
+			return;
+		}
+	}
+
+	if (last_ite)
+		this->decide(depth, off, n_elmts);
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCAN_fast_sys<B,R>
+::rate0_node(const int depth, const int off, const int n_elmts)
+{
+	const auto n_frames = this->simd_inter_frame_level;
+	const auto b = this->beta[depth].begin() + off * n_frames;
+	std::fill(b, b + n_elmts * n_frames, tools::sat_val<R>());
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCAN_fast_sys<B,R>
+::rate1_node(const int depth, const int off, const int n_elmts)
+{
+	const auto n_frames = this->simd_inter_frame_level;
+	const auto b = this->beta[depth].begin() + off * n_frames;
+	std::fill(b, b + n_elmts * n_frames, (R)0);
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCAN_fast_sys<B,R>
+::rep_node(const int depth, const int off, const int n_elmts)
+{
+	// beta_i = sum_{j != i} alpha_j
+	const auto n_frames = this->simd_inter_frame_level;
+	const auto a = this->alpha.data() + 2 * (this->N - n_elmts) * n_frames;
+	const auto b = this->beta[depth].data() + off * n_frames;
+
+	// the fixed-point sums are widened to 32-bit, in a 'R' register they would wrap around (or saturate) before the
+	// subtraction
+	using A = typename std::conditional<std::is_floating_point<R>::value, R, int32_t>::type;
+
+	if (n_frames == 1 || !std::is_floating_point<R>::value)
+	{
+		for (auto f = 0; f < n_frames; f++)
+		{
+			A sum = 0;
+			for (auto i = 0; i < n_elmts; i++)
+				sum += (A)a[i * n_frames + f];
+			for (auto i = 0; i < n_elmts; i++)
+				b[i * n_frames + f] = (R)tools::saturate<A>(sum - (A)a[i * n_frames + f],
+				                                            -(A)tools::sat_val<R>(), (A)tools::sat_val<R>());
+		}
+	}
+	else
+	{
+		const auto r_zero = mipp::Reg<R>((R)0);
+
+		auto r_sum = r_zero;
+		for (auto i = 0; i < n_elmts; i++)
+			r_sum += mipp::Reg<R>(a + i * n_frames);
+		for (auto i = 0; i < n_elmts; i++)
+			tools::v_LLR_r(r_sum - mipp::Reg<R>(a + i * n_frames), r_zero).store(b + i * n_frames); // saturate
+	}
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCAN_fast_sys<B,R>
+::spc_node(const int depth, const int off, const int n_elmts)
+{
+	// beta_i = prod_{j != i} sign(alpha_j) * min_{j != i} |alpha_j|
+	const auto n_frames = this->simd_inter_frame_level;
+	const auto a = this->alpha.data() + 2 * (this->N - n_elmts) * n_frames;
+	const auto b = this->beta[depth].data() + off * n_frames;
+
+	if (n_frames == 1)
+	{
+		auto parity = false;
+		auto min1 = std::numeric_limits<R>::max(), min2 = std::numeric_limits<R>::max();
+		for (auto i = 0; i < n_elmts; i++)
+		{
+			const auto abs_a = (R)std::abs(a[i]);
+			parity ^= a[i] < 0;
+			min2 = std::min(min2, std::max(min1, abs_a));
+			min1 = std::min(min1, abs_a);
+		}
+		for (auto i = 0; i < n_elmts; i++)
+		{
+			const auto abs_b = ((R)std::abs(a[i]) == min1) ? min2 : min1;
+			b[i] = (parity ^ (a[i] < 0)) ? -abs_b : abs_b;
+		}
+	}
+	else
+	{
+		auto r_parity = mipp::Reg<R>((R)0);
+		auto r_min1 = mipp::Reg<R>(std::numeric_limits<R>::max()), r_min2 = r_min1;
+		for (auto i = 0; i < n_elmts; i++)
+		{
+			const auto r_a = mipp::Reg<R>(a + i * n_frames);
+			const auto r_abs_a = mipp::abs(r_a);
+			r_parity ^= r_a;
+			r_min2 = mipp::min(r_min2, mipp::max(r_min1, r_abs_a));
+			r_min1 = mipp::min(r_min1, r_abs_a);
+		}
+		for (auto i = 0; i < n_elmts; i++)
+		{
+			const auto r_a = mipp::Reg<R>(a + i * n_frames);
+			const auto r_abs_b = mipp::blend(r_min2, r_min1, mipp::abs(r_a) == r_min1);
+			mipp::neg(r_abs_b, mipp::sign(r_parity ^ r_a)).store(b + i * n_frames);
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_polar_SCAN_fast_sys<B,R>
+::decide(const int depth, const int off, const int n_elmts)
+{
+	// hard decision on the a posteriori LLRs of the node (the alpha and beta messages are independent)
+	const auto n_frames = this->simd_inter_frame_level;
+	const auto n_vals = n_elmts * n_frames;
+	const auto a = this->alpha.data() + 2 * (this->N - n_elmts) * n_frames;
+	const auto b = this->beta[depth].data() + off * n_frames;
+	const auto s = this->s.data() + off * n_frames;
+
+	for (auto i = 0; i < n_vals; i++)
+		s[i] = (B)(tools::v_LLR(a[i], b[i]) < 0);
+}
+}
+}
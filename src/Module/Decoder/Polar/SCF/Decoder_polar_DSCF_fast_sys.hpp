@@ -0,0 +1,56 @@
+#ifndef DECODER_POLAR_DSCF_FAST_SYS_
+#define DECODER_POLAR_DSCF_FAST_SYS_
+
+#include <vector>
+
+#include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_DSCF_fast_sys
+ *
+ * \brief Dynamic SC Flip (DSCF) decoder: the flip sets grow up to 'max_order' bits and are tried in the order of the
+ *        metric of Chandesris et al. (the sum of the flip penalties plus a soft count of the previous decisions).
+ *
+ * The metric of the children of a flip set (the set plus a later candidate) is computed from the penalties of the
+ * attempt of the set, only the 'n_flips' best flip sets are kept. The 'alpha' factor depends on the scale of the LLRs
+ * (the default value suits floating-point LLRs).
+ */
+template <typename B = int, typename R = float,
+          class API_polar = tools::API_polar_dynamic_seq<B, R, tools::f_LLR <  R>,
+                                                               tools::g_LLR <B,R>,
+                                                               tools::g0_LLR<  R>,
+                                                               tools::h_LLR <B,R>,
+                                                               tools::xo_STD<B  >>>
+class Decoder_polar_DSCF_fast_sys : public Decoder_polar_SCF_fast_sys<B,R,API_polar>
+{
+protected:
+	const int   max_order; // maximum number of bits in a flip set
+	const float alpha;     // scaling of the LLRs in the metric
+
+	struct flip_set_t { float metric; std::vector<int> set; };
+	std::vector<flip_set_t> flip_sets; // the best flip sets to try, sorted by increasing metric
+
+public:
+	Decoder_polar_DSCF_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+	                            std::vector<std::unique_ptr<tools::Pattern_polar_i>>&& polar_patterns,
+	                            const int idx_r0, const int idx_r1, CRC<B>& crc, const int n_flips,
+	                            const int max_order = 2, const float alpha = 1.f, const int n_frames = 1);
+
+	virtual ~Decoder_polar_DSCF_fast_sys() = default;
+
+protected:
+	virtual void _decode();
+
+private:
+	void add_children(const flip_set_t &parent, const int n_kept);
+};
+}
+}
+
+#include "Module/Decoder/Polar/SCF/Decoder_polar_DSCF_fast_sys.hxx"
+
+#endif /* DECODER_POLAR_DSCF_FAST_SYS_ */
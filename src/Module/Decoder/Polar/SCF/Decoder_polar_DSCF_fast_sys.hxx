@@ -0,0 +1,107 @@
+#include <cmath>
+#include <string>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Module/Decoder/Polar/SCF/Decoder_polar_DSCF_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar>
+Decoder_polar_DSCF_fast_sys<B,R,API_polar>
+::Decoder_polar_DSCF_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+                              std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+                              const int idx_r0, const int idx_r1, CRC<B>& crc, const int n_flips,
+                              const int max_order, const float alpha, const int n_frames)
+: Decoder(K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SCF_fast_sys<B,R,API_polar>(K, N, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, crc,
+                                            n_flips, n_frames),
+  max_order(max_order),
+  alpha(alpha)
+{
+	const std::string name = "Decoder_polar_DSCF_fast_sys";
+	this->set_name(name);
+
+	if (max_order <= 0)
+	{
+		std::stringstream message;
+		message << "'max_order' has to be greater than 0 ('max_order' = " << max_order << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (alpha <= 0.f)
+	{
+		std::stringstream message;
+		message << "'alpha' has to be greater than 0 ('alpha' = " << alpha << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->flip_sets.reserve(n_flips +1);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_DSCF_fast_sys<B,R,API_polar>
+::_decode()
+{
+	this->decode_first();
+	if (this->crc_check())
+		return;
+
+	this->flip_sets.clear();
+	this->add_children({0.f, {}}, this->n_flips);
+
+	for (auto a = 0; a < this->n_flips && !this->flip_sets.empty(); a++)
+	{
+		const auto best = this->flip_sets.front();
+		this->flip_sets.erase(this->flip_sets.begin());
+
+		if (this->decode_attempt(best.set))
+			break;
+
+		if ((int)best.set.size() < this->max_order)
+			this->add_children(best, this->n_flips - (a +1));
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_DSCF_fast_sys<B,R,API_polar>
+::add_children(const flip_set_t &parent, const int n_kept)
+{
+	const auto last = parent.set.empty() ? -1 : parent.set.back();
+
+	// M(E u {j}) = M(E) + |L_j| + 1/alpha * sum_{last(E) < k <= j} ln(1 + exp(-alpha |L_k|))
+	auto soft_count = 0.f;
+	for (auto pos : this->candidates)
+	{
+		if (pos <= last)
+			continue;
+
+		const auto penalty = this->penalties[pos];
+		soft_count += std::log1p(std::exp(-this->alpha * penalty)) / this->alpha;
+
+		const auto metric = parent.metric + penalty + soft_count;
+		if ((int)this->flip_sets.size() >= n_kept)
+		{
+			// the penalties are positive: the next candidates cannot do better once the soft count is too high
+			if (n_kept == 0 || parent.metric + soft_count >= this->flip_sets.back().metric)
+				break;
+			if (metric >= this->flip_sets.back().metric)
+				continue;
+		}
+
+		flip_set_t child = {metric, parent.set};
+		child.set.push_back(pos);
+
+		auto it = std::upper_bound(this->flip_sets.begin(), this->flip_sets.end(), child,
+		                           [](const flip_set_t &a, const flip_set_t &b) { return a.metric < b.metric; });
+		this->flip_sets.insert(it, std::move(child));
+
+		if ((int)this->flip_sets.size() > n_kept)
+			this->flip_sets.pop_back();
+	}
+}
+}
+}
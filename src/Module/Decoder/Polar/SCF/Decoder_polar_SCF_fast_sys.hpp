@@ -0,0 +1,79 @@
+#ifndef DECODER_POLAR_SCF_FAST_SYS_
+#define DECODER_POLAR_SCF_FAST_SYS_
+
+#include <memory>
+#include <vector>
+#include <mipp.h>
+
+#include "Module/CRC/CRC.hpp"
+#include "Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_SCF_fast_sys
+ *
+ * \brief Successive Cancellation Flip (SCF) decoder working on the pruned tree of the Decoder_polar_SC_fast_sys.
+ *
+ * The flip candidates are the bits of the rate-1 and SPC nodes and the repetition nodes (flipping a SPC bit also
+ * flips the bit that restores the parity). Each candidate is given the metric penalty of its flip, computed from the
+ * node LLRs. A new decoding attempt only restarts from the node of the first flipped bit: the LLRs on the path from
+ * the root are recomputed and the partial sums of the left siblings are recovered from the stored ones.
+ */
+template <typename B = int, typename R = float,
+          class API_polar = tools::API_polar_dynamic_seq<B, R, tools::f_LLR <  R>,
+                                                               tools::g_LLR <B,R>,
+                                                               tools::g0_LLR<  R>,
+                                                               tools::h_LLR <B,R>,
+                                                               tools::xo_STD<B  >>>
+class Decoder_polar_SCF_fast_sys : public Decoder_polar_SC_fast_sys<B,R,API_polar>
+{
+protected:
+	CRC<B>& crc;
+	const int n_flips;
+
+	std::vector<int>   n_nodes;    // number of nodes in the sub-tree of each node (pre-order ids)
+	std::vector<int>   candidates; // positions of the flip candidates (in the decoding order)
+	std::vector<float> penalties;  // metric penalty of the flip of each position (updated at each attempt)
+	std::vector<int>   flip_set;   // positions flipped in the current attempt (in the decoding order)
+	int                dirty_from; // position from which the partial sums differ from the first attempt
+	std::vector<B>     U_test;
+
+public:
+	Decoder_polar_SCF_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+	                           std::vector<std::unique_ptr<tools::Pattern_polar_i>>&& polar_patterns,
+	                           const int idx_r0, const int idx_r1, CRC<B>& crc, const int n_flips,
+	                           const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCF_fast_sys() = default;
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	virtual void _decode();
+
+	void decode_first  (                         );
+	bool decode_attempt(const std::vector<int> &set);
+	bool crc_check     (                         );
+
+	void recursive_decode (const int off_l, const int off_s, const int reverse_depth, int &node_id);
+	void recursive_restart(const int off_l, const int off_s, const int reverse_depth, int &node_id,
+	                       const int restart);
+
+private:
+	void  init_flip_tree   (                                                                        );
+	int   init_nodes       (const int off_s, const int reverse_depth, int &node_id                  );
+	void  decode_node      (const tools::polar_node_t node_type, const int off_l, const int off_s,
+	                        const int n_elmts                                                       );
+	void  flip             (const tools::polar_node_t node_type, const int off_l, const int off_s,
+	                        const int n_elmts, const int pos                                        );
+	float flip_cost        (const int off_l, const int off_s, const int i                          ) const;
+};
+}
+}
+
+#include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_fast_sys.hxx"
+
+#endif /* DECODER_POLAR_SCF_FAST_SYS_ */
@@ -0,0 +1,397 @@
+#include <cmath>
+#include <limits>
+#include <string>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/Polar/fb_extract.h"
+#include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::Decoder_polar_SCF_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+                             std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+                             const int idx_r0, const int idx_r1, CRC<B>& crc, const int n_flips,
+                             const int n_frames)
+: Decoder(K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SC_fast_sys<B,R,API_polar>(K, N, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, n_frames),
+  crc(crc),
+  n_flips(n_flips),
+  penalties(N, 0.f),
+  dirty_from(N),
+  U_test(K)
+{
+	const std::string name = "Decoder_polar_SCF_fast_sys";
+	this->set_name(name);
+
+	if (API_polar::get_n_frames() != 1)
+	{
+		std::stringstream message;
+		message << "'API_polar::get_n_frames()' has to be equal to 1 ('API_polar::get_n_frames()' = "
+		        << API_polar::get_n_frames() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (crc.get_size() > K)
+	{
+		std::stringstream message;
+		message << "'crc.get_size()' has to be equal or smaller than 'K' ('crc.get_size()' = " << crc.get_size()
+		        << ", 'K' = " << K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_flips < 0)
+	{
+		std::stringstream message;
+		message << "'n_flips' has to be positive ('n_flips' = " << n_flips << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->init_flip_tree();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::notify_frozenbits_update()
+{
+	Decoder_polar_SC_fast_sys<B,R,API_polar>::notify_frozenbits_update();
+	this->init_flip_tree();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::init_flip_tree()
+{
+	this->n_nodes.resize(this->polar_patterns.get_pattern_types().size());
+	this->candidates.clear();
+
+	int first_id = 0;
+	this->init_nodes(0, this->m, first_id);
+}
+
+template <typename B, typename R, class API_polar>
+int Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::init_nodes(const int off_s, const int reverse_depth, int &node_id)
+{
+	const auto cur_id    = node_id;
+	const auto n_elmts   = 1 << reverse_depth;
+	const auto n_elm_2   = n_elmts >> 1;
+	const auto node_type = this->polar_patterns.get_node_type(cur_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	if (!is_terminal_pattern && reverse_depth)
+	{
+		const auto n_left  = this->init_nodes(off_s,           reverse_depth -1, ++node_id);
+		const auto n_right = this->init_nodes(off_s + n_elm_2, reverse_depth -1, ++node_id);
+		this->n_nodes[cur_id] = 1 + n_left + n_right;
+	}
+	else
+	{
+		// a repetition node has a single information bit, the rate-1 and SPC nodes have one candidate per bit
+		if (node_type == tools::polar_node_t::REP)
+			this->candidates.push_back(off_s);
+		else if (node_type == tools::polar_node_t::RATE_1 || node_type == tools::polar_node_t::SPC)
+			for (auto i = 0; i < n_elmts; i++)
+				this->candidates.push_back(off_s + i);
+
+		this->n_nodes[cur_id] = 1;
+	}
+
+	return this->n_nodes[cur_id];
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::_decode()
+{
+	this->decode_first();
+	if (this->crc_check())
+		return;
+
+	// the flips are tried from the lowest to the highest metric penalty
+	const auto n_attempts = std::min(this->n_flips, (int)this->candidates.size());
+	auto order = this->candidates;
+	std::partial_sort(order.begin(), order.begin() + n_attempts, order.end(),
+	                  [this](const int a, const int b) { return this->penalties[a] < this->penalties[b]; });
+
+	for (auto a = 0; a < n_attempts; a++)
+		if (this->decode_attempt({order[a]}))
+			break;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::decode_first()
+{
+	this->flip_set.clear();
+
+	int first_id = 0;
+	this->recursive_decode(0, 0, this->m, first_id);
+
+	this->dirty_from = this->N;
+}
+
+template <typename B, typename R, class API_polar>
+bool Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::decode_attempt(const std::vector<int> &set)
+{
+	// the decisions before the first flipped bit are the ones of the first attempt, they are kept if they have not
+	// been overwritten by a previous attempt
+	const auto restart = std::min(this->dirty_from, set.front());
+
+	this->flip_set = set;
+
+	int first_id = 0;
+	this->recursive_restart(0, 0, this->m, first_id, restart);
+
+	this->dirty_from = set.front();
+
+	return this->crc_check();
+}
+
+template <typename B, typename R, class API_polar>
+bool Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::crc_check()
+{
+	tools::fb_extract(this->polar_patterns.get_leaves_pattern_types(), this->s.data(), this->U_test.data());
+	return this->crc.check(this->U_test, this->get_simd_inter_frame_level());
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::recursive_decode(const int off_l, const int off_s, const int reverse_depth, int &node_id)
+{
+	const int n_elmts = 1 << reverse_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = this->polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	if (!is_terminal_pattern && reverse_depth)
+	{
+		auto &l = this->l;
+		auto &s = this->s;
+
+		// f
+		switch (node_type)
+		{
+			case tools::polar_node_t::STANDARD: API_polar::f(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
+			case tools::polar_node_t::REP_LEFT: API_polar::f(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
+			default:
+				break;
+		}
+
+		this->recursive_decode(off_l + n_elmts, off_s, reverse_depth -1, ++node_id); // recursive call left
+
+		// g
+		switch (node_type)
+		{
+			case tools::polar_node_t::STANDARD:    API_polar::g (s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
+			case tools::polar_node_t::RATE_0_LEFT: API_polar::g0(   l, off_l, off_l + n_elm_2,        off_l + n_elmts, n_elm_2); break;
+			case tools::polar_node_t::REP_LEFT:    API_polar::gr(s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
+			default:
+				break;
+		}
+
+		this->recursive_decode(off_l + n_elmts, off_s + n_elm_2, reverse_depth -1, ++node_id); // recursive call right
+
+		// xor
+		switch (node_type)
+		{
+			case tools::polar_node_t::STANDARD:    API_polar::xo (s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
+			case tools::polar_node_t::RATE_0_LEFT: API_polar::xo0(s,        off_s + n_elm_2, off_s, n_elm_2); break;
+			case tools::polar_node_t::REP_LEFT:    API_polar::xo (s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
+			default:
+				break;
+		}
+	}
+	else
+		this->decode_node(node_type, off_l, off_s, n_elmts);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::recursive_restart(const int off_l, const int off_s, const int reverse_depth, int &node_id, const int restart)
+{
+	const int n_elmts = 1 << reverse_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = this->polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	if (!is_terminal_pattern && reverse_depth)
+	{
+		auto &l = this->l;
+		auto &s = this->s;
+
+		// the partial sums of the left child are recovered from the ones of the current node (in the left sub-tree,
+		// they are needed by the nodes before the restart position)
+		switch (node_type)
+		{
+			case tools::polar_node_t::STANDARD: API_polar::xo(s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
+			case tools::polar_node_t::REP_LEFT: API_polar::xo(s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
+			default:
+				break;
+		}
+
+		if (restart < off_s + n_elm_2)
+		{
+			// f
+			switch (node_type)
+			{
+				case tools::polar_node_t::STANDARD: API_polar::f(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
+				case tools::polar_node_t::REP_LEFT: API_polar::f(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
+				default:
+					break;
+			}
+
+			this->recursive_restart(off_l + n_elmts, off_s, reverse_depth -1, ++node_id, restart); // recursive call left
+		}
+		else
+			node_id += this->n_nodes[node_id +1]; // skip the left sub-tree, it is unchanged
+
+		// g
+		switch (node_type)
+		{
+			case tools::polar_node_t::STANDARD:    API_polar::g (s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
+			case tools::polar_node_t::RATE_0_LEFT: API_polar::g0(   l, off_l, off_l + n_elm_2,        off_l + n_elmts, n_elm_2); break;
+			case tools::polar_node_t::REP_LEFT:    API_polar::gr(s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
+			default:
+				break;
+		}
+
+		if (restart < off_s + n_elm_2)
+			this->recursive_decode(off_l + n_elmts, off_s + n_elm_2, reverse_depth -1, ++node_id); // recursive call right
+		else
+			this->recursive_restart(off_l + n_elmts, off_s + n_elm_2, reverse_depth -1, ++node_id, restart);
+
+		// xor
+		switch (node_type)
+		{
+			case tools::polar_node_t::STANDARD:    API_polar::xo (s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
+			case tools::polar_node_t::RATE_0_LEFT: API_polar::xo0(s,        off_s + n_elm_2, off_s, n_elm_2); break;
+			case tools::polar_node_t::REP_LEFT:    API_polar::xo (s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
+			default:
+				break;
+		}
+	}
+	else
+		this->decode_node(node_type, off_l, off_s, n_elmts);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::decode_node(const tools::polar_node_t node_type, const int off_l, const int off_s, const int n_elmts)
+{
+	auto &l = this->l;
+	auto &s = this->s;
+
+	// h
+	switch (node_type)
+	{
+		case tools::polar_node_t::RATE_0: API_polar::h0 (s,           off_s, n_elmts); break;
+		case tools::polar_node_t::RATE_1: API_polar::h  (s, l, off_l, off_s, n_elmts); break;
+		case tools::polar_node_t::REP:    API_polar::rep(s, l, off_l, off_s, n_elmts); break;
+		case tools::polar_node_t::SPC:    API_polar::spc(s, l, off_l, off_s, n_elmts); break;
+		default:
+			break;
+	}
+
+	// metric penalties of the flips (from the decisions of the node)
+	switch (node_type)
+	{
+		case tools::polar_node_t::RATE_1:
+		{
+			for (auto i = 0; i < n_elmts; i++)
+				this->penalties[off_s + i] = std::abs((float)l[off_l + i]);
+			break;
+		}
+		case tools::polar_node_t::REP:
+		{
+			auto sum_l = 0.f;
+			for (auto i = 0; i < n_elmts; i++)
+				sum_l += (float)l[off_l + i];
+			this->penalties[off_s] = std::abs(sum_l);
+			break;
+		}
+		case tools::polar_node_t::SPC:
+		{
+			// the flip of a bit comes with the cheapest flip of another bit, to keep the parity
+			auto min1 = std::numeric_limits<float>::max(), min2 = min1;
+			auto pos1 = -1;
+			for (auto i = 0; i < n_elmts; i++)
+			{
+				const auto cost = this->flip_cost(off_l, off_s, i);
+				if (cost < min1) { min2 = min1; min1 = cost; pos1 = i; }
+				else if (cost < min2) { min2 = cost; }
+			}
+			for (auto i = 0; i < n_elmts; i++)
+				this->penalties[off_s + i] = this->flip_cost(off_l, off_s, i) + (i != pos1 ? min1 : min2);
+			break;
+		}
+		default:
+			break;
+	}
+
+	for (auto pos : this->flip_set)
+		if (pos >= off_s && pos < off_s + n_elmts)
+			this->flip(node_type, off_l, off_s, n_elmts, pos);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::flip(const tools::polar_node_t node_type, const int off_l, const int off_s, const int n_elmts, const int pos)
+{
+	auto &s = this->s;
+	auto bit_flip = [&s](const int i) { s[i] = s[i] ? (B)0 : tools::bit_init<B>(); };
+
+	switch (node_type)
+	{
+		case tools::polar_node_t::RATE_1: bit_flip(pos); break;
+		case tools::polar_node_t::REP:    for (auto i = 0; i < n_elmts; i++) bit_flip(off_s + i); break;
+		case tools::polar_node_t::SPC:
+		{
+			auto min_cost = std::numeric_limits<float>::max();
+			auto min_pos  = -1;
+			for (auto i = 0; i < n_elmts; i++)
+			{
+				const auto cost = this->flip_cost(off_l, off_s, i);
+				if (off_s + i != pos && cost < min_cost) { min_cost = cost; min_pos = i; }
+			}
+			bit_flip(pos);
+			bit_flip(off_s + min_pos);
+			break;
+		}
+		default:
+			break;
+	}
+}
+
+template <typename B, typename R, class API_polar>
+float Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::flip_cost(const int off_l, const int off_s, const int i) const
+{
+	const auto llr = (float)this->l[off_l + i];
+	const auto hard_decision = llr < 0.f;
+	const auto decision      = this->s[off_s + i] != (B)0;
+
+	// flipping a bit decided against its LLR increases the likelihood of the node
+	return (hard_decision == decision) ? std::abs(llr) : -std::abs(llr);
+}
+}
+}
@@ -3,7 +3,6 @@
 
 #include <vector>
 
-#include "Tools/Algo/Tree/Binary_node.hpp"
 #include "Tools/Code/Polar/decoder_polar_functions.h"
 #include "Module/CRC/CRC.hpp"
 #include "Module/Decoder/Polar/SC/Decoder_polar_SC_naive.hpp"
@@ -23,17 +22,17 @@ protected:
 	const int n_flips;
 	std::vector<int> index;
 	int current_flip_index;
-	std::vector<tools::Binary_node<Contents_SC<B,R>>*> leaves;
+
 public:
 	Decoder_polar_SCF_naive(const int& K, const int& N, const std::vector<bool>& frozen_bits,
 	                        CRC<B>& crc, const int n_flips, const int n_frames = 1);
 	virtual ~Decoder_polar_SCF_naive() = default;
 
 protected:
-	virtual bool check_crc       (                                                     );
-	        void _decode_siho    (const R *Y_N, B *V_K, const int frame_id             );
-	        void _decode_siho_cw (const R *Y_N, B *V_N, const int frame_id             );
-            void recursive_decode(const tools::Binary_node<Contents_SC<B,R>>* node_curr);
+	virtual bool check_crc       (                                         );
+	        void _decode_siho    (const R *Y_N, B *V_K, const int frame_id );
+	        void _decode_siho_cw (const R *Y_N, B *V_N, const int frame_id );
+	        void recursive_decode(const int off, const int size            );
 };
 }
 }
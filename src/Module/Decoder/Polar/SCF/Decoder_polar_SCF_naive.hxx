@@ -34,54 +34,16 @@ Decoder_polar_SCF_naive<B,R,F,G,H>
 		        << ", 'K' = " << K << ").";
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
-
-	// get tree leaves
-	leaves = this->polar_tree.get_leaves();
 }
 
-
-
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G, tools::proto_h<B,R> H>
 void Decoder_polar_SCF_naive<B,R,F,G,H>
-::recursive_decode(const tools::Binary_node<Contents_SC<B,R>>* node_curr)
+::recursive_decode(const int off, const int size)
 {
+	Decoder_polar_SC_naive<B,R,F,G,H>::recursive_decode(off, size);
 
-	if (!node_curr->is_leaf()) // stop condition
-	{
-		const auto size = (int)node_curr->get_c()->lambda.size();
-		const auto size_2 = size / 2;
-
-		const auto *node_left  = node_curr->get_left(); // get left node
-		const auto *node_right = node_curr->get_right(); // get right node
-
-		for (auto i = 0; i < size_2; i++)
-			node_left->get_c()->lambda[i] = F(node_curr->get_c()->lambda[        i],  // apply f()
-			                                  node_curr->get_c()->lambda[size_2 +i]);
-
-		this->recursive_decode(node_left); // recursive call
-
-		for (auto i = 0; i < size_2; i++)
-			node_right->get_c()->lambda[i] = G(node_curr->get_c()->lambda[        i], // apply g()
-			                                   node_curr->get_c()->lambda[size_2 +i],
-			                                   node_left->get_c()->s     [        i]);
-
-		this->recursive_decode(node_right); // recursive call
-
-		for (auto i = 0; i < size_2; i++)
-			node_curr->get_c()->s[i] = node_left ->get_c()->s[i] ^ node_right->get_c()->s[i]; // bit xor
-
-		for (auto i = 0; i < size_2; i++)
-			node_curr->get_c()->s[size_2 +i] = node_right->get_c()->s[i]; // bit eq
-	}
-	else // specific leaf treatment
-	{
-		node_curr->get_c()->s[0] = (!node_curr->get_c()->is_frozen_bit && // if this is a frozen bit then s == 0
-		                            H(node_curr->get_c()->lambda[0])); // apply h()
-
-		if (current_flip_index == node_curr->get_lane_id())
-			node_curr->get_c()->s[0] = !node_curr->get_c()->s[0];
-	}
-
+	if (size == 1 && current_flip_index == off - this->m * this->N) // flip the leaf
+		this->s[off] = !this->s[off];
 }
 
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G, tools::proto_h<B,R> H>
@@ -99,9 +61,6 @@ void Decoder_polar_SCF_naive<B,R,F,G,H>
 		if (!this->frozen_bits[i])
 			index[j++] = i;
 
-	// get tree leaves
-	auto leaves = this->polar_tree.get_leaves();
-
 //	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
 	this->_load(Y_N);
 //	auto d_load = std::chrono::steady_clock::now() - t_load;
@@ -110,12 +69,13 @@ void Decoder_polar_SCF_naive<B,R,F,G,H>
 
 	current_flip_index = -1;
 
-	this->recursive_decode(this->polar_tree.get_root());
+	this->recursive_decode(0, this->N);
 
 	// identify the n_flips weakest llrs
+	const auto *leaves_lambda = this->lambda.data() + this->m * this->N;
 	std::partial_sort(index.begin(), index.begin() + n_flips, index.end(),
-	                  [this](const int& a, const int& b)
-	                  {return std::abs(this->leaves[a]->get_c()->lambda[0]) < std::abs(this->leaves[b]->get_c()->lambda[0]);}
+	                  [leaves_lambda](const int& a, const int& b)
+	                  {return std::abs(leaves_lambda[a]) < std::abs(leaves_lambda[b]);}
 	                 );
 
 	decode_result = this->check_crc();
@@ -124,7 +84,7 @@ void Decoder_polar_SCF_naive<B,R,F,G,H>
 	{
 		current_flip_index = index[n_ite];
 
-		this->recursive_decode(this->polar_tree.get_root());
+		this->recursive_decode(0, this->N);
 
 		decode_result = this->check_crc();
 
@@ -164,12 +124,13 @@ void Decoder_polar_SCF_naive<B,R,F,G,H>
 
 	current_flip_index = -1;
 
-	this->recursive_decode(this->polar_tree.get_root());
+	this->recursive_decode(0, this->N);
 
 	// identify the n_flips weakest llrs
+	const auto *leaves_lambda = this->lambda.data() + this->m * this->N;
 	std::partial_sort(index.begin(), index.begin() + n_flips, index.end(),
-	                  [this](const int& a, const int& b)
-	                  {return std::abs(this->leaves[a]->get_c()->lambda[0]) < std::abs(this->leaves[b]->get_c()->lambda[0]);}
+	                  [leaves_lambda](const int& a, const int& b)
+	                  {return std::abs(leaves_lambda[a]) < std::abs(leaves_lambda[b]);}
 	                 );
 
 	decode_result = check_crc();
@@ -178,7 +139,7 @@ void Decoder_polar_SCF_naive<B,R,F,G,H>
 	{
 		current_flip_index = index[n_ite];
 
-		this->recursive_decode(this->polar_tree.get_root());
+		this->recursive_decode(0, this->N);
 
 		decode_result = check_crc();
 
@@ -199,11 +160,13 @@ template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G, to
 bool Decoder_polar_SCF_naive<B,R,F,G,H>
 ::check_crc()
 {
+	const auto off_leaves = this->m * this->N;
+
 	std::vector<B> U_test;
 	U_test.clear();
 	for (auto leaf = 0 ; leaf < this->N ; leaf++)
 		if (!this->frozen_bits[leaf])
-			U_test.push_back(leaves[leaf]->get_c()->s[0]);
+			U_test.push_back(this->s[off_leaves + leaf]);
 	return this->crc.check(U_test, this->get_simd_inter_frame_level());
 }
 }
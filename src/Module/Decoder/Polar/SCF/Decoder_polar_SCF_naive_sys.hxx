@@ -22,17 +22,15 @@ template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G, to
 void Decoder_polar_SCF_naive_sys<B,R,F,G,H>
 ::_store(B *V, bool coded) const
 {
-	auto *contents_root = this->polar_tree.get_root()->get_c();
-
 	if (!coded)
 	{
 		auto k = 0;
 		for (auto i = 0; i < this->N; i++)
 			if (!this->frozen_bits[i])
-				V[k++] = contents_root->s[i];
+				V[k++] = this->s[i];
 	}
 	else
-		std::copy(contents_root->s.begin(), contents_root->s.begin() + this->N, V);
+		std::copy(this->s.begin(), this->s.begin() + this->N, V);
 }
 
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G, tools::proto_h<B,R> H>
@@ -44,7 +42,7 @@ bool Decoder_polar_SCF_naive_sys<B,R,F,G,H>
 
 	for (auto i = 0 ; i < this->N ; i++)
 		if (!this->frozen_bits[i])
-			U_test.push_back(this->polar_tree.get_root()->get_c()->s[i]);
+			U_test.push_back(this->s[i]);
 
 	return this->crc.check(U_test, this->get_simd_inter_frame_level());
 }
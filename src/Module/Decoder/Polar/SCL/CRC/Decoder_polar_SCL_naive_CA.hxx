@@ -39,7 +39,7 @@ void Decoder_polar_SCL_naive_CA<B,R,F,G>
 
 		for (auto leaf = 0 ; leaf < this->N ; leaf++)
 			if (!this->frozen_bits[leaf])
-				U_test.push_back(this->leaves_array[path][leaf]->get_c()->s[0]);
+				U_test.push_back(this->bits[path * this->N + leaf]);
 
 		bool decode_result = crc.check(U_test, this->get_simd_inter_frame_level());
 		if (!decode_result)
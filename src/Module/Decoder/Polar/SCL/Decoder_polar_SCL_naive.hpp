@@ -4,8 +4,6 @@
 #include <set>
 #include <vector>
 
-#include "Tools/Algo/Tree/Binary_node.hpp"
-#include "Tools/Algo/Tree/Binary_tree_metric.hpp"
 #include "Tools/Code/Polar/decoder_polar_functions.h"
 #include "Tools/Code/Polar/Frozenbits_notifier.hpp"
 
@@ -15,18 +13,17 @@ namespace aff3ct
 {
 namespace module
 {
-template <typename B = int, typename R = float>
-class Contents_SCL
-{
-public:
-	std::vector<R> lambda;
-	std::vector<B> s;
-	bool           is_frozen_bit;
-
-	explicit Contents_SCL(int size) : lambda(size), s(size), is_frozen_bit(0) {}
-	virtual ~Contents_SCL() {}
-};
-
+/*!
+ * \class Decoder_polar_SCL_naive
+ *
+ * \brief Successive Cancellation List (SCL) decoder on the full polar tree.
+ *
+ * Only the node being decoded at each depth is kept. The LLRs ('lambda') and the partial sums ('s') are stored level
+ * by level in two flat arrays: each depth 'd' has a pool of L buffers of N / 2^d elements, and the first half of the
+ * partial sums of a node holds the partial sums of its left child until its right child is decoded. The paths share
+ * the buffers of a depth with a reference counter: a path duplication only increments the counters, and a shared
+ * buffer is copied the first time one of its paths writes into it (copy-on-write).
+ */
 template <typename B, typename R, tools::proto_f<R> F = tools::f_LLR, tools::proto_g<B,R> G = tools::g_LLR>
 class Decoder_polar_SCL_naive : public Decoder_SIHO<B,R>, public tools::Frozenbits_notifier
 {
@@ -39,15 +36,20 @@ protected:
 	const int     L; // maximum paths number
 	std::set<int> active_paths;
 
-	std::vector<tools::Binary_tree_metric<Contents_SCL<B,R>,R>*> polar_trees;
-	std::vector<std::vector<tools::Binary_node<Contents_SCL<B,R>>*>> leaves_array;
+	std::vector<R>   metrics;     // metric of each path
+	std::vector<B>   bits;        // decoded bits (leaves) of each path
+	std::vector<int> off_levels;  // offset of each depth in the 'lambda' and 's' arrays
+	std::vector<R>   lambda;      // LLRs of the current node of each depth, level by level
+	std::vector<B>   s;           // partial sums of the current node of each depth, level by level
+	std::vector<int> lambda_refs; // number of paths sharing each LLRs buffer ([depth * L + buffer])
+	std::vector<int> s_refs;      // number of paths sharing each partial sums buffer ([depth * L + buffer])
+	std::vector<int> lambda_ids;  // LLRs buffer of each path ([depth * L + path], -1 if none)
+	std::vector<int> s_ids;       // partial sums buffer of each path ([depth * L + path], -1 if none)
 
 public:
 	Decoder_polar_SCL_naive(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
 	                        const int n_frames = 1);
-	virtual ~Decoder_polar_SCL_naive();
-
-	virtual void notify_frozenbits_update();
+	virtual ~Decoder_polar_SCL_naive() = default;
 
 protected:
 	        void _load          (const R *Y_N                            );
@@ -57,28 +59,20 @@ protected:
 	virtual void _store         (              B *V,   bool coded = false) const;
 
 private:
-	void recursive_compute_llr        (      tools::Binary_node<Contents_SCL<B,R>>* node_cur, int depth);
-	void propagate_sums               (const tools::Binary_node<Contents_SCL<B,R>>* node_cur           );
-	void recursive_duplicate_tree_llr (      tools::Binary_node<Contents_SCL<B,R>>* node_a,
-	                                         tools::Binary_node<Contents_SCL<B,R>>* node_b             );
-	void recursive_duplicate_tree_sums(      tools::Binary_node<Contents_SCL<B,R>>* node_a,
-	                                         tools::Binary_node<Contents_SCL<B,R>>* node_b,
-	                                         tools::Binary_node<Contents_SCL<B,R>>* node_caller        );
+	void compute_llr   (const int path, const int leaf_index);
+	void propagate_sums(const int path, const int leaf_index);
+	void duplicate_path(const int path, const int leaf_index);
+	void delete_path   (const int path                      );
 
-	void duplicate_path(int path, int leaf_index,
-	                    std::vector<std::vector<tools::Binary_node<Contents_SCL<B,R>>*>> leaves_array);
+	template <typename T>
+	T* get_writable(std::vector<T> &pool, std::vector<int> &refs, std::vector<int> &ids, const int path,
+	                const int depth, const bool copy);
 
 protected:
 	virtual void select_best_path();
 
-	void recursive_allocate_nodes_contents  (      tools::Binary_node<Contents_SCL<B,R>>* node_curr, const int vector_size               );
-	void recursive_initialize_frozen_bits   (const tools::Binary_node<Contents_SCL<B,R>>* node_curr, const std::vector<bool>& frozen_bits);
-	void recursive_store                    (const tools::Binary_node<Contents_SCL<B,R>>* node_curr, B *V_K, int &k                      ) const;
-	void recursive_deallocate_nodes_contents(      tools::Binary_node<Contents_SCL<B,R>>* node_curr                                      );
-
-	void apply_f     (const tools::Binary_node<Contents_SCL<B,R>>* node_curr);
-	void apply_g     (const tools::Binary_node<Contents_SCL<B,R>>* node_curr);
-	void compute_sums(const tools::Binary_node<Contents_SCL<B,R>>* node_curr);
+	const R* get_lambda(const int path, const int depth) const;
+	const B* get_s     (const int path, const int depth) const;
 };
 }
 }
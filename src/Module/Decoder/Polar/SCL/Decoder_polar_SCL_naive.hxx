@@ -24,7 +24,16 @@ Decoder_polar_SCL_naive<B,R,F,G>
   m((int)std::log2(N)),
   metric_init(std::numeric_limits<R>::min()),
   frozen_bits(frozen_bits),
-  L(L)
+  L(L),
+  metrics(L),
+  bits(L * N),
+  off_levels(m +1),
+  lambda(2 * L * N),
+  s(2 * L * N),
+  lambda_refs((m +1) * L),
+  s_refs((m +1) * L),
+  lambda_ids((m +1) * L),
+  s_ids((m +1) * L)
 {
 	const std::string name = "Decoder_polar_SCL_naive";
 	this->set_name(name);
@@ -60,56 +69,31 @@ Decoder_polar_SCL_naive<B,R,F,G>
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	this->active_paths.insert(0);
-	for (auto i = 0; i < L; i++)
-	{
-		this->polar_trees.push_back(new tools::Binary_tree_metric<Contents_SCL<B,R>,R>(this->m + 1, metric_init));
-		this->recursive_allocate_nodes_contents(this->polar_trees[i]->get_root(), this->N);
-		this->recursive_initialize_frozen_bits(this->polar_trees[i]->get_root(), frozen_bits);
-	}
-	for (auto i = 0; i < L; i++)
-		leaves_array.push_back(this->polar_trees[i]->get_leaves());
-}
+	for (auto d = 0; d <= this->m; d++)
+		this->off_levels[d] = 2 * L * (N - (N >> d));
 
-template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
-Decoder_polar_SCL_naive<B,R,F,G>
-::~Decoder_polar_SCL_naive()
-{
-	for (auto i = 0; i < L; i++)
-	{
-		auto *cur_tree = this->polar_trees.back();
-		this->recursive_deallocate_nodes_contents(cur_tree->get_root());
-		this->recursive_deallocate_nodes_contents(cur_tree->get_root()->get_left());
-		this->recursive_deallocate_nodes_contents(cur_tree->get_root()->get_right());
-
-		this->polar_trees.pop_back();
-		delete cur_tree;
-	}
-}
-
-template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
-void Decoder_polar_SCL_naive<B,R,F,G>
-::notify_frozenbits_update()
-{
-	for (auto i = 0; i < L; i++)
-		this->recursive_initialize_frozen_bits(this->polar_trees[i]->get_root(), frozen_bits);
+	this->active_paths.insert(0);
 }
 
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
 void Decoder_polar_SCL_naive<B,R,F,G>
 ::_load(const R *Y_N)
 {
-
-	for (auto path = 0; path < this->L; path ++)
+	std::fill(this->metrics.begin(), this->metrics.end(), metric_init);
+
+	// initialization: the path 0 uses the buffer 0 of each depth
+	std::fill(this->lambda_refs.begin(), this->lambda_refs.end(), 0);
+	std::fill(this->s_refs     .begin(), this->s_refs     .end(), 0);
+	std::fill(this->lambda_ids .begin(), this->lambda_ids .end(), -1);
+	std::fill(this->s_ids      .begin(), this->s_ids      .end(), -1);
+	for (auto d = 0; d <= this->m; d++)
 	{
-		auto *contents = this->polar_trees[path]->get_root()->get_contents();
-		for (auto i = 0; i < this->N; i++)
-			contents->lambda[i] = Y_N[i];
-
-		polar_trees[path]->set_path_metric(metric_init);
+		this->lambda_refs[d * L] = this->s_refs[d * L] = 1;
+		this->lambda_ids [d * L] = this->s_ids [d * L] = 0;
 	}
 
-	// initialization
+	std::copy(Y_N, Y_N + this->N, this->lambda.begin() + this->off_levels[0]);
+
 	active_paths.clear();
 	active_paths.insert(0);
 }
@@ -129,24 +113,23 @@ void Decoder_polar_SCL_naive<B,R,F,G>
 	{
 		// compute LLR for current leaf
 		for (auto path : active_paths)
-			this->recursive_compute_llr(leaves_array[path][leaf_index], tools::compute_depth(leaf_index, this->m));
+			this->compute_llr(path, leaf_index);
 
 		// if current leaf is a frozen bit
-		if (leaves_array[0][leaf_index]->get_c()->is_frozen_bit)
+		if (frozen_bits[leaf_index])
 		{
 			auto min_phi = std::numeric_limits<R>::max();
 			for (auto path : active_paths)
 			{
-				auto cur_leaf = leaves_array[path][leaf_index];
-				cur_leaf->get_c()->s[0] = 0;
-				auto phi_cur = tools::phi<R>(polar_trees[path]->get_path_metric(), cur_leaf->get_c()->lambda[0], 0);
-				this->polar_trees[path]->set_path_metric(phi_cur);
+				this->bits[path * this->N + leaf_index] = 0;
+				auto phi_cur = tools::phi<R>(metrics[path], this->get_lambda(path, this->m)[0], 0);
+				this->metrics[path] = phi_cur;
 				min_phi = std::min<R>(min_phi, phi_cur);
 			}
 
 			// normalization
 			for (auto path : active_paths)
-				this->polar_trees[path]->set_path_metric(this->polar_trees[path]->get_path_metric() - min_phi);
+				this->metrics[path] -= min_phi;
 		}
 		else
 		{
@@ -155,9 +138,9 @@ void Decoder_polar_SCL_naive<B,R,F,G>
 			auto min_phi = std::numeric_limits<R>::max();
 			for (auto path : active_paths)
 			{
-				auto cur_leaf = leaves_array[path][leaf_index];
-				R phi0 = tools::phi<B,R>(polar_trees[path]->get_path_metric(), cur_leaf->get_c()->lambda[0],                 (B)0);
-				R phi1 = tools::phi<B,R>(polar_trees[path]->get_path_metric(), cur_leaf->get_c()->lambda[0], tools::bit_init<B>());
+				const auto leaf_lambda = this->get_lambda(path, this->m)[0];
+				R phi0 = tools::phi<B,R>(metrics[path], leaf_lambda,                 (B)0);
+				R phi1 = tools::phi<B,R>(metrics[path], leaf_lambda, tools::bit_init<B>());
 				metrics_vec.push_back(std::make_tuple(path,                 (B)0, phi0));
 				metrics_vec.push_back(std::make_tuple(path, tools::bit_init<B>(), phi1));
 
@@ -173,7 +156,7 @@ void Decoder_polar_SCL_naive<B,R,F,G>
 			{
 				last_active_paths = active_paths;
 				for (auto path : last_active_paths)
-					this->duplicate_path(path, leaf_index, leaves_array);
+					this->duplicate_path(path, leaf_index);
 			}
 			else
 			{
@@ -194,7 +177,7 @@ void Decoder_polar_SCL_naive<B,R,F,G>
 						});
 
 					if (it_double != metrics_vec.end())
-						active_paths.erase(std::get<0>(*it));
+						this->delete_path(std::get<0>(*it));
 				}
 
 				// remove worst metrics from list
@@ -213,13 +196,13 @@ void Decoder_polar_SCL_naive<B,R,F,G>
 					{
 						// duplicate
 						metrics_vec.erase(it_double);
-						duplicate_path(std::get<0>(*it), leaf_index, leaves_array);
+						duplicate_path(std::get<0>(*it), leaf_index);
 					}
 					else
 					{
 						// choose
-						leaves_array[std::get<0>(*it)][leaf_index]->get_c()->s[0] = std::get<1>(*it);
-						polar_trees[std::get<0>(*it)]->set_path_metric(std::get<2>(*it));
+						this->bits[std::get<0>(*it) * this->N + leaf_index] = std::get<1>(*it);
+						this->metrics[std::get<0>(*it)] = std::get<2>(*it);
 					}
 				}
 			}
@@ -227,7 +210,7 @@ void Decoder_polar_SCL_naive<B,R,F,G>
 
 		// propagate sums
 		for (auto path : active_paths)
-			this->propagate_sums(leaves_array[path][leaf_index]);
+			this->propagate_sums(path, leaf_index);
 	}
 
 	this->select_best_path();
@@ -279,224 +262,177 @@ template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
 void Decoder_polar_SCL_naive<B,R,F,G>
 ::_store(B *V, bool coded) const
 {
-	auto *root = (tools::Binary_node<Contents_SCL<B,R>>*)this->polar_trees[*active_paths.begin()]->get_root();
+	const auto path = *active_paths.begin();
 	if (!coded)
 	{
+		const auto *path_bits = this->bits.data() + path * this->N;
+
 		auto k = 0;
-		this->recursive_store(root, V, k);
+		for (auto i = 0; i < this->N; i++)
+			if (!frozen_bits[i])
+				V[k++] = path_bits[i] ? 1 : 0;
 	}
 	else
 	{
-		auto *contents_root = root->get_c();
-		std::copy(contents_root->s.begin(), contents_root->s.begin() + this->N, V);
+		const auto *root_s = this->get_s(path, 0);
+		std::copy(root_s, root_s + this->N, V);
 	}
 }
 
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
 void Decoder_polar_SCL_naive<B,R,F,G>
-::recursive_compute_llr(tools::Binary_node<Contents_SCL<B, R> >* node_cur, int depth)
+::compute_llr(const int path, const int leaf_index)
 {
-	if (depth != 0)
-		recursive_compute_llr(node_cur->get_father(), --depth);
-
-	if(node_cur->is_left())
-		this->apply_f((tools::Binary_node<Contents_SCL<B,R>>*)node_cur->get_father());
-
-	if(node_cur->is_right())
-		this->apply_g((tools::Binary_node<Contents_SCL<B,R>>*)node_cur->get_father());
-}
-
-template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
-void Decoder_polar_SCL_naive<B,R,F,G>
-::propagate_sums(const tools::Binary_node<Contents_SCL<B, R> >* node_cur)
-{
-	if(!node_cur->is_leaf())
-		this->compute_sums((tools::Binary_node<Contents_SCL<B,R>>*)node_cur);
-
-	if (node_cur->is_right() && !node_cur->is_root())
-		this->propagate_sums(node_cur->get_father());
+	// the nodes from the first one which is not an ancestor of the previous leaf, down to the leaf
+	for (auto d = this->m - tools::compute_depth(leaf_index, this->m); d <= this->m; d++)
+	{
+		const auto  size       = this->N >> d;
+		const auto *lambda_up  = this->get_lambda(path, d -1);
+		      auto *lambda_cur = this->get_writable(this->lambda, this->lambda_refs, this->lambda_ids, path, d, false);
 
+		if (((leaf_index >> (this->m - d)) & 1) == 0) // left node
+		{
+			for (auto i = 0; i < size; i++)
+				lambda_cur[i] = F(lambda_up[i], lambda_up[size +i]); // apply f()
+		}
+		else // right node, the partial sums of the left node are in the first half of the father ones
+		{
+			const auto *s_left = this->get_s(path, d -1);
+			for (auto i = 0; i < size; i++)
+				lambda_cur[i] = G(lambda_up[i], lambda_up[size +i], s_left[i]); // apply g()
+		}
+	}
 }
 
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
 void Decoder_polar_SCL_naive<B,R,F,G>
-::recursive_duplicate_tree_llr(tools::Binary_node<Contents_SCL<B,R>>* node_a,
-                               tools::Binary_node<Contents_SCL<B,R> >* node_b)
+::propagate_sums(const int path, const int leaf_index)
 {
-	node_b->get_c()->lambda = node_a->get_c()->lambda;
+	auto *s_cur = this->get_writable(this->s, this->s_refs, this->s_ids, path, this->m, false);
+	s_cur[0] = this->bits[path * this->N + leaf_index];
 
-	if(!node_a->get_father()->is_root())
-		this->recursive_duplicate_tree_llr(node_a->get_father(), node_b->get_father());
-}
-
-template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
-void Decoder_polar_SCL_naive<B,R,F,G>
-::recursive_duplicate_tree_sums(tools::Binary_node<Contents_SCL<B,R>>* node_a,
-                                tools::Binary_node<Contents_SCL<B,R>>* node_b,
-                                tools::Binary_node<Contents_SCL<B,R>>* node_caller)
-{
-	if (node_a->get_left() != node_caller && !node_a->is_leaf())
-		node_b->get_left()->get_c()->s = node_a->get_left()->get_c()->s;
+	for (auto d = this->m; d > 0; d--)
+	{
+		const auto size = this->N >> d;
+		if (((leaf_index >> (this->m - d)) & 1) == 0) // left node: store the partial sums in the father ones
+		{
+			auto *s_up = this->get_writable(this->s, this->s_refs, this->s_ids, path, d -1, false);
+			std::copy(s_cur, s_cur + size, s_up);
+			break;
+		}
 
-	if(!node_a->is_root())
-		this->recursive_duplicate_tree_sums(node_a->get_father(), node_b->get_father(), node_a);
+		// right node: compute the partial sums of the father
+		auto *s_up = this->get_writable(this->s, this->s_refs, this->s_ids, path, d -1, true);
+		for (auto i = 0; i < size; i++)
+		{
+			s_up[       i] ^= s_cur[i]; // bit xor
+			s_up[size + i]  = s_cur[i]; // bit eq
+		}
+		s_cur = s_up;
+	}
 }
 
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
 void Decoder_polar_SCL_naive<B,R,F,G>
-::duplicate_path(int path, int leaf_index, std::vector<std::vector<tools::Binary_node<Contents_SCL<B,R>>*>> leaves_array)
+::duplicate_path(const int path, const int leaf_index)
 {
-	std::vector<tools::Binary_node<Contents_SCL<B,R>>*> path_leaves, newpath_leaves;
 	int newpath = 0;
 	while (active_paths.find(newpath++) != active_paths.end()){};
 	newpath--;
 
 	active_paths.insert(newpath);
 
-	path_leaves = leaves_array[path];
-
-	newpath_leaves = leaves_array[newpath];
-
-	for (auto i = 0; i < leaf_index; i++)
-		newpath_leaves[i]->get_c()->s = path_leaves[i]->get_c()->s;
-
-	recursive_duplicate_tree_sums(leaves_array[path][leaf_index], leaves_array[newpath][leaf_index], nullptr);
-
-	if (leaf_index < this->N - 1)
-		recursive_duplicate_tree_llr(leaves_array[path][leaf_index + 1], leaves_array[newpath][leaf_index + 1]);
+	// the new path shares all the buffers of the duplicated path
+	for (auto d = 0; d <= this->m; d++)
+	{
+		this->lambda_ids[d * L + newpath] = this->lambda_ids[d * L + path];
+		this->s_ids     [d * L + newpath] = this->s_ids     [d * L + path];
+		this->lambda_refs[d * L + this->lambda_ids[d * L + path]]++;
+		this->s_refs     [d * L + this->s_ids     [d * L + path]]++;
+	}
 
-	leaves_array[newpath][leaf_index]->get_c()->s[0] = tools::bit_init<B>();
-	polar_trees[newpath]->set_path_metric(tools::phi<B,R>(polar_trees[path]->get_path_metric(),
-	                                                      leaves_array[path][leaf_index]->get_c()->lambda[0],
-	                                                      tools::bit_init<B>()));
+	std::copy(this->bits.begin() + (path    +0) * this->N,
+	          this->bits.begin() + (path    +0) * this->N + leaf_index,
+	          this->bits.begin() + (newpath +0) * this->N);
 
-	leaves_array[path][leaf_index]->get_c()->s[0] = 0;
-	polar_trees[path]->set_path_metric(tools::phi<B,R>(polar_trees[path]->get_path_metric(),
-	                                                   leaves_array[path][leaf_index]->get_c()->lambda[0],
-	                                                   0));
-}
+	const auto leaf_lambda = this->get_lambda(path, this->m)[0];
 
-template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
-void Decoder_polar_SCL_naive<B,R,F,G>
-::select_best_path()
-{
-	int best_path = 0;
-	if (active_paths.size() >= 1)
-		best_path = *active_paths.begin();
-
-	for (int path : active_paths)
-		if(polar_trees[path]->get_path_metric() < polar_trees[best_path]->get_path_metric())
-			best_path = path;
+	this->bits[newpath * this->N + leaf_index] = tools::bit_init<B>();
+	this->metrics[newpath] = tools::phi<B,R>(this->metrics[path], leaf_lambda, tools::bit_init<B>());
 
-	active_paths.clear();
-	active_paths.insert(best_path);
+	this->bits[path * this->N + leaf_index] = 0;
+	this->metrics[path] = tools::phi<B,R>(this->metrics[path], leaf_lambda, 0);
 }
 
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
 void Decoder_polar_SCL_naive<B,R,F,G>
-::recursive_allocate_nodes_contents(tools::Binary_node<Contents_SCL<B,R>>* node_curr, const int vector_size)
+::delete_path(const int path)
 {
-	if (node_curr != nullptr)
-	{
-		node_curr->set_contents(new Contents_SCL<B,R>(vector_size));
-
-		this->recursive_allocate_nodes_contents(node_curr->get_left() , vector_size / 2);
-		this->recursive_allocate_nodes_contents(node_curr->get_right(), vector_size / 2);
-	}
+	if (active_paths.erase(path))
+		for (auto d = 0; d <= this->m; d++)
+		{
+			this->lambda_refs[d * L + this->lambda_ids[d * L + path]]--;
+			this->s_refs     [d * L + this->s_ids     [d * L + path]]--;
+			this->lambda_ids[d * L + path] = -1;
+			this->s_ids     [d * L + path] = -1;
+		}
 }
 
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
-void Decoder_polar_SCL_naive<B,R,F,G>
-::recursive_initialize_frozen_bits(const tools::Binary_node<Contents_SCL<B,R>>* node_curr,
-                                   const std::vector<bool>& frozen_bits)
+template <typename T>
+T* Decoder_polar_SCL_naive<B,R,F,G>
+::get_writable(std::vector<T> &pool, std::vector<int> &refs, std::vector<int> &ids, const int path,
+               const int depth, const bool copy)
 {
-	auto *contents = node_curr->get_contents();
+	const auto size = this->N >> depth;
+	auto &id = ids[depth * L + path];
 
-	if (!node_curr->is_leaf()) // stop condition
+	if (refs[depth * L + id] > 1) // the buffer is shared with other paths: take a free one
 	{
-		this->recursive_initialize_frozen_bits(node_curr->get_left(),  frozen_bits); // recursive call
-		this->recursive_initialize_frozen_bits(node_curr->get_right(), frozen_bits); // recursive call
-	}
-	else
-		contents->is_frozen_bit = frozen_bits[node_curr->get_lane_id()];
-}
+		auto new_id = 0;
+		while (refs[depth * L + new_id] != 0) new_id++;
 
-template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
-void Decoder_polar_SCL_naive<B,R,F,G>
-::recursive_store(const tools::Binary_node<Contents_SCL<B,R>>* node_curr, B *V_K, int &k) const
-{
-	auto *contents = node_curr->get_contents();
+		if (copy)
+			std::copy(pool.begin() + this->off_levels[depth] + (id +0) * size,
+			          pool.begin() + this->off_levels[depth] + (id +1) * size,
+			          pool.begin() + this->off_levels[depth] + new_id * size);
 
-	if (!node_curr->is_leaf()) // stop condition
-	{
-		this->recursive_store(node_curr->get_left(),  V_K, k); // recursive call
-		this->recursive_store(node_curr->get_right(), V_K, k); // recursive call
+		refs[depth * L + id]--;
+		refs[depth * L + new_id] = 1;
+		id = new_id;
 	}
-	else
-		if (!frozen_bits[node_curr->get_lane_id()])
-			V_K[k++] = contents->s[0] ? 1 : 0;
-}
 
-template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
-void Decoder_polar_SCL_naive<B,R,F,G>
-::recursive_deallocate_nodes_contents(tools::Binary_node<Contents_SCL<B,R>>* node_curr)
-{
-	if (node_curr != nullptr)
-	{
-		this->recursive_deallocate_nodes_contents(node_curr->get_left()); // recursive call
-		this->recursive_deallocate_nodes_contents(node_curr->get_right()); // recursive call
-
-		auto *contents = node_curr->get_contents();
-		delete contents;
-		node_curr->set_contents(nullptr);
-	}
+	return pool.data() + this->off_levels[depth] + id * size;
 }
 
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
-void Decoder_polar_SCL_naive<B,R,F,G>
-::apply_f(const tools::Binary_node<Contents_SCL<B,R>>* node_curr)
+const R* Decoder_polar_SCL_naive<B,R,F,G>
+::get_lambda(const int path, const int depth) const
 {
-	const auto size = (int)node_curr->get_c()->lambda.size();
-	const auto size_2 = size / 2;
-
-	const auto *node_left  = node_curr->get_left(); // get left node
-
-	for (auto i = 0; i < size_2; i++)
-		node_left->get_c()->lambda[i] = F(node_curr->get_c()->lambda[        i],  // apply f()
-		                                  node_curr->get_c()->lambda[size_2 +i]);
+	return this->lambda.data() + this->off_levels[depth] + this->lambda_ids[depth * L + path] * (this->N >> depth);
 }
 
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
-void Decoder_polar_SCL_naive<B,R,F,G>
-::apply_g(const tools::Binary_node<Contents_SCL<B,R>>* node_curr)
+const B* Decoder_polar_SCL_naive<B,R,F,G>
+::get_s(const int path, const int depth) const
 {
-	const auto size = (int)node_curr->get_c()->lambda.size();
-	const auto size_2 = size / 2;
-
-	const auto *node_left  = node_curr->get_left(); // get left node
-	const auto *node_right = node_curr->get_right(); // get right node
-
-	for (auto i = 0; i < size_2; i++)
-		node_right->get_c()->lambda[i] = G(node_curr->get_c()->lambda[        i], // apply g()
-		                                   node_curr->get_c()->lambda[size_2 +i],
-		                                   node_left->get_c()->s     [        i]);
+	return this->s.data() + this->off_levels[depth] + this->s_ids[depth * L + path] * (this->N >> depth);
 }
 
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
 void Decoder_polar_SCL_naive<B,R,F,G>
-::compute_sums(const tools::Binary_node<Contents_SCL<B,R>>* node_curr)
+::select_best_path()
 {
-	const auto size = (int)node_curr->get_c()->lambda.size();
-	const auto size_2 = size / 2;
-
-	const auto *node_left  = node_curr->get_left(); // get left node
-	const auto *node_right = node_curr->get_right(); // get right node
+	int best_path = 0;
+	if (active_paths.size() >= 1)
+		best_path = *active_paths.begin();
 
-	for (auto i = 0; i < size_2; i++)
-		node_curr->get_c()->s[i] = node_left->get_c()->s[i] ^ node_right->get_c()->s[i]; // bit xor
+	for (int path : active_paths)
+		if(metrics[path] < metrics[best_path])
+			best_path = path;
 
-	for (auto i = 0; i < size_2; i++)
-		node_curr->get_c()->s[size_2 +i] = node_right->get_c()->s[i]; // bit eq
+	active_paths.clear();
+	active_paths.insert(best_path);
 }
 }
 }
@@ -26,11 +26,11 @@ void Decoder_polar_SCL_naive_sys<B,R,F,G>
 		auto k = 0;
 		for (auto i = 0; i < this->N; i++)
 			if (!this->frozen_bits[i])
-				V[k++] = this->polar_trees[*this->active_paths.begin()]->get_root()->get_c()->s[i] ? 1 : 0;
+				V[k++] = this->get_s(*this->active_paths.begin(), 0)[i] ? 1 : 0;
 	}
 	else
 		for (auto i = 0; i < this->N; i++)
-			V[i] = this->polar_trees[*this->active_paths.begin()]->get_root()->get_c()->s[i] ? 1 : 0;
+			V[i] = this->get_s(*this->active_paths.begin(), 0)[i] ? 1 : 0;
 }
 }
 }
@@ -0,0 +1,52 @@
+#include <cmath>
+#include <string>
+#include <algorithm>
+
+#include "Tools/Code/RM/rm_functions.h"
+#include "Module/Decoder/RM/Decoder_RM.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_RM<B,R>
+::Decoder_RM(const int& K, const int& N, const int n_frames)
+: Decoder          (K, N, n_frames, 1),
+  Decoder_SIHO<B,R>(K, N, n_frames, 1),
+  m((int)std::log2(N)),
+  r(tools::rm_order(K, N)),
+  frozen_bits(tools::rm_frozen_bits(r, m)),
+  U_N(N)
+{
+	const std::string name = "Decoder_RM";
+	this->set_name(name);
+}
+
+template <typename B, typename R>
+void Decoder_RM<B,R>
+::_store(const B *X_N, B *V_K)
+{
+	std::copy(X_N, X_N + this->N, this->U_N.begin());
+
+	for (auto h = (this->N >> 1); h > 0; h >>= 1)
+		for (auto j = 0; j < this->N; j += 2 * h)
+			for (auto i = 0; i < h; i++)
+				this->U_N[j + i] ^= this->U_N[h + j + i];
+
+	auto k = 0;
+	for (auto i = 0; i < this->N; i++)
+		if (!frozen_bits[i])
+			V_K[k++] = this->U_N[i];
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_RM<B_8,Q_8>;
+template class aff3ct::module::Decoder_RM<B_16,Q_16>;
+template class aff3ct::module::Decoder_RM<B_32,Q_32>;
+template class aff3ct::module::Decoder_RM<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_RM<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,38 @@
+#ifndef DECODER_RM_HPP_
+#define DECODER_RM_HPP_
+
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+
+#include "Module/Decoder/Decoder_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Common part of the RM(r,m) Reed-Muller decoders: the decoders estimate a codeword and '_store' recovers the
+ * information bits (the Arikan kernel is its own inverse, see 'Encoder_RM').
+ */
+template <typename B = int, typename R = float>
+class Decoder_RM : public Decoder_SIHO<B,R>
+{
+protected:
+	// the correlations (Hadamard transforms and path metrics) are accumulated on 32-bit when the LLRs are quantized
+	using A = typename std::conditional<std::is_floating_point<R>::value, R, int32_t>::type;
+
+	const int               m;           // log_2 of code length
+	const int               r;           // order of the code
+	const std::vector<bool> frozen_bits; // true means frozen, false means set to 0/1
+	      std::vector<B>    U_N;
+
+	Decoder_RM(const int& K, const int& N, const int n_frames = 1);
+	virtual ~Decoder_RM() = default;
+
+	void _store(const B *X_N, B *V_K);
+};
+}
+}
+
+#endif /* DECODER_RM_HPP_ */
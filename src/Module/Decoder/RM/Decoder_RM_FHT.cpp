@@ -0,0 +1,142 @@
+#include <string>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/fht.h"
+#include "Module/Decoder/RM/Decoder_RM_FHT.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_RM_FHT<B,R>
+::Decoder_RM_FHT(const int& K, const int& N, const int n_frames)
+: Decoder        (K, N, n_frames, 1),
+  Decoder_RM<B,R>(K, N, n_frames),
+  Y_N_fht(N)
+{
+	const std::string name = "Decoder_RM_FHT";
+	this->set_name(name);
+
+	if (this->r > 1)
+	{
+		std::stringstream message;
+		message << "The order of the Reed-Muller code has to be 0 or 1 ('r' = " << this->r << ", 'K' = " << K
+		        << ", 'N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R>
+void Decoder_RM_FHT<B,R>
+::_load(const R *Y_N)
+{
+	std::copy(Y_N, Y_N + this->N, this->Y_N_fht.begin());
+}
+
+template <typename B, typename R>
+void Decoder_RM_FHT<B,R>
+::_decode(int &j, B &c)
+{
+	// Y_N_fht[j] is the correlation between the LLRs and the codeword <i,j> (mapped on +1/-1)
+	tools::fht(this->Y_N_fht.data(), this->N);
+
+	j = 0;
+	if (this->r == 1)
+	{
+		auto i = 0;
+		auto max = (A)0;
+		if (this->N >= mipp::nElReg<A>())
+		{
+			auto r_max = mipp::Reg<A>((A)0);
+			for (; i < this->N; i += mipp::nElReg<A>())
+				r_max = mipp::max(r_max, mipp::abs(mipp::Reg<A>(&this->Y_N_fht[i])));
+			max = mipp::hmax(r_max);
+		}
+		for (; i < this->N; i++)
+			max = std::max(max, (A)std::abs(this->Y_N_fht[i]));
+
+		while (std::abs(this->Y_N_fht[j]) != max) j++;
+	}
+
+	c = this->Y_N_fht[j] < 0 ? (B)1 : (B)0;
+}
+
+template <typename B, typename R>
+void Decoder_RM_FHT<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	this->_load(Y_N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	auto j = 0;
+	auto c = (B)0;
+	this->_decode(j, c);
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	// c + <i,j> is the sum of the all-ones row (N -1) and of the rows (N -1) ^ 2^b for the bits b set in j
+	std::fill(this->U_N.begin(), this->U_N.end(), (B)0);
+	auto parity = c;
+	for (auto b = 0; b < this->m; b++)
+		if ((j >> b) & 1)
+		{
+			this->U_N[(this->N -1) ^ (1 << b)] = (B)1;
+			parity ^= (B)1;
+		}
+	this->U_N[this->N -1] = parity;
+
+	auto k = 0;
+	for (auto i = 0; i < this->N; i++)
+		if (!this->frozen_bits[i])
+			V_K[k++] = this->U_N[i];
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_RM_FHT<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	this->_load(Y_N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	auto j = 0;
+	auto c = (B)0;
+	this->_decode(j, c);
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	V_N[0] = c;
+	for (auto b = 0; b < this->m; b++)
+	{
+		const auto bit = (B)((j >> b) & 1);
+		for (auto i = 0; i < (1 << b); i++)
+			V_N[(1 << b) + i] = V_N[i] ^ bit;
+	}
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_RM_FHT<B_8,Q_8>;
+template class aff3ct::module::Decoder_RM_FHT<B_16,Q_16>;
+template class aff3ct::module::Decoder_RM_FHT<B_32,Q_32>;
+template class aff3ct::module::Decoder_RM_FHT<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_RM_FHT<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,38 @@
+#ifndef DECODER_RM_FHT_HPP_
+#define DECODER_RM_FHT_HPP_
+
+#include <mipp.h>
+
+#include "Module/Decoder/RM/Decoder_RM.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Maximum likelihood decoder of the first order RM(1,m) Reed-Muller codes (and of the RM(0,m) repetition codes): the
+ * codewords are the affine functions c + <i,j>, their correlations with the LLRs are given by a fast Hadamard
+ * transform of the LLRs and the decoder selects the largest one (in absolute value).
+ */
+template <typename B = int, typename R = float>
+class Decoder_RM_FHT : public Decoder_RM<B,R>
+{
+protected:
+	using A = typename Decoder_RM<B,R>::A;
+
+	mipp::vector<A> Y_N_fht;
+
+public:
+	Decoder_RM_FHT(const int& K, const int& N, const int n_frames = 1);
+	virtual ~Decoder_RM_FHT() = default;
+
+protected:
+	void _load          (const R *Y_N                            );
+	void _decode        (int &j, B &c                            );
+	void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+};
+}
+}
+
+#endif /* DECODER_RM_FHT_HPP_ */
@@ -0,0 +1,382 @@
+#include <cmath>
+#include <string>
+#include <sstream>
+#include <algorithm>
+#include <numeric>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/fht.h"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Module/Decoder/RM/Decoder_RM_RLD.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+namespace
+{
+// LLRs of u in (u+v|v)
+template <typename R>
+inline void f_plotkin(const R *l, R *l_u, const int n_2)
+{
+	auto i = 0;
+	if (n_2 >= mipp::nElReg<R>())
+		for (; i < n_2; i += mipp::nElReg<R>())
+		{
+			const auto r_a = mipp::Reg<R>(&l[      i]);
+			const auto r_b = mipp::Reg<R>(&l[n_2 + i]);
+			const auto r_f = mipp::copysign(mipp::min(mipp::abs(r_a), mipp::abs(r_b)),
+			                                mipp::sign(r_a) ^ mipp::sign(r_b));
+			r_f.store(&l_u[i]);
+		}
+	for (; i < n_2; i++)
+		l_u[i] = tools::f_LLR(l[i], l[n_2 + i]);
+}
+
+// LLRs of v in (u+v|v) knowing u
+template <typename B, typename R>
+inline void g_plotkin(const R *l, const B *u, R *l_v, const int n_2)
+{
+	auto i = 0;
+	if (n_2 >= mipp::nElReg<R>())
+		for (; i < n_2; i += mipp::nElReg<R>())
+		{
+			const auto r_a = mipp::Reg<R>(&l[      i]);
+			const auto r_b = mipp::Reg<R>(&l[n_2 + i]);
+			const auto r_u = mipp::Reg<B>(&u[      i]);
+			// clip to 'sat_vals' like the scalar tail, or the fixed-point LLRs reach the type bounds in the recursion
+			const auto r_g = tools::v_LLR_r(mipp::neg(r_a, r_u != mipp::Reg<B>((B)0)), r_b);
+			r_g.store(&l_v[i]);
+		}
+	for (; i < n_2; i++)
+		l_v[i] = tools::g_LLR<B,R>(l[i], l[n_2 + i], u[i]);
+}
+
+template <typename A>
+inline A sum_abs(const A *l, const int n)
+{
+	auto i = 0;
+	auto sum = (A)0;
+	if (n >= mipp::nElReg<A>())
+	{
+		auto r_sum = mipp::Reg<A>((A)0);
+		for (; i < n; i += mipp::nElReg<A>())
+			r_sum += mipp::abs(mipp::Reg<A>(&l[i]));
+		sum = mipp::hadd(r_sum);
+	}
+	for (; i < n; i++)
+		sum += (A)std::abs(l[i]);
+	return sum;
+}
+}
+
+template <typename B, typename R>
+Decoder_RM_RLD<B,R>
+::Decoder_RM_RLD(const int& K, const int& N, const int& L, const int n_frames)
+: Decoder        (K, N, n_frames, 1),
+  Decoder_RM<B,R>(K, N, n_frames),
+  L(L),
+  Y_N_buf(N),
+  llr(L),
+  s(L),
+  metrics(L),
+  paths(L),
+  n_active(0),
+  n_cands(L),
+  leaf_fht(N)
+{
+	const std::string name = "Decoder_RM_RLD";
+	this->set_name(name);
+
+	if (L <= 0)
+	{
+		std::stringstream message;
+		message << "'L' has to be positive ('L' = " << L << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto p = 0; p < L; p++)
+	{
+		llr[p].resize(this->m +1);
+		s  [p].resize(this->m +1);
+		for (auto d = 1; d <= this->m; d++)
+			llr[p][d].resize(this->N >> d);
+		for (auto d = 0; d <= this->m; d++)
+			s[p][d].resize(this->N >> d);
+	}
+
+	cands.reserve(2 * L * N);
+}
+
+template <typename B, typename R>
+const R* Decoder_RM_RLD<B,R>
+::get_llr(const int path, const int depth) const
+{
+	return depth ? this->llr[path][depth].data() : this->Y_N_buf.data();
+}
+
+template <typename B, typename R>
+void Decoder_RM_RLD<B,R>
+::_load(const R *Y_N)
+{
+	std::copy(Y_N, Y_N + this->N, this->Y_N_buf.begin());
+
+	for (auto p = 0; p < this->L; p++)
+		this->paths[p] = p;
+	this->n_active = 1;
+	this->metrics[0] = (A)0;
+}
+
+template <typename B, typename R>
+int Decoder_RM_RLD<B,R>
+::_decode()
+{
+	this->recursive_decode(0, this->r);
+
+	auto best = this->paths[0];
+	for (auto a = 1; a < this->n_active; a++)
+		if (this->metrics[this->paths[a]] < this->metrics[best])
+			best = this->paths[a];
+
+	return best;
+}
+
+template <typename B, typename R>
+void Decoder_RM_RLD<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	this->_load(Y_N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	const auto best = this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	this->_store(this->s[best][0].data(), V_K);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_RM_RLD<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	this->_load(Y_N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	const auto best = this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	std::copy(this->s[best][0].begin(), this->s[best][0].end(), V_N);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_RM_RLD<B,R>
+::recursive_decode(const int depth, const int order)
+{
+	if (order >= this->m - depth) // full code
+	{
+		this->leaf_full(depth);
+		return;
+	}
+
+	if (order <= 1) // first order or repetition code
+	{
+		this->leaf_first_order(depth, order);
+		return;
+	}
+
+	const auto n_2 = (this->N >> depth) >> 1;
+
+	for (auto a = 0; a < this->n_active; a++)
+	{
+		const auto p = this->paths[a];
+		f_plotkin(this->get_llr(p, depth), this->llr[p][depth +1].data(), n_2);
+	}
+
+	this->recursive_decode(depth +1, order -1); // u in RM(r-1,m-1)
+
+	for (auto a = 0; a < this->n_active; a++)
+	{
+		const auto p = this->paths[a];
+		std::copy(this->s[p][depth +1].begin(), this->s[p][depth +1].end(), this->s[p][depth].begin());
+		g_plotkin(this->get_llr(p, depth), this->s[p][depth].data(), this->llr[p][depth +1].data(), n_2);
+	}
+
+	this->recursive_decode(depth +1, order); // v in RM(r,m-1)
+
+	for (auto a = 0; a < this->n_active; a++)
+	{
+		const auto p = this->paths[a];
+		auto s_cur = this->s[p][depth   ].data();
+		auto s_v   = this->s[p][depth +1].data();
+		for (auto i = 0; i < n_2; i++)
+		{
+			s_cur[      i] ^= s_v[i];
+			s_cur[n_2 + i]  = s_v[i];
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_RM_RLD<B,R>
+::leaf_first_order(const int depth, const int order)
+{
+	const auto n = this->N >> depth;
+
+	this->cands.clear();
+	for (auto a = 0; a < this->n_active; a++)
+	{
+		const auto p = this->paths[a];
+		const auto l = this->get_llr(p, depth);
+
+		std::copy(l, l + n, this->leaf_fht.begin());
+		const auto sum = this->L > 1 ? sum_abs(this->leaf_fht.data(), n) : (A)0;
+
+		// leaf_fht[j] is the correlation between the LLRs and the codeword <i,j>
+		const auto n_j = order ? n : 1;
+		if (order)
+			tools::fht(this->leaf_fht.data(), n);
+		else
+			this->leaf_fht[0] = std::accumulate(this->leaf_fht.begin(), this->leaf_fht.begin() + n, (A)0);
+
+		if (this->L == 1)
+		{
+			auto j = 0;
+			for (auto k = 1; k < n_j; k++)
+				if (std::abs(this->leaf_fht[k]) > std::abs(this->leaf_fht[j]))
+					j = k;
+			this->cands.push_back({this->metrics[p], p, p, j, this->leaf_fht[j] < 0 ? 1 : 0});
+		}
+		else
+			for (auto j = 0; j < n_j; j++)
+			{
+				this->cands.push_back({this->metrics[p] + sum - this->leaf_fht[j], p, p, j, 0});
+				this->cands.push_back({this->metrics[p] + sum + this->leaf_fht[j], p, p, j, 1});
+			}
+	}
+
+	this->select_paths(depth);
+
+	// c + <i,j> is built bit after bit of 'i'
+	for (auto &c : this->cands)
+	{
+		auto x = this->s[c.dst][depth].data();
+		x[0] = (B)c.b;
+		for (auto b = 0; (1 << b) < n; b++)
+		{
+			const auto bit = (B)((c.a >> b) & 1);
+			for (auto i = 0; i < (1 << b); i++)
+				x[(1 << b) + i] = x[i] ^ bit;
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_RM_RLD<B,R>
+::leaf_full(const int depth)
+{
+	const auto n = this->N >> depth;
+
+	this->cands.clear();
+	for (auto a = 0; a < this->n_active; a++)
+	{
+		const auto p = this->paths[a];
+		this->cands.push_back({this->metrics[p], p, p, -1, -1});
+
+		if (this->L > 1)
+		{
+			// the hard decision and the flips of the two least reliable bits
+			const auto l = this->get_llr(p, depth);
+			auto i1 = 0, i2 = -1;
+			for (auto i = 1; i < n; i++)
+				if (std::abs(l[i]) < std::abs(l[i1])) { i2 = i1; i1 = i; }
+				else if (i2 == -1 || std::abs(l[i]) < std::abs(l[i2])) i2 = i;
+
+			const auto m1 = (A)2 * (A)std::abs(l[i1]);
+			this->cands.push_back({this->metrics[p] + m1, p, p, i1, -1});
+			if (i2 != -1)
+			{
+				const auto m2 = (A)2 * (A)std::abs(l[i2]);
+				this->cands.push_back({this->metrics[p] + m2,      p, p, i2, -1});
+				this->cands.push_back({this->metrics[p] + m1 + m2, p, p, i1, i2});
+			}
+		}
+	}
+
+	this->select_paths(depth);
+
+	for (auto &c : this->cands)
+	{
+		const auto l = this->get_llr(c.src, depth);
+		auto x = this->s[c.dst][depth].data();
+		for (auto i = 0; i < n; i++)
+			x[i] = l[i] < 0 ? (B)1 : (B)0;
+		if (c.a != -1) x[c.a] ^= (B)1;
+		if (c.b != -1) x[c.b] ^= (B)1;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_RM_RLD<B,R>
+::select_paths(const int depth)
+{
+	if ((int)this->cands.size() > this->L)
+	{
+		std::partial_sort(this->cands.begin(), this->cands.begin() + this->L, this->cands.end(),
+		                  [](const Candidate &x, const Candidate &y) { return x.metric < y.metric; });
+		this->cands.resize(this->L);
+	}
+
+	for (auto a = 0; a < this->n_active; a++)
+		this->n_cands[this->paths[a]] = 0;
+	for (auto &c : this->cands)
+		this->n_cands[c.src]++;
+
+	// the paths without candidate are freed
+	for (auto a = 0; a < this->n_active; )
+		if (this->n_cands[this->paths[a]] == 0)
+			std::swap(this->paths[a], this->paths[--this->n_active]);
+		else
+			a++;
+
+	// each path keeps its first candidate, the next ones go to copies of the path
+	for (auto &c : this->cands)
+	{
+		if (this->n_cands[c.src] > 0)
+			this->n_cands[c.src] = -this->n_cands[c.src]; // mark the path as kept
+		else
+		{
+			c.dst = this->paths[this->n_active++];
+			for (auto d = 1; d < depth; d++)
+				std::copy(this->llr[c.src][d].begin(), this->llr[c.src][d].end(), this->llr[c.dst][d].begin());
+			for (auto d = 0; d < depth; d++)
+				std::copy(this->s[c.src][d].begin(), this->s[c.src][d].end(), this->s[c.dst][d].begin());
+		}
+		this->metrics[c.dst] = c.metric;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_RM_RLD<B_8,Q_8>;
+template class aff3ct::module::Decoder_RM_RLD<B_16,Q_16>;
+template class aff3ct::module::Decoder_RM_RLD<B_32,Q_32>;
+template class aff3ct::module::Decoder_RM_RLD<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_RM_RLD<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
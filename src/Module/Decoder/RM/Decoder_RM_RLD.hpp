@@ -0,0 +1,67 @@
+#ifndef DECODER_RM_RLD_HPP_
+#define DECODER_RM_RLD_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Module/Decoder/RM/Decoder_RM.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Recursive list decoder (Dumer) of the RM(r,m) Reed-Muller codes. The code is split with the Plotkin construction
+ * (u+v|v), u in RM(r-1,m-1) and v in RM(r,m-1), until the first order (decoded with a fast Hadamard transform), the
+ * repetition or the full codes are reached. Up to 'L' paths are kept at each of these leaves. With 'L' = 1 it is the
+ * recursive successive decoding.
+ */
+template <typename B = int, typename R = float>
+class Decoder_RM_RLD : public Decoder_RM<B,R>
+{
+protected:
+	using A = typename Decoder_RM<B,R>::A;
+
+	struct Candidate
+	{
+		A   metric; // path metric of the candidate (twice the sum of the |LLRs| that disagree with the decisions)
+		int src;    // the path which is extended
+		int dst;    // the path which receives the candidate
+		int a;      // first order & repetition leaves: 'j' in c + <i,j>  / full leaves: first flipped bit (or -1)
+		int b;      // first order & repetition leaves: 'c' in c + <i,j>  / full leaves: second flipped bit (or -1)
+	};
+
+	const int L; // maximum number of paths
+
+	mipp::vector<R>                           Y_N_buf;  // the channel LLRs (the LLRs at depth 0 of every path)
+	std::vector<std::vector<mipp::vector<R>>> llr;      // [path][depth] LLRs of the current node of each depth
+	std::vector<std::vector<mipp::vector<B>>> s;        // [path][depth] codeword of the current node of each depth
+	std::vector<A>                            metrics;  // path metrics (the smaller the better)
+	std::vector<int>                          paths;    // the 'n_active' first paths are active, the others are free
+	int                                       n_active;
+	std::vector<int>                          n_cands;  // number of selected candidates per path
+	std::vector<Candidate>                    cands;
+	mipp::vector<A>                           leaf_fht;
+
+public:
+	Decoder_RM_RLD(const int& K, const int& N, const int& L = 1, const int n_frames = 1);
+	virtual ~Decoder_RM_RLD() = default;
+
+protected:
+	void _load          (const R *Y_N                            );
+	int  _decode        (                                        );
+	void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+
+	void recursive_decode(const int depth, const int order);
+
+	void leaf_first_order(const int depth, const int order);
+	void leaf_full       (const int depth                  );
+	void select_paths    (const int depth                  );
+
+	inline const R* get_llr(const int path, const int depth) const;
+};
+}
+}
+
+#endif /* DECODER_RM_RLD_HPP_ */
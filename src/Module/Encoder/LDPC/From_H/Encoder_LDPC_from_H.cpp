@@ -56,6 +56,24 @@ Encoder_LDPC_from_H<B>
 	this->check_H_dimensions();
 }
 
+template <typename B>
+Encoder_LDPC_from_H<B>
+::Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &_H, const tools::Sparse_matrix &_G,
+                      const std::vector<uint32_t> &info_bits_pos, const int n_frames)
+: Encoder_LDPC<B>(K, N, n_frames)
+{
+	const std::string name = "Encoder_LDPC_from_H";
+	this->set_name(name);
+
+	// G has already been generated from H (see 'tools::LDPC_descriptor')
+	this->H             = _H.turn(tools::Matrix::Way::HORIZONTAL);
+	this->G             = _G;
+	this->info_bits_pos = info_bits_pos;
+
+	this->check_G_dimensions();
+	this->check_H_dimensions();
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -1,7 +1,9 @@
 #ifndef ENCODER_LDPC_FROM_H_HPP_
 #define ENCODER_LDPC_FROM_H_HPP_
 
+#include <cstdint>
 #include <string>
+#include <vector>
 #include <thread>
 
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
@@ -22,6 +24,8 @@ public:
 	Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const std::string& G_method = "FAST",
 	                    const std::string& G_save_path = "", const bool G_save_path_single_thread = true,
 	                    const int n_frames = 1);
+	Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const tools::Sparse_matrix &G,
+	                    const std::vector<uint32_t> &info_bits_pos, const int n_frames = 1);
 	virtual ~Encoder_LDPC_from_H() = default;
 };
 
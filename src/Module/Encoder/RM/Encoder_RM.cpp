@@ -0,0 +1,82 @@
+#include <cmath>
+#include <string>
+#include <algorithm>
+
+#include "Tools/Code/RM/rm_functions.h"
+#include "Module/Encoder/RM/Encoder_RM.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B>
+Encoder_RM<B>
+::Encoder_RM(const int& K, const int& N, const int n_frames)
+: Encoder<B>(K, N, n_frames),
+  m((int)std::log2(N)),
+  r(tools::rm_order(K, N)),
+  frozen_bits(tools::rm_frozen_bits(r, m)),
+  X_N_tmp(this->N)
+{
+	const std::string name = "Encoder_RM";
+	this->set_name(name);
+	this->set_sys(false);
+
+	auto k = 0;
+	for (auto n = 0; n < this->N; n++)
+		if (!frozen_bits[n])
+			this->info_bits_pos[k++] = n;
+}
+
+template <typename B>
+int Encoder_RM<B>
+::get_order() const
+{
+	return this->r;
+}
+
+template <typename B>
+void Encoder_RM<B>
+::_encode(const B *U_K, B *X_N, const int frame_id)
+{
+	auto k = 0;
+	for (auto i = 0; i < this->N; i++)
+		this->X_N_tmp[i] = frozen_bits[i] ? (B)0 : U_K[k++];
+
+	for (auto h = (this->N >> 1); h > 0; h >>= 1)
+		for (auto j = 0; j < this->N; j += 2 * h)
+			for (auto i = 0; i < h; i++)
+				this->X_N_tmp[j + i] ^= this->X_N_tmp[h + j + i];
+
+	std::copy(this->X_N_tmp.begin(), this->X_N_tmp.end(), X_N);
+}
+
+template <typename B>
+bool Encoder_RM<B>
+::is_codeword(const B *X_N)
+{
+	// the Arikan kernel is its own inverse
+	std::copy(X_N, X_N + this->N, this->X_N_tmp.begin());
+
+	for (auto h = (this->N >> 1); h > 0; h >>= 1)
+		for (auto j = 0; j < this->N; j += 2 * h)
+			for (auto i = 0; i < h; i++)
+				this->X_N_tmp[j + i] ^= this->X_N_tmp[h + j + i];
+
+	for (auto i = 0; i < this->N; i++)
+		if (frozen_bits[i] && this->X_N_tmp[i])
+			return false;
+
+	return true;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Encoder_RM<B_8>;
+template class aff3ct::module::Encoder_RM<B_16>;
+template class aff3ct::module::Encoder_RM<B_32>;
+template class aff3ct::module::Encoder_RM<B_64>;
+#else
+template class aff3ct::module::Encoder_RM<B>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,39 @@
+#ifndef ENCODER_RM_HPP_
+#define ENCODER_RM_HPP_
+
+#include <vector>
+
+#include "Module/Encoder/Encoder.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Non-systematic RM(r,m) Reed-Muller encoder: the codeword is the product of the information bits (placed on the
+ * rows of weight >= 2^(m-r)) by the m-th Kronecker power of the Arikan kernel, like a polar code.
+ */
+template <typename B = int>
+class Encoder_RM : public Encoder<B>
+{
+protected:
+	const int               m;           // log_2 of code length
+	const int               r;           // order of the code
+	const std::vector<bool> frozen_bits; // true means frozen, false means set to 0/1
+	      std::vector<B>    X_N_tmp;
+
+public:
+	Encoder_RM(const int& K, const int& N, const int n_frames = 1);
+	virtual ~Encoder_RM() = default;
+
+	int get_order() const;
+
+	bool is_codeword(const B *X_N);
+
+protected:
+	virtual void _encode(const B *U_K, B *X_N, const int frame_id);
+};
+}
+}
+
+#endif // ENCODER_RM_HPP_
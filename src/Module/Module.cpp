@@ -109,6 +109,12 @@ void Module
 	task.create_codelet(codelet);
 }
 
+void Module
+::set_padding(Socket& socket, const size_t n_elmts)
+{
+	socket.get_task().set_padding(socket, n_elmts * socket.get_datatype_size());
+}
+
 void Module
 ::register_timer(Task& task, const std::string &key)
 {
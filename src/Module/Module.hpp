@@ -96,6 +96,8 @@ protected:
 
 	void create_codelet(Task& task, std::function<int(void)> codelet);
 
+	void set_padding(Socket& socket, const size_t n_elmts);
+
 	void register_timer(Task& task, const std::string &key);
 };
 }
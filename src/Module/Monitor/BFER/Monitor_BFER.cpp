@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <sstream>
@@ -9,12 +10,28 @@
 using namespace aff3ct;
 using namespace aff3ct::module;
 
+namespace
+{
+// the per-thread counters have a single writer: a relaxed load/store pair is enough and avoids a locked instruction
+inline void add_relaxed(std::atomic<unsigned long long>& counter, const unsigned long long val)
+{
+	counter.store(counter.load(std::memory_order_relaxed) + val, std::memory_order_relaxed);
+}
+
+inline unsigned long long load_relaxed(const std::atomic<unsigned long long>& counter)
+{
+	return counter.load(std::memory_order_relaxed);
+}
+}
+
 template <typename B>
 Monitor_BFER<B>
 ::Monitor_BFER(const int K, const unsigned max_fe, const unsigned max_n_frames,
                const bool count_unknown_values, const int n_frames)
 : Monitor(n_frames), K(K), max_fe(max_fe), max_n_frames(max_n_frames),
-  count_unknown_values(count_unknown_values), err_hist(0), err_hist_activated(false)
+  count_unknown_values(count_unknown_values),
+  err_hist(0, 0, std::max(K, 0)), // a frame has between 0 and K wrong bits: flat bins, no allocation in 'check_errors'
+  err_hist_activated(false)
 {
 	const std::string name = "Monitor_BFER";
 	this->set_name(name);
@@ -115,6 +132,9 @@ int Monitor_BFER<B>
 		                            V + f * get_K(),
 		                            f);
 
+	if (this->global != nullptr && get_max_n_frames() != 0)
+		this->global->n_fra.fetch_add(f_stop - f_start, std::memory_order_relaxed);
+
 	for (auto& c : this->callbacks_check)
 		c();
 
@@ -138,8 +158,11 @@ int Monitor_BFER<B>
 
 	if (bit_errors_count)
 	{
-		vals.n_be += bit_errors_count;
-		vals.n_fe ++;
+		add_relaxed(vals.n_be, bit_errors_count);
+		add_relaxed(vals.n_fe, 1);
+
+		if (this->global != nullptr)
+			this->global->n_fe.fetch_add(1, std::memory_order_relaxed);
 
 		if (err_hist_activated)
 			err_hist.add_value(bit_errors_count);
@@ -148,7 +171,7 @@ int Monitor_BFER<B>
 			c(bit_errors_count, frame_id);
 	}
 
-	vals.n_fra++;
+	add_relaxed(vals.n_fra, 1);
 
 	return bit_errors_count;
 }
@@ -157,14 +180,22 @@ template <typename B>
 bool Monitor_BFER<B>
 ::fe_limit_achieved() const
 {
-	return get_max_fe() != 0 && get_n_fe() >= get_max_fe();
+	if (get_max_fe() == 0)
+		return false;
+
+	const auto n_fe = (this->global != nullptr) ? load_relaxed(this->global->n_fe) : get_n_fe();
+	return n_fe >= get_max_fe();
 }
 
 template <typename B>
 bool Monitor_BFER<B>
 ::frame_limit_achieved() const
 {
-	return get_max_n_frames() != 0 && get_n_analyzed_fra() >= get_max_n_frames();
+	if (get_max_n_frames() == 0)
+		return false;
+
+	const auto n_fra = (this->global != nullptr) ? load_relaxed(this->global->n_fra) : get_n_analyzed_fra();
+	return n_fra >= get_max_n_frames();
 }
 
 template <typename B>
@@ -177,10 +208,14 @@ bool Monitor_BFER<B>
 
 
 template <typename B>
-const typename Monitor_BFER<B>::Attributes& Monitor_BFER<B>
+typename Monitor_BFER<B>::Attributes Monitor_BFER<B>
 ::get_attributes() const
 {
-	return vals;
+	Attributes a;
+	a.n_fra = load_relaxed(vals.n_fra);
+	a.n_be  = load_relaxed(vals.n_be );
+	a.n_fe  = load_relaxed(vals.n_fe );
+	return a;
 }
 
 template <typename B>
@@ -208,21 +243,21 @@ template <typename B>
 unsigned long long Monitor_BFER<B>
 ::get_n_analyzed_fra() const
 {
-	return vals.n_fra;
+	return load_relaxed(vals.n_fra);
 }
 
 template <typename B>
 unsigned long long Monitor_BFER<B>
 ::get_n_fe() const
 {
-	return vals.n_fe;
+	return load_relaxed(vals.n_fe);
 }
 
 template <typename B>
 unsigned long long Monitor_BFER<B>
 ::get_n_be() const
 {
-	return vals.n_be;
+	return load_relaxed(vals.n_be);
 }
 
 template <typename B>
@@ -271,6 +306,13 @@ void Monitor_BFER<B>
 	err_hist_activated = val;
 }
 
+template<typename B>
+void Monitor_BFER<B>
+::set_global_counters(std::shared_ptr<Global_counters> counters)
+{
+	this->global = counters;
+}
+
 
 
 template <typename B>
@@ -303,6 +345,9 @@ void Monitor_BFER<B>
 	Monitor::reset();
 	vals.reset();
 
+	if (this->global != nullptr)
+		this->global->reset();
+
 	this->err_hist.reset();
 }
 
@@ -340,7 +385,15 @@ template <typename B>
 void Monitor_BFER<B>
 ::collect(const Attributes& v)
 {
-	vals += v;
+	add_relaxed(vals.n_be,  v.n_be );
+	add_relaxed(vals.n_fe,  v.n_fe );
+	add_relaxed(vals.n_fra, v.n_fra);
+
+	if (this->global != nullptr)
+	{
+		this->global->n_fe .fetch_add(v.n_fe,  std::memory_order_relaxed);
+		this->global->n_fra.fetch_add(v.n_fra, std::memory_order_relaxed);
+	}
 }
 
 template <typename B>
@@ -376,7 +429,9 @@ template <typename B>
 void Monitor_BFER<B>
 ::copy(const Attributes& v)
 {
-	vals = v;
+	vals.n_be .store(v.n_be,  std::memory_order_relaxed);
+	vals.n_fe .store(v.n_fe,  std::memory_order_relaxed);
+	vals.n_fra.store(v.n_fra, std::memory_order_relaxed);
 }
 
 template <typename B>
@@ -415,6 +470,37 @@ Monitor_BFER<B>::Attributes
 	reset();
 }
 
+template <typename B>
+void Monitor_BFER<B>::Counters
+::reset()
+{
+	n_be .store(0, std::memory_order_relaxed);
+	n_fe .store(0, std::memory_order_relaxed);
+	n_fra.store(0, std::memory_order_relaxed);
+}
+
+template <typename B>
+Monitor_BFER<B>::Counters
+::Counters()
+{
+	reset();
+}
+
+template <typename B>
+void Monitor_BFER<B>::Global_counters
+::reset()
+{
+	n_fe .store(0, std::memory_order_relaxed);
+	n_fra.store(0, std::memory_order_relaxed);
+}
+
+template <typename B>
+Monitor_BFER<B>::Global_counters
+::Global_counters()
+{
+	reset();
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
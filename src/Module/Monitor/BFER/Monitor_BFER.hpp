@@ -1,6 +1,7 @@
 #ifndef MONITOR_BFER_HPP_
 #define MONITOR_BFER_HPP_
 
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <functional>
@@ -20,7 +21,23 @@ public:
 	inline Task&   operator[](const mnt::tsk               t) { return Module::operator[]((int)t);                              }
 	inline Socket& operator[](const mnt::sck::check_errors s) { return Module::operator[]((int)mnt::tsk::check_errors)[(int)s]; }
 
-protected:
+	/*!
+	 * \brief Counters shared by all the monitors of a reduction group.
+	 *
+	 * They are bumped by the threads only on a frame error (and once per checked batch when a frame limit is set)
+	 * so the stop criteria can be checked at any time without waiting for a reduction.
+	 */
+	struct Global_counters
+	{
+		char pad_before[64]; // avoid false sharing with the neighbour data
+		std::atomic<unsigned long long> n_fra;
+		std::atomic<unsigned long long> n_fe;
+		char pad_after[64];
+
+		Global_counters();
+		void reset();
+	};
+
 	struct Attributes
 	{
 		unsigned long long n_fra;           // the number of checked frames
@@ -38,7 +55,22 @@ private:
 	const unsigned max_n_frames;         // max number of frames to check then frame_limit_achieved() returns true else if 0
 	const bool     count_unknown_values; // take into account or not the unknown values as wrong values in the checked frames
 
-	Attributes vals;
+	// per-thread counters: only written by the owner thread and read by the reduction (relaxed atomics prevent torn
+	// reads), padded to prevent false sharing between the monitors of the different threads
+	struct Counters
+	{
+		char pad_before[64];
+		std::atomic<unsigned long long> n_fra;
+		std::atomic<unsigned long long> n_be;
+		std::atomic<unsigned long long> n_fe;
+		char pad_after[64];
+
+		Counters();
+		void reset();
+	};
+
+	Counters vals;
+	std::shared_ptr<Global_counters> global; // if set, used to decide if the stop criteria are reached
 	tools::Histogram<int> err_hist; // the error histogram record
 	bool err_hist_activated;
 
@@ -73,7 +105,7 @@ public:
 	bool frame_limit_achieved() const;
 	virtual bool is_done() const;
 
-	const Attributes&     get_attributes          () const;
+	Attributes            get_attributes          () const;
 	int                   get_K                   () const;
 	bool                  get_count_unknown_values() const;
 	unsigned              get_max_fe              () const;
@@ -87,6 +119,14 @@ public:
 	tools::Histogram<int> get_err_hist            () const;
 	void activate_err_histogram(bool val);
 
+	/*!
+	 * \brief Shares global counters with other monitors: fe_limit_achieved() and frame_limit_achieved() then rely on
+	 *        the counters of all the monitors in the group instead of the ones of this monitor.
+	 *
+	 * \param counters: the shared counters, nullptr to come back to the local counters.
+	 */
+	void set_global_counters(std::shared_ptr<Global_counters> counters);
+
 	virtual void add_handler_fe               (std::function<void(unsigned, int )> callback);
 	virtual void add_handler_check            (std::function<void(          void)> callback);
 	virtual void add_handler_fe_limit_achieved(std::function<void(          void)> callback);
@@ -20,7 +20,6 @@ public:
 	inline Task&   operator[](const mnt::tsk                  t) { return Module::operator[]((int)t);                                 }
 	inline Socket& operator[](const mnt::sck::get_mutual_info s) { return Module::operator[]((int)mnt::tsk::get_mutual_info)[(int)s]; }
 
-protected:
 	struct Attributes
 	{
 		unsigned long long n_trials; // Number of checked trials
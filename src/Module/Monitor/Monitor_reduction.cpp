@@ -10,12 +10,24 @@
 using namespace aff3ct;
 using namespace aff3ct::module;
 
-bool                                                                         aff3ct::module::Monitor_reduction::stop_loop = false;
+std::atomic<bool>                                                            aff3ct::module::Monitor_reduction::stop_loop(false);
 std::vector<aff3ct::module::Monitor_reduction*>                              aff3ct::module::Monitor_reduction::monitors;
 std::thread::id                                                              aff3ct::module::Monitor_reduction::master_thread_id = std::this_thread::get_id();
 std::chrono::nanoseconds                                                     aff3ct::module::Monitor_reduction::d_reduce_frequency = std::chrono::milliseconds(1000);
+bool                                                                         aff3ct::module::Monitor_reduction::all_process_on_last = false;
+bool                                                                         aff3ct::module::Monitor_reduction::mpi_reduction = true;
 std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds> aff3ct::module::Monitor_reduction::t_last_reduction;
 
+#ifdef AFF3CT_MPI
+namespace
+{
+// state of the non-blocking reduction of the stop loop flags
+MPI_Request stop_request = MPI_REQUEST_NULL;
+int         stop_send    = 0;
+int         n_stop_recv  = 0;
+}
+#endif
+
 Monitor_reduction
 ::Monitor_reduction()
 {
@@ -96,44 +108,93 @@ void Monitor_reduction
 #endif
 }
 
-bool Monitor_reduction
+void Monitor_reduction
 ::reduce_stop_loop()
 {
 #ifdef AFF3CT_MPI
-	int n_stop_recv, stop_send = Monitor_reduction::get_stop_loop() ? 1 : 0;
-	MPI_Allreduce(&stop_send, &n_stop_recv, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+	if (!Monitor_reduction::mpi_reduction)
+	{
+		Monitor_reduction::all_process_on_last = true;
+		return;
+	}
 
-	if (n_stop_recv > 0)
-		Monitor_reduction::set_stop_loop();
+	stop_send = Monitor_reduction::get_stop_loop() ? 1 : 0;
+	if (auto ret = MPI_Iallreduce(&stop_send, &n_stop_recv, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD, &stop_request))
+	{
+		std::stringstream message;
+		message << "'MPI_Iallreduce' returned '" << ret << "' error code.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+#else
+	Monitor_reduction::all_process_on_last = true;
+#endif
+}
 
-	int np;
-	MPI_Comm_size(MPI_COMM_WORLD, &np);
+bool Monitor_reduction
+::complete_reductions(bool wait)
+{
+	bool completed = true;
 
-	return n_stop_recv == np;
-#else
-	return true;
+	for (auto& m : Monitor_reduction::monitors)
+		completed &= m->_reduce_complete(wait);
+
+#ifdef AFF3CT_MPI
+	if (stop_request != MPI_REQUEST_NULL)
+	{
+		int flag = 1;
+		if (wait)
+			MPI_Wait(&stop_request, MPI_STATUS_IGNORE);
+		else
+			MPI_Test(&stop_request, &flag, MPI_STATUS_IGNORE);
+
+		if (flag)
+		{
+			if (n_stop_recv > 0)
+				Monitor_reduction::set_stop_loop();
+
+			int np;
+			MPI_Comm_size(MPI_COMM_WORLD, &np);
+
+			Monitor_reduction::all_process_on_last = n_stop_recv == np;
+		}
+		else
+			completed = false;
+	}
 #endif
+
+	return completed;
 }
 
 bool Monitor_reduction
 ::__reduce__(bool fully, bool force)
 {
-	bool all_process_on_last = false;
-
 	// only the master thread can do this
 	if (force || (std::this_thread::get_id() == Monitor_reduction::master_thread_id &&
 	              (std::chrono::steady_clock::now() - Monitor_reduction::t_last_reduction) >=
 	               Monitor_reduction::d_reduce_frequency))
 	{
+		// with MPI, the collective operations have to be started in the same order by all the processes: a new
+		// reduction is started only once the previous one is completed
+		if (!Monitor_reduction::complete_reductions(force))
+			return false;
+
+		Monitor_reduction::all_process_on_last = false;
+
 		for (auto& m : Monitor_reduction::monitors)
 			m->_reduce(fully);
 
-		all_process_on_last = reduce_stop_loop();
+		Monitor_reduction::reduce_stop_loop();
 
 		Monitor_reduction::t_last_reduction = std::chrono::steady_clock::now();
+
+		if (force)
+		{
+			Monitor_reduction::complete_reductions(true);
+			return Monitor_reduction::all_process_on_last;
+		}
 	}
 
-	return all_process_on_last;
+	return false;
 }
 
 void Monitor_reduction
@@ -148,6 +209,18 @@ void Monitor_reduction
 	Monitor_reduction::d_reduce_frequency = d;
 }
 
+void Monitor_reduction
+::set_mpi_reduction(bool enable)
+{
+	Monitor_reduction::mpi_reduction = enable;
+}
+
+bool Monitor_reduction
+::get_mpi_reduction()
+{
+	return Monitor_reduction::mpi_reduction;
+}
+
 bool Monitor_reduction
 ::get_stop_loop()
 {
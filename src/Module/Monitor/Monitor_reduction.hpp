@@ -1,6 +1,7 @@
 #ifndef MONITOR_REDUCTION_HPP_
 #define MONITOR_REDUCTION_HPP_
 
+#include <atomic>
 #include <thread>
 #include <chrono>
 #include <vector>
@@ -17,10 +18,12 @@ namespace module
 class Monitor_reduction
 {
 private:
-	static bool                            stop_loop;
+	static std::atomic<bool>               stop_loop;
 	static std::vector<Monitor_reduction*> monitors;
 	static std::thread::id                 master_thread_id;
 	static std::chrono::nanoseconds        d_reduce_frequency;
+	static bool                            all_process_on_last;
+	static bool                            mpi_reduction;
 
 	static std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds> t_last_reduction;
 
@@ -53,6 +56,14 @@ public:
 
 	static void set_reduce_frequency(std::chrono::nanoseconds d);
 
+	/*
+	 * \brief enable or disable the reductions between the MPI processes (when disabled the monitors are only reduced
+	 *        inside the process, e.g. when the work is distributed by a master process)
+	 */
+	static void set_mpi_reduction(bool enable);
+
+	static bool get_mpi_reduction();
+
 	/*
 	 * \brief get if the current simulation loop must be stopped or not
 	 * \return true if loop must be stopped
@@ -90,6 +101,13 @@ protected:
 	 */
 	virtual bool is_done_mr() = 0;
 
+	/*
+	 * \brief complete the reduction started by '_reduce' if it is not done synchronously
+	 * \param wait if set, block until the reduction is completed
+	 * \return true if the reduction is completed
+	 */
+	virtual bool _reduce_complete(bool wait = false) = 0;
+
 private:
 	/*
 	 * \brief add the monitor in the 'monitors' list
@@ -97,17 +115,26 @@ private:
 	static void add_monitor(Monitor_reduction*);
 
 	/*
-	 * \brief do a reduction of the number of process that are at the final reduce step
-	 * \return true if all process are at the final reduce step (always true without MPI)
+	 * \brief start a reduction of the number of process that are at the final reduce step
 	 */
-	static bool reduce_stop_loop();
+	static void reduce_stop_loop();
+
+	/*
+	 * \brief complete the pending reductions of the 'monitors' and of the stop loop flags (with MPI the reductions
+	 *        are non-blocking: the simulation goes on while they are in progress)
+	 * \param wait if set, block until the reductions are completed
+	 * \return true if there is no pending reduction anymore
+	 */
+	static bool complete_reductions(bool wait);
 
 	/*
 	 * \brief do the reductions of all 'monitors' if the thread calling it is the master thread and if the
-	 *        'd_reduce_frequency' criteria is reached.
-	 * \param force if set, do the reduction anyway
+	 *        'd_reduce_frequency' criteria is reached. A new reduction is started only when the previous one is
+	 *        completed.
+	 * \param force if set, do the reduction anyway and wait for its completion
 	 * \param fully if set, do a full reduction of all attributes
-	 * \return the result of the 'reduce_stop_loop()' call after the reductions. If there were not, then return false.
+	 * \return true if all process are at the final reduce step after a forced reduction (always true without MPI),
+	 *         else return false.
 	 */
 	static bool __reduce__(bool fully, bool force);
 };
@@ -136,6 +163,14 @@ public:
 protected:
 	virtual void _reduce(bool fully = false);
 
+	virtual bool _reduce_complete(bool wait = false);
+
+	/*
+	 * \brief reset the collecter and collect in it the data of all the monitors
+	 * \return the collecter
+	 */
+	const M& collect_all(bool fully = false);
+
 	/*
 	 * \brief call reset()
 	 */
@@ -95,6 +95,20 @@ void Monitor_reduction_M<M>
 template <class M>
 void Monitor_reduction_M<M>
 ::_reduce(bool fully)
+{
+	M::copy(this->collect_all(fully), fully);
+}
+
+template <class M>
+bool Monitor_reduction_M<M>
+::_reduce_complete(bool wait)
+{
+	return true;
+}
+
+template <class M>
+const M& Monitor_reduction_M<M>
+::collect_all(bool fully)
 {
 	// Old slow way to collect data (with object allocation)
 	// M collecter(*this);
@@ -110,7 +124,7 @@ void Monitor_reduction_M<M>
 	for (auto& m : this->monitors)
 		collecter.collect(*m, fully);
 
-	M::copy(collecter, fully);
+	return collecter;
 }
 
 }
@@ -22,6 +22,9 @@ protected:
 private:
 	MPI_Datatype MPI_monitor_vals;
 	MPI_Op       MPI_Op_reduce_monitors;
+	MPI_Request  request;
+	Attributes   mvals_send;
+	Attributes   mvals_recv;
 
 public:
 	explicit Monitor_reduction_MPI(const std::vector<std::unique_ptr<M>> &monitors);
@@ -30,8 +33,13 @@ public:
 	virtual void reset();
 
 protected:
+	/*
+	 * \brief collect the local monitors and start a non-blocking reduction with the other processes
+	 */
 	virtual void _reduce(bool fully = false);
 
+	virtual bool _reduce_complete(bool wait = false);
+
 private:
 	static void MPI_reduce_monitors(void *in, void *inout, int *len, MPI_Datatype *datatype);
 };
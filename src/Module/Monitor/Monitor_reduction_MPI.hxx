@@ -16,7 +16,8 @@ namespace module
 template <class M>
 Monitor_reduction_MPI<M>
 ::Monitor_reduction_MPI(const std::vector<std::unique_ptr<M>> &monitors)
-: Monitor_reduction_M<M>(monitors)
+: Monitor_reduction_M<M>(monitors),
+  request(MPI_REQUEST_NULL)
 {
 	const std::string name = "Monitor_reduction_MPI<" + monitors[0]->get_name() + ">";
 	this->set_name(name);
@@ -51,14 +52,42 @@ template <class M>
 void Monitor_reduction_MPI<M>
 ::_reduce(bool fully)
 {
+	if (!Monitor_reduction::get_mpi_reduction())
+	{
+		Monitor_reduction_M<M>::_reduce(fully);
+		return;
+	}
+
 	fully = false;
 
-	Monitor_reduction_M<M>::_reduce(fully);
+	mvals_send = this->collect_all(fully).get_attributes();
+
+	if (auto ret = MPI_Iallreduce(&mvals_send, &mvals_recv, 1, MPI_monitor_vals, MPI_Op_reduce_monitors, MPI_COMM_WORLD,
+	                              &request))
+	{
+		std::stringstream message;
+		message << "'MPI_Iallreduce' returned '" << ret << "' error code.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <class M>
+bool Monitor_reduction_MPI<M>
+::_reduce_complete(bool wait)
+{
+	if (request == MPI_REQUEST_NULL)
+		return true;
+
+	int flag = 1;
+	if (wait)
+		MPI_Wait(&request, MPI_STATUS_IGNORE);
+	else
+		MPI_Test(&request, &flag, MPI_STATUS_IGNORE);
 
-	Attributes mvals_send = M::get_attributes(), mvals_recv;
-	MPI_Allreduce(&mvals_send, &mvals_recv, 1, MPI_monitor_vals, MPI_Op_reduce_monitors, MPI_COMM_WORLD);
+	if (flag)
+		M::copy(mvals_recv);
 
-	M::copy(mvals_recv);
+	return flag != 0;
 }
 
 template <class M>
@@ -24,11 +24,18 @@ protected:
 	const size_t          databytes;
 	      bool            fast;
 	      void*           dataptr;
+	      size_t          padbytes;     // number of addressable bytes after the data (zeros, for the padded frames)
+	      size_t          padbytes_req; // number of bytes of padding requested by this socket
+
+	Socket*              bound_socket;  // the socket this socket is bound to (nullptr if unbound or bound to a ptr)
+	std::vector<Socket*> bound_sockets; // the sockets bound to this socket
 
 public:
 	inline Socket(Task &task, const std::string &name, const std::type_index datatype, const size_t databytes,
 	              const bool fast = false, void *dataptr = nullptr);
 
+	inline ~Socket();
+
 	inline std::string     get_name           () const;
 	inline std::type_index get_datatype       () const;
 	inline std::string     get_datatype_string() const;
@@ -36,7 +43,13 @@ public:
 	inline size_t          get_databytes      () const;
 	inline size_t          get_n_elmts        () const;
 	inline void*           get_dataptr        () const;
+	inline size_t          get_padbytes       () const;
+	inline size_t          get_padbytes_req   () const;
 	inline bool            is_fast            () const;
+	inline Task&           get_task           () const;
+
+	inline Socket*                     get_bound_socket () const;
+	inline const std::vector<Socket*>& get_bound_sockets() const;
 
 	inline void set_fast(const bool fast);
 
@@ -59,6 +72,13 @@ public:
 	inline int bind(void* dataptr);
 
 	inline int operator()(void* dataptr);
+
+	inline void unbind();
+
+protected:
+	inline void request_padding(const size_t padbytes);
+
+	inline void update_dataptr(void* dataptr, const size_t padbytes);
 };
 }
 }
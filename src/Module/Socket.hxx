@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <sstream>
 
 #include "Tools/Exception/exception.hpp"
@@ -24,10 +25,19 @@ static std::unordered_map<std::type_index,uint8_t> type_to_size = {{typeid(int8_
 Socket
 ::Socket(Task &task, const std::string &name, const std::type_index datatype, const size_t databytes,
          const bool fast, void *dataptr)
-: task(task), name(name), datatype(datatype), databytes(databytes), fast(fast), dataptr(dataptr)
+: task(task), name(name), datatype(datatype), databytes(databytes), fast(fast), dataptr(dataptr),
+  padbytes(0), padbytes_req(0), bound_socket(nullptr)
 {
 }
 
+Socket
+::~Socket()
+{
+	this->unbind();
+	for (auto s : this->bound_sockets)
+		s->bound_socket = nullptr;
+}
+
 std::string Socket
 ::get_name() const
 {
@@ -70,12 +80,42 @@ void* Socket
 	return dataptr;
 }
 
+size_t Socket
+::get_padbytes() const
+{
+	return padbytes;
+}
+
+size_t Socket
+::get_padbytes_req() const
+{
+	return padbytes_req;
+}
+
 bool Socket
 ::is_fast() const
 {
 	return fast;
 }
 
+Task& Socket
+::get_task() const
+{
+	return task;
+}
+
+Socket* Socket
+::get_bound_socket() const
+{
+	return bound_socket;
+}
+
+const std::vector<Socket*>& Socket
+::get_bound_sockets() const
+{
+	return bound_sockets;
+}
+
 void Socket
 ::set_fast(const bool fast)
 {
@@ -125,7 +165,13 @@ int Socket
 		}
 	}
 
+	this->unbind();
+	if (this->padbytes_req > s.padbytes)
+		s.request_padding(this->padbytes_req);
 	this->dataptr = s.dataptr;
+	this->padbytes = s.padbytes;
+	this->bound_socket = &s;
+	s.bound_sockets.push_back(this);
 
 	if (this->task.is_autoexec() && this->task.is_last_input_socket(*this))
 		return this->task.exec();
@@ -145,7 +191,9 @@ int Socket
 {
 	if (is_fast())
 	{
+		this->unbind();
 		this->dataptr = static_cast<void*>(vector.data());
+		this->padbytes = 0;
 		return 0;
 	}
 
@@ -177,7 +225,9 @@ int Socket
 {
 	if (is_fast())
 	{
+		this->unbind();
 		this->dataptr = static_cast<void*>(array);
+		this->padbytes = 0;
 		return 0;
 	}
 
@@ -216,7 +266,9 @@ int Socket
 		}
 	}
 
+	this->unbind();
 	this->dataptr = dataptr;
+	this->padbytes = 0;
 
 	return 0;
 }
@@ -226,5 +278,35 @@ int Socket
 {
 	return bind(dataptr);
 }
+
+void Socket
+::unbind()
+{
+	if (this->bound_socket != nullptr)
+	{
+		auto &bs = this->bound_socket->bound_sockets;
+		bs.erase(std::remove(bs.begin(), bs.end(), this), bs.end());
+		this->bound_socket = nullptr;
+	}
+}
+
+void Socket
+::request_padding(const size_t padbytes)
+{
+	// the padding can only be allocated by the task which owns the data, go up to it
+	if (this->bound_socket != nullptr)
+		this->bound_socket->request_padding(padbytes);
+	else if (this->task.get_socket_type(*this) == socket_t::SOUT)
+		this->task.set_padding(*this, padbytes);
+}
+
+void Socket
+::update_dataptr(void* dataptr, const size_t padbytes)
+{
+	this->dataptr  = dataptr;
+	this->padbytes = padbytes;
+	for (auto s : this->bound_sockets)
+		s->update_dataptr(dataptr, padbytes);
+}
 }
 }
@@ -13,6 +13,14 @@ Source_random<B>
 	this->set_name(name);
 }
 
+template <typename B>
+void Source_random<B>
+::set_seed(const int seed)
+{
+	this->rd_engine.seed(seed);
+	this->uniform_dist.reset();
+}
+
 template <typename B>
 void Source_random<B>
 ::_generate(B *U_K, const int frame_id)
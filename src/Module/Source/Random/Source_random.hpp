@@ -26,6 +26,8 @@ public:
 
 	virtual ~Source_random() = default;
 
+	virtual void set_seed(const int seed);
+
 protected:
 	void _generate(B *U_K, const int frame_id);
 };
@@ -15,6 +15,15 @@ Source_random_fast<B>
 	const std::string name = "Source_random_fast";
 	this->set_name(name);
 
+	this->set_seed(seed);
+}
+
+template <typename B>
+void Source_random_fast<B>
+::set_seed(const int seed)
+{
+	mt19937.seed(seed);
+
 	mipp::vector<int> seeds(mipp::nElReg<int>());
 	for (auto i = 0; i < mipp::nElReg<int>(); i++)
 		seeds[i] = mt19937.rand();
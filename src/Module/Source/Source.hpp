@@ -64,6 +64,13 @@ public:
 
 	virtual int get_K() const;
 
+	/*!
+	 * \brief Sets the seed of the random generator (nothing is done if the Source does not draw random bits).
+	 *
+	 * \param seed: the new seed.
+	 */
+	virtual void set_seed(const int seed);
+
 	/*!
 	 * \brief Fulfills a vector with bits.
 	 *
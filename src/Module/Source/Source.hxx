@@ -42,6 +42,12 @@ int Source<B>
 	return K;
 }
 
+template <typename B>
+void Source<B>
+::set_seed(const int seed)
+{
+}
+
 template <typename B>
 template <class A>
 void Source<B>
@@ -49,20 +49,51 @@ void Task
 			this->out_buffers.clear();
 			for (auto& s : sockets)
 				if (get_socket_type(*s) == socket_t::SOUT)
-					s->dataptr = nullptr;
+				{
+					s->dataptr  = nullptr;
+					s->padbytes = 0;
+				}
 		}
 		else
 		{
 			for (auto& s : sockets)
 				if (get_socket_type(*s) == socket_t::SOUT)
 				{
-					out_buffers.push_back(mipp::vector<uint8_t>(s->databytes));
-					s->dataptr = out_buffers.back().data();
+					out_buffers.push_back(mipp::vector<uint8_t>(s->databytes + s->padbytes_req));
+					s->dataptr  = out_buffers.back().data();
+					s->padbytes = s->padbytes_req;
 				}
 		}
 	}
 }
 
+void Task
+::set_padding(Socket &s, const size_t padbytes)
+{
+	if (padbytes <= s.padbytes_req)
+		return;
+
+	s.padbytes_req = padbytes;
+
+	if (get_socket_type(s) != socket_t::SOUT || s.bound_socket != nullptr)
+	{
+		// the socket does not own its data: the padding is requested to the producer
+		if (s.bound_socket != nullptr && s.padbytes < padbytes)
+			s.bound_socket->request_padding(padbytes);
+	}
+	else if (is_autoalloc())
+	{
+		size_t b = 0;
+		for (size_t i = 0; i < sockets.size() && sockets[i].get() != &s; i++)
+			if (socket_type[i] == socket_t::SOUT)
+				b++;
+
+		// the new padded frames are zeros, the data are kept and the bound sockets follow the new buffer
+		out_buffers[b].resize(s.databytes + padbytes);
+		s.update_dataptr(out_buffers[b].data(), padbytes);
+	}
+}
+
 void Task
 ::set_autoexec(const bool autoexec)
 {
@@ -406,8 +437,9 @@ Socket& Task
 	// memory allocation
 	if (is_autoalloc())
 	{
-		out_buffers.push_back(mipp::vector<uint8_t>(s.get_databytes()));
-		s.dataptr = out_buffers.back().data();
+		out_buffers.push_back(mipp::vector<uint8_t>(s.get_databytes() + s.padbytes_req));
+		s.dataptr  = out_buffers.back().data();
+		s.padbytes = s.padbytes_req;
 	}
 
 	return s;
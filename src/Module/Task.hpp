@@ -123,6 +123,15 @@ protected:
 
 	void create_codelet(std::function<int(void)> &codelet);
 
+	/*!
+	 * \brief Requests 'padbytes' bytes of padding after the data of a socket (the padding can only grow).
+	 *
+	 * For an output socket, the padding is allocated after the output buffer (if the task is in autoalloc mode).
+	 * For an input socket, the padding is requested to the output socket it is bound to (now or when it will be
+	 * bound): 'Socket::get_padbytes()' tells how much padding is actually available.
+	 */
+	void set_padding(Socket &s, const size_t padbytes);
+
 private:
 	template <typename T>
 	inline Socket& create_socket(const std::string &name, const size_t n_elmts);
@@ -1,17 +1,27 @@
 #include <functional>
 #include <algorithm>
 #include <iostream>
+#include <cstring>
+#include <random>
 #include <sstream>
 #include <fstream>
 #include <iomanip>
 #include <thread>
 #include <string>
+#include <cstdio>
+#include <map>
 #include <ios>
 
+#ifdef AFF3CT_MPI
+#include <mpi.h>
+#endif
+
 #include "Tools/general_utils.h"
 #include "Tools/system_functions.h"
+#include "Tools/Thread_pinning/Thread_pinning.hpp"
 #include "Tools/Display/rang_format/rang_format.h"
 #include "Tools/Display/Statistics/Statistics.hpp"
+#include "Tools/Display/Terminal/JSON/Terminal_JSON.hpp"
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/Reporter/MI/Reporter_MI.hpp"
 #include "Tools/Display/Reporter/BFER/Reporter_BFER.hpp"
@@ -34,7 +44,12 @@ BFER<B,R,Q>
 
   monitor_mi(params_BFER.n_threads),
   monitor_er(params_BFER.n_threads),
-  dumper    (params_BFER.n_threads)
+  dumper    (params_BFER.n_threads),
+
+  team_size((size_t)params_BFER.cdc->dec->get_n_threads()),
+
+  noise_idx_cur(0),
+  master_thread_id(std::this_thread::get_id())
 {
 	if (params_BFER.n_threads < 1)
 	{
@@ -46,9 +61,11 @@ BFER<B,R,Q>
 	if (params_BFER.err_track_enable)
 	{
 		for (auto tid = 0; tid < params_BFER.n_threads; tid++)
-			dumper[tid].reset(new tools::Dumper());
+			dumper[tid].reset(new tools::Dumper((unsigned)params_BFER.err_track_max,
+			                                    (unsigned)params_BFER.err_track_sampling,
+			                                    (size_t  )params_BFER.err_track_queue));
 
-		dumper_red.reset(new tools::Dumper_reduction(dumper));
+		dumper_red.reset(new tools::Dumper_reduction(dumper, (unsigned)params_BFER.err_track_max));
 	}
 
 	if (!params_BFER.noise->pdf_path.empty())
@@ -56,6 +73,75 @@ BFER<B,R,Q>
 		                                                tools::Distribution_mode::SUMMATION,
 		                                                params_BFER.mdm->rop_est_bits > 0));
 
+	if (params_BFER.pin_policy != "NO")
+	{
+		size_t first_pu = 0;
+#ifdef AFF3CT_MPI
+		// the processes of a node allowed on the same PUs (not bound by the MPI launcher) would compute the same
+		// mapping: each process skips the PUs of the processes of lower rank which share its PUs
+		MPI_Comm node_comm;
+		MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, params_BFER.mpi_rank, MPI_INFO_NULL, &node_comm);
+
+		int node_rank, node_size;
+		MPI_Comm_rank(node_comm, &node_rank);
+		MPI_Comm_size(node_comm, &node_size);
+
+		std::stringstream pus;
+		for (auto &pu : tools::Thread_pinning::get_topology())
+			pus << pu.id << ",";
+		unsigned long long pus_key = std::hash<std::string>()(pus.str());
+		int n_threads = params_BFER.n_threads * (int)team_size;
+
+		std::vector<unsigned long long> node_pus_keys (node_size);
+		std::vector<int               > node_n_threads(node_size);
+		MPI_Allgather(&pus_key,   1, MPI_UNSIGNED_LONG_LONG, node_pus_keys .data(), 1, MPI_UNSIGNED_LONG_LONG, node_comm);
+		MPI_Allgather(&n_threads, 1, MPI_INT,                node_n_threads.data(), 1, MPI_INT,                node_comm);
+		MPI_Comm_free(&node_comm);
+
+		for (auto r = 0; r < node_rank; r++)
+			if (node_pus_keys[r] == pus_key)
+				first_pu += (size_t)node_n_threads[r];
+#endif
+		thread_pus = tools::Thread_pinning::get_mapping(params_BFER.pin_policy, params_BFER.pin_no_smt,
+		                                                 (size_t)params_BFER.n_threads, first_pu, team_size);
+		master_affinity = tools::Thread_pinning::get_affinity();
+	}
+
+	if (params_BFER.resume)
+	{
+		if (params_BFER.mnt_er->err_hist != -1)
+		{
+			std::stringstream message;
+			message << "The error histogram is not saved in the checkpoint file, it can not be computed when a "
+			        << "simulation is resumed ('mnt_er->err_hist' = " << params_BFER.mnt_er->err_hist << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->load_checkpoint();
+	}
+
+#ifdef AFF3CT_MPI
+	if (params_BFER.mpi_dynamic)
+	{
+		if (params_BFER.mnt_er->err_hist != -1)
+		{
+			std::stringstream message;
+			message << "The error histogram is not sent to the master process, it can not be computed with the "
+			        << "dynamic MPI scheduling ('mnt_er->err_hist' = " << params_BFER.mnt_er->err_hist << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		// the master process merges the results of the units: the monitors are only reduced inside the processes
+		module::Monitor_reduction::set_mpi_reduction(false);
+
+		const auto result_size = sizeof(typename Monitor_BFER_type::Attributes) +
+		                         sizeof(typename Monitor_MI_type  ::Attributes);
+		this->scheduler.reset(new tools::Work_scheduler_MPI(params_BFER.n_threads, result_size));
+		this->units     .resize(params_BFER.n_threads, {tools::Work_scheduler_MPI::NONE, 0});
+		this->units_left.resize(params_BFER.n_threads, 0);
+	}
+#endif
+
 	this->build_monitors ();
 	this->build_reporters();
 
@@ -72,6 +158,7 @@ void BFER<B,R,Q>
 		threads[tid -1] = std::thread(BFER<B,R,Q>::start_thread_build_comm_chain, this, tid);
 
 	BFER<B,R,Q>::start_thread_build_comm_chain(this, 0);
+	this->unpin_master_thread();
 
 	// join the slave threads with the master thread
 	for (auto tid = 1; tid < params_BFER.n_threads; tid++)
@@ -82,6 +169,30 @@ template <typename B, typename R, typename Q>
 void BFER<B,R,Q>
 ::launch()
 {
+	if (!thread_pus.empty())
+	{
+#ifdef AFF3CT_MPI
+		if (params_BFER.mpi_rank == 0)
+#endif
+		{
+			tools::Thread_pinning::show(thread_pus, std::cout);
+			std::cout << "#" << std::endl;
+		}
+	}
+
+	if (params_BFER.autotune)
+	{
+		this->noise.reset(params_BFER.noise->template build<R>(params_BFER.noise->range[0], bit_rate,
+		                                                       params_BFER.mdm->bps, params_BFER.mdm->cpm_upf));
+		if (this->distributions != nullptr)
+			this->distributions->read_distribution(this->noise->get_noise());
+
+		this->autotune();
+
+		if (tools::Terminal::is_over())
+			return;
+	}
+
 	if (!params_BFER.err_track_revert)
 	{
 		this->build_communication_chain();
@@ -90,6 +201,17 @@ void BFER<B,R,Q>
 			return;
 	}
 
+	if (params_BFER.bench)
+	{
+		this->noise.reset(params_BFER.noise->template build<R>(params_BFER.noise->range[0], bit_rate,
+		                                                       params_BFER.mdm->bps, params_BFER.mdm->cpm_upf));
+		if (this->distributions != nullptr)
+			this->distributions->read_distribution(this->noise->get_noise());
+
+		this->bench();
+		return;
+	}
+
 	int noise_begin = 0;
 	int noise_end   = (int)params_BFER.noise->range.size();
 	int noise_step  = 1;
@@ -100,9 +222,22 @@ void BFER<B,R,Q>
 		noise_step  = -1;
 	}
 
+	if (this->chkpt.loaded)
+		noise_begin = this->chkpt.noise_idx;
+
 	// for each NOISE to be simulated
 	for (auto noise_idx = noise_begin; noise_idx != noise_end; noise_idx += noise_step)
 	{
+#ifdef AFF3CT_MPI
+		// with the dynamic scheduling, the workers simulate the noise points of the units given by the master
+		if (this->scheduler != nullptr && !this->scheduler->is_master())
+		{
+			noise_idx = this->next_noise_point(noise_step);
+			if (noise_idx == tools::Work_scheduler_MPI::STOP)
+				break;
+		}
+#endif
+
 		this->noise.reset(params_BFER.noise->template build<R>(params_BFER.noise->range[noise_idx], bit_rate,
 		                                                       params_BFER.mdm->bps, params_BFER.mdm->cpm_upf));
 
@@ -146,7 +281,16 @@ void BFER<B,R,Q>
 			this->build_communication_chain();
 
 			if (tools::Terminal::is_over())
-				return;
+				break;
+		}
+
+		// the frames captured asynchronously are written in the dump files during the noise point
+		if (this->dumper_red != nullptr && params_BFER.err_track_queue)
+		{
+			std::stringstream s_noise;
+			s_noise << std::setprecision(2) << std::fixed << this->noise->get_noise();
+
+			this->dumper_red->open(params_BFER.err_track_path + "_" + s_noise.str());
 		}
 
 #ifdef AFF3CT_MPI
@@ -166,9 +310,30 @@ void BFER<B,R,Q>
 			terminal->start_temp_report(params_BFER.ter->frequency);
 
 		this->t_start_noise_point = std::chrono::steady_clock::now();
+		this->t_last_checkpoint   = this->t_start_noise_point;
+		this->noise_idx_cur       = noise_idx;
+
+		if (this->chkpt.loaded)
+		{
+			// restore the counters of the interrupted noise point (the checkpoint contains the reduced values)
+#ifdef AFF3CT_MPI
+			if (params_BFER.mpi_rank == 0)
+#endif
+			{
+				this->monitor_er[0]->collect(this->chkpt.er);
+				if (this->monitor_mi_red != nullptr)
+					this->monitor_mi[0]->collect(this->chkpt.mi);
+			}
+			this->chkpt.loaded = false;
+		}
 
 		try
 		{
+#ifdef AFF3CT_MPI
+			if (this->scheduler != nullptr && this->scheduler->is_master())
+				this->serve_noise_point();
+			else
+#endif
 			this->_launch();
 			module::Monitor_reduction::is_done_all(true, true); // final reduction
 		}
@@ -208,12 +373,33 @@ void BFER<B,R,Q>
 				std::cout << "#" << std::endl;
 				tools::Stats::show(mod_vec, true, std::cout);
 				std::cout << "#" << std::endl;
+
+				// the machine readable terminal also writes the statistics as a record
+				auto terminal_json = dynamic_cast<tools::Terminal_JSON*>(terminal.get());
+				if (terminal_json != nullptr)
+					terminal_json->statistics(mod_vec);
 			}
 		}
 
-		if (!params_BFER.crit_nostop && !params_BFER.err_track_revert && !tools::Terminal::is_interrupt() &&
-		    !this->monitor_er_red->fe_limit_achieved() &&
-		    (this->monitor_er_red->frame_limit_achieved() || this->stop_time_reached()))
+		bool stop_sweep = !params_BFER.crit_nostop && !params_BFER.err_track_revert &&
+		                  !tools::Terminal::is_interrupt() && !this->monitor_er_red->fe_limit_achieved() &&
+		                  (this->monitor_er_red->frame_limit_achieved() || this->stop_time_reached());
+
+#ifdef AFF3CT_MPI
+		// the workers only hold the results of their last units: the sweep is stopped by the master
+		if (this->scheduler != nullptr && !this->scheduler->is_master())
+			stop_sweep = false;
+#endif
+
+		if (params_BFER.chkpt_enable && !this->simu_error)
+		{
+			if (tools::Terminal::is_interrupt())
+				this->save_checkpoint(noise_idx, true);
+			else
+				this->save_checkpoint(stop_sweep ? noise_end : noise_idx + noise_step, false);
+		}
+
+		if (stop_sweep)
 			tools::Terminal::stop();
 
 
@@ -258,6 +444,16 @@ void BFER<B,R,Q>
 			s_noise << std::setprecision(2) << std::fixed << this->noise->get_noise();
 
 			this->dumper_red->dump(params_BFER.err_track_path + "_" + s_noise.str());
+
+			const auto n_dropped = this->dumper_red->get_n_dropped();
+			if (n_dropped)
+			{
+				std::stringstream message;
+				message << n_dropped << " erroneous frame(s) have not been dumped because the capture queue was full "
+				        << "(noise = " << s_noise.str() << ", consider increasing '--sim-err-trk-queue').";
+				std::clog << rang::tag::warning << message.str() << std::endl;
+			}
+
 			this->dumper_red->clear();
 		}
 
@@ -273,6 +469,11 @@ void BFER<B,R,Q>
 		module::Monitor_reduction::reset_all();
 		tools::Terminal::reset();
 	}
+
+#ifdef AFF3CT_MPI
+	if (this->scheduler != nullptr)
+		this->stop_scheduler();
+#endif
 }
 
 template <typename B, typename R, typename Q>
@@ -338,6 +539,14 @@ void BFER<B,R,Q>
 	// build a monitor to reduce BER/FER from the other monitors
 	this->monitor_er_red.reset(new Monitor_BFER_reduction_type(this->monitor_er));
 
+#ifndef AFF3CT_MPI
+	// share global counters between the monitors: the stop criteria are checked without waiting for a reduction
+	auto er_counters = std::make_shared<typename Monitor_BFER_type::Global_counters>();
+	for (auto tid = 0; tid < params_BFER.n_threads; tid++)
+		this->monitor_er[tid]->set_global_counters(er_counters);
+	this->monitor_er_red->set_global_counters(er_counters);
+#endif
+
 	if (params_BFER.mnt_mutinfo)
 	{
 		// build a monitor to compute MIon each thread
@@ -354,7 +563,12 @@ void BFER<B,R,Q>
 
 	module::Monitor_reduction::set_master_thread_id(std::this_thread::get_id());
 #ifdef AFF3CT_MPI
-	module::Monitor_reduction::set_reduce_frequency(params_BFER.mnt_mpi_comm_freq);
+	// with the dynamic scheduling the reductions are local to the processes: the master checks the stop criteria after
+	// each merged unit
+	if (params_BFER.mpi_dynamic)
+		module::Monitor_reduction::set_reduce_frequency(std::chrono::milliseconds(0));
+	else
+		module::Monitor_reduction::set_reduce_frequency(params_BFER.mnt_mpi_comm_freq);
 #else
 	auto freq = std::chrono::milliseconds(0);
 	if (params_BFER.mnt_red_lazy)
@@ -377,8 +591,17 @@ void BFER<B,R,Q>
 {
 	try
 	{
+		// each chain is built by a thread pinned as the one which will execute it: the memory is allocated (first
+		// touched) on the NUMA node of the thread
+		simu->pin_thread(tid);
+
 		simu->__build_communication_chain(tid);
 
+		for (auto &m : simu->modules)
+			if (m.second[tid] != nullptr)
+				for (auto &t : m.second[tid]->tasks)
+					t->set_autoalloc(true);
+
 		if (simu->params_BFER.err_track_enable)
 			simu->monitor_er[tid]->add_handler_fe(std::bind(&tools::Dumper::add,
 			                                                simu->dumper[tid].get(),
@@ -411,8 +634,19 @@ void BFER<B,R,Q>
 
 template <typename B, typename R, typename Q>
 bool BFER<B,R,Q>
-::keep_looping_noise_point()
+::keep_looping_noise_point(const int tid)
 {
+	if (params_BFER.chkpt_enable && params_BFER.chkpt_freq.count() &&
+	    std::this_thread::get_id() == this->master_thread_id &&
+	    std::chrono::steady_clock::now() - this->t_last_checkpoint >= params_BFER.chkpt_freq)
+		this->save_checkpoint(this->noise_idx_cur, true);
+
+#ifdef AFF3CT_MPI
+	// the frames of the worker processes are given by the master
+	if (this->scheduler != nullptr && !this->scheduler->is_master())
+		return this->keep_looping_unit(tid);
+#endif
+
 	// communication chain execution
 	return !(tools::Terminal::is_interrupt() // if user stopped the simulation
 	         || module::Monitor_reduction::is_done_all() // while any monitor criteria is not reached -> do reduction
@@ -428,6 +662,356 @@ bool BFER<B,R,Q>
 	                                                                     params_BFER.stop_time;
 }
 
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::pin_thread(const int tid) const
+{
+	if (thread_pus.empty())
+		return;
+
+	// the decoder team built by the thread is pinned on the next PUs
+	const auto first = thread_pus.begin() + tid * team_size;
+	tools::Thread_pinning::set_team(team_size > 1 ? std::vector<size_t>(first, first + team_size)
+	                                              : std::vector<size_t>());
+
+	if (!tools::Thread_pinning::pin(*first))
+		std::clog << rang::tag::warning << "The thread " << tid << " could not be pinned." << std::endl;
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::unpin_master_thread() const
+{
+	// the threads created later by the master thread (terminal, writers, ...) inherit its affinity
+	if (!master_affinity.empty() && !tools::Thread_pinning::set_affinity(master_affinity))
+		std::clog << rang::tag::warning << "The affinity of the master thread could not be restored." << std::endl;
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::bench()
+{
+	throw tools::unimplemented_error(__FILE__, __LINE__, __func__, "The benchmark mode is not available for this "
+	                                                               "simulation.");
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::autotune()
+{
+	throw tools::unimplemented_error(__FILE__, __LINE__, __func__, "The autotuning is not available for this "
+	                                                               "simulation.");
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::reseed(const int tid, const int seed)
+{
+	throw tools::unimplemented_error(__FILE__, __LINE__, __func__, "The reseeding of the modules is not available "
+	                                                               "for this simulation.");
+}
+
+#ifdef AFF3CT_MPI
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::serve_noise_point()
+{
+	// the results of the units are merged in the monitors of the first thread: the stop criteria are checked on their
+	// reduction as in a simulation without MPI
+	auto merge = [this](const uint8_t *result)
+	{
+		typename Monitor_BFER_type::Attributes er;
+		std::memcpy((void*)&er, result, sizeof(er));
+		this->monitor_er[0]->collect(er);
+
+		if (this->monitor_mi_red != nullptr)
+		{
+			typename Monitor_MI_type::Attributes mi;
+			std::memcpy((void*)&mi, result + sizeof(er), sizeof(mi));
+			this->monitor_mi[0]->collect(mi);
+		}
+	};
+
+	this->scheduler->serve(this->noise_idx_cur, merge, [this]() { return this->keep_looping_noise_point(); });
+}
+
+template <typename B, typename R, typename Q>
+int BFER<B,R,Q>
+::next_noise_point(const int noise_step)
+{
+	using Scheduler = tools::Work_scheduler_MPI;
+
+	// the next noise point is the first one (in the order of the sweep) of the units of the threads
+	auto noise_idx = Scheduler::STOP;
+	for (auto tid = 0; tid < params_BFER.n_threads; tid++)
+	{
+		if (this->units[tid].noise_idx == Scheduler::NONE)
+			this->fetch_unit(tid);
+
+		const auto n = this->units[tid].noise_idx;
+		if (n >= 0 && (noise_idx == Scheduler::STOP || (n - noise_idx) * noise_step < 0))
+			noise_idx = n;
+	}
+
+	return noise_idx;
+}
+
+template <typename B, typename R, typename Q>
+bool BFER<B,R,Q>
+::keep_looping_unit(const int tid)
+{
+	using Scheduler = tools::Work_scheduler_MPI;
+
+	auto &unit = this->units[tid];
+
+	if (tools::Terminal::is_interrupt())
+	{
+		// the unit is given back to the master which can give it to another process
+		if (unit.noise_idx != Scheduler::STOP)
+		{
+			this->scheduler->release(tid, unit);
+			unit = {Scheduler::STOP, 0};
+		}
+		return false;
+	}
+
+	// the unit is completed: its results are sent to the master with the request of a new unit
+	if (unit.noise_idx == this->noise_idx_cur && this->units_left[tid] == 0)
+		this->fetch_unit(tid);
+
+	// the new unit is for another noise point (or there is no more unit)
+	if (unit.noise_idx != this->noise_idx_cur)
+		return false;
+
+	this->units_left[tid]--;
+	return true;
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::fetch_unit(const int tid)
+{
+	typename Monitor_BFER_type::Attributes er;
+	typename Monitor_MI_type  ::Attributes mi;
+
+	// the monitors of the thread are reset at the beginning of each unit: they contain the results of the unit
+	er = this->monitor_er[tid]->get_attributes();
+	if (this->monitor_mi_red != nullptr)
+		mi = this->monitor_mi[tid]->get_attributes();
+
+	std::vector<uint8_t> result(sizeof(er) + sizeof(mi));
+	std::memcpy(result.data(),              (void*)&er, sizeof(er));
+	std::memcpy(result.data() + sizeof(er), (void*)&mi, sizeof(mi));
+
+	auto &unit = this->units[tid];
+	unit = this->scheduler->next(tid, unit, result.data());
+
+	if (unit.noise_idx >= 0)
+	{
+		const auto n_frames = (unsigned)params_BFER.src->n_frames;
+		this->units_left[tid] = (params_BFER.mpi_unit + n_frames -1) / n_frames;
+
+		this->monitor_er[tid]->reset();
+		if (this->monitor_mi_red != nullptr)
+			this->monitor_mi[tid]->reset();
+
+		// the seed of the unit does not depend on the process or on the thread: the results are reproducible
+		std::seed_seq seq = {params_BFER.global_seed, this->resume_seed_shift(), unit.noise_idx, unit.unit_idx};
+		std::mt19937 rd_engine(seq);
+		this->reseed(tid, (int)rd_engine());
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::stop_scheduler()
+{
+	if (this->scheduler->is_master())
+	{
+		this->scheduler->stop();
+	}
+	else
+	{
+		// the units which will not be simulated are given back to the master
+		for (auto tid = 0; tid < params_BFER.n_threads; tid++)
+			if (this->units[tid].noise_idx != tools::Work_scheduler_MPI::STOP)
+			{
+				this->scheduler->release(tid, this->units[tid]);
+				this->units[tid] = {tools::Work_scheduler_MPI::STOP, 0};
+			}
+	}
+}
+#endif
+
+template <typename B, typename R, typename Q>
+uint64_t BFER<B,R,Q>
+::fingerprint() const
+{
+	// only the parameters that define the code, the channel and the noise are hashed: a simulation can be resumed on
+	// another machine or with another number of threads
+	std::map<std::string,factory::header_list> headers;
+	params_BFER.noise->get_headers(headers, true);
+	if (params_BFER.src != nullptr) params_BFER.src->get_headers(headers, true);
+	if (params_BFER.crc != nullptr) params_BFER.crc->get_headers(headers, true);
+	if (params_BFER.cdc != nullptr) params_BFER.cdc->get_headers(headers, true);
+	if (params_BFER.mdm != nullptr) params_BFER.mdm->get_headers(headers, true);
+	if (params_BFER.chn != nullptr) params_BFER.chn->get_headers(headers, true);
+	if (params_BFER.qnt != nullptr) params_BFER.qnt->get_headers(headers, true);
+
+	auto &hsim = headers[params_BFER.get_prefix()];
+	hsim.push_back(std::make_pair("Seed",             std::to_string(params_BFER.global_seed     )));
+	hsim.push_back(std::make_pair("Coset approach",   std::to_string(params_BFER.coset           )));
+	hsim.push_back(std::make_pair("Coded monitoring", std::to_string(params_BFER.coded_monitoring)));
+
+	// FNV-1a hash of the parameters
+	uint64_t hash = 14695981039346656037ull;
+	auto add = [&hash](const std::string &str)
+	{
+		for (auto c : str)
+		{
+			hash ^= (uint8_t)c;
+			hash *= 1099511628211ull;
+		}
+		hash ^= 0xff; // separator
+		hash *= 1099511628211ull;
+	};
+
+	for (auto &h : headers)
+	{
+		add(h.first);
+		for (auto &kv : h.second)
+		{
+			add(kv.first);
+			add(kv.second);
+		}
+	}
+
+	return hash;
+}
+
+template <typename B, typename R, typename Q>
+int BFER<B,R,Q>
+::resume_seed_shift() const
+{
+	// the states of the PRNGs can not be restored: the seeds of the random streams (source and channel) are shifted
+	// so the frames already simulated are not played again, the code (encoder, decoder and interleaver) is unchanged
+	return this->chkpt.loaded ? (int)(this->chkpt.generation * 0x9E3779B9u) : 0;
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::load_checkpoint()
+{
+	std::ifstream file(params_BFER.chkpt_path, std::ios::binary);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to read the checkpoint file ('chkpt_path' = " << params_BFER.chkpt_path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	uint64_t fp;
+	char has_mi;
+	file.read((char*)&fp,                    sizeof(fp                   ));
+	file.read((char*)&this->chkpt.noise_idx,  sizeof(this->chkpt.noise_idx ));
+	file.read((char*)&this->chkpt.generation, sizeof(this->chkpt.generation));
+	file.read((char*)&this->chkpt.er,         sizeof(this->chkpt.er        ));
+	file.read((char*)&has_mi,                sizeof(has_mi               ));
+	if (has_mi)
+		file.read((char*)&this->chkpt.mi, sizeof(this->chkpt.mi));
+
+	if (!file)
+	{
+		std::stringstream message;
+		message << "The checkpoint file is truncated ('chkpt_path' = " << params_BFER.chkpt_path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (fp != this->fingerprint())
+	{
+		std::stringstream message;
+		message << "The checkpoint file has been produced by a simulation with different parameters ('chkpt_path' = "
+		        << params_BFER.chkpt_path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto n_noise = (int)params_BFER.noise->range.size();
+	if (this->chkpt.noise_idx < -1 || this->chkpt.noise_idx > n_noise)
+	{
+		std::stringstream message;
+		message << "'chkpt.noise_idx' has to be between -1 and 'n_noise' ('chkpt.noise_idx' = "
+		        << this->chkpt.noise_idx << ", 'n_noise' = " << n_noise << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->chkpt.generation++;
+	this->chkpt.loaded = true;
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::save_checkpoint(const int noise_idx, const bool partial)
+{
+	this->t_last_checkpoint = std::chrono::steady_clock::now();
+
+#ifdef AFF3CT_MPI
+	if (params_BFER.mpi_rank != 0)
+		return;
+#endif
+
+	typename Monitor_BFER_type::Attributes er;
+	typename Monitor_MI_type  ::Attributes mi;
+	if (partial)
+	{
+		er = this->monitor_er_red->get_attributes();
+		if (this->monitor_mi_red != nullptr)
+			mi = this->monitor_mi_red->get_attributes();
+	}
+
+	const uint64_t fp = this->fingerprint();
+	const char has_mi = this->monitor_mi_red != nullptr ? 1 : 0;
+
+	// write in a temporary file first to never leave a corrupted checkpoint if the process is killed
+	const auto tmp_path = params_BFER.chkpt_path + ".tmp";
+	std::ofstream file(tmp_path, std::ios::binary);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to write the checkpoint file ('tmp_path' = " << tmp_path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	file.write((char*)&fp,                    sizeof(fp                   ));
+	file.write((char*)&noise_idx,             sizeof(noise_idx            ));
+	file.write((char*)&this->chkpt.generation, sizeof(this->chkpt.generation));
+	file.write((char*)&er,                    sizeof(er                   ));
+	file.write((char*)&has_mi,                sizeof(has_mi               ));
+	if (has_mi)
+		file.write((char*)&mi, sizeof(mi));
+	file.close();
+
+	if (file.fail())
+	{
+		std::remove(tmp_path.c_str());
+
+		std::stringstream message;
+		message << "Impossible to write the checkpoint file ('tmp_path' = " << tmp_path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the rename does not replace an existing file on Windows
+#if defined(_WIN32) || defined(_WIN64)
+	std::remove(params_BFER.chkpt_path.c_str());
+#endif
+	if (std::rename(tmp_path.c_str(), params_BFER.chkpt_path.c_str()) != 0)
+	{
+		std::stringstream message;
+		message << "Impossible to replace the checkpoint file ('tmp_path' = " << tmp_path << ", 'chkpt_path' = "
+		        << params_BFER.chkpt_path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
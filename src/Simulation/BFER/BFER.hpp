@@ -3,6 +3,8 @@
 
 #include <mutex>
 #include <chrono>
+#include <thread>
+#include <cstdint>
 #include <vector>
 #include <memory>
 
@@ -18,6 +20,7 @@
 #include "Module/Monitor/Monitor_reduction.hpp"
 #ifdef AFF3CT_MPI
 #include "Module/Monitor/Monitor_reduction_MPI.hpp"
+#include "Tools/Work_scheduler/Work_scheduler_MPI.hpp"
 #endif
 #include "Simulation/Simulation.hpp"
 
@@ -74,6 +77,33 @@ protected:
 
 	std::chrono::steady_clock::time_point t_start_noise_point;
 
+	// state saved in and restored from the checkpoint file
+	struct Checkpoint
+	{
+		bool                                   loaded     = false;
+		int                                    noise_idx  = 0;
+		unsigned                               generation = 0; // number of times the simulation has been resumed
+		typename Monitor_BFER_type::Attributes er;
+		typename Monitor_MI_type  ::Attributes mi;
+	} chkpt;
+
+	// PUs of each thread and of its decoder team in the topology (empty if the threads are not pinned)
+	std::vector<size_t> thread_pus;
+	size_t              team_size;
+	// affinity of the master thread before it is pinned (restored when the master thread leaves the chain 0)
+	std::vector<int>    master_affinity;
+
+	int                                   noise_idx_cur;
+	std::thread::id                       master_thread_id;
+	std::chrono::steady_clock::time_point t_last_checkpoint;
+
+#ifdef AFF3CT_MPI
+	// dynamic distribution of the work units by the master process
+	std::unique_ptr<tools::Work_scheduler_MPI>   scheduler;
+	std::vector<tools::Work_scheduler_MPI::Unit> units;      // current unit of each thread (worker process)
+	std::vector<unsigned>                        units_left; // number of chain executions left in the unit of each thread
+#endif
+
 public:
 	explicit BFER(const factory::BFER::parameters& params_BFER);
 	virtual ~BFER() = default;
@@ -84,17 +114,48 @@ protected:
 	virtual void __build_communication_chain(const int tid = 0) = 0;
 	virtual void _launch() = 0;
 
+	/*!
+	 * \brief Runs each task of the communication chain in isolation and reports its performance (benchmark mode).
+	 */
+	virtual void bench();
+
+	/*!
+	 * \brief Selects the fastest decoder implementation for the current code and CPU (autotuning mode).
+	 */
+	virtual void autotune();
+
 	std::unique_ptr<Monitor_MI_type>   build_monitor_mi(const int tid = 0);
 	std::unique_ptr<Monitor_BFER_type> build_monitor_er(const int tid = 0);
 	std::unique_ptr<tools::Terminal>   build_terminal();
 	void build_reporters();
 	void build_monitors ();
 
-	virtual bool keep_looping_noise_point();
+	virtual bool keep_looping_noise_point(const int tid = 0);
 	bool stop_time_reached();
+	void pin_thread(const int tid = 0) const;
+	void unpin_master_thread() const;
+
+	/*!
+	 * \brief Sets new seeds to the modules drawing the frames (source, channel, uniform interleaver) of a thread: the
+	 *        frames of a work unit only depend on its seed (dynamic MPI scheduling).
+	 */
+	virtual void reseed(const int tid, const int seed);
+
+	uint64_t fingerprint      () const;
+	int      resume_seed_shift() const;
+	void     load_checkpoint  ();
+	void     save_checkpoint  (const int noise_idx, const bool partial);
 
 private:
 	static void start_thread_build_comm_chain(BFER<B,R,Q> *simu, const int tid);
+
+#ifdef AFF3CT_MPI
+	void serve_noise_point ();
+	int  next_noise_point  (const int noise_step);
+	bool keep_looping_unit (const int tid);
+	void fetch_unit        (const int tid);
+	void stop_scheduler    ();
+#endif
 };
 }
 }
@@ -150,6 +150,33 @@ void BFER_ite<B,R,Q>
 	}
 }
 
+template <typename B, typename R, typename Q>
+void BFER_ite<B,R,Q>
+::reseed(const int tid, const int seed)
+{
+	std::mt19937 rd_engine(seed);
+
+	this->source [tid]->set_seed(rd_engine());
+	this->channel[tid]->set_seed(rd_engine());
+
+	if (this->interleaver_core[tid]->is_uniform())
+	{
+		this->interleaver_core[tid]->set_seed(rd_engine());
+		this->interleaver_core[tid]->refresh();
+	}
+
+	try
+	{
+		auto& interleaver = codec[tid]->get_interleaver(); // can raise an exceptions
+		if (interleaver->is_uniform())
+		{
+			interleaver->set_seed(rd_engine());
+			interleaver->refresh();
+		}
+	}
+	catch (const std::exception&) { /* do nothing if there is no interleaver */ }
+}
+
 template <typename B, typename R, typename Q>
 std::unique_ptr<module::Source<B>> BFER_ite<B,R,Q>
 ::build_source(const int tid)
@@ -157,7 +184,7 @@ std::unique_ptr<module::Source<B>> BFER_ite<B,R,Q>
 	const auto seed_src = rd_engine_seed[tid]();
 
 	std::unique_ptr<factory::Source::parameters> params_src(params_BFER_ite.src->clone());
-	params_src->seed = seed_src;
+	params_src->seed = seed_src + this->resume_seed_shift();
 
 	return std::unique_ptr<module::Source<B>>(params_src->template build<B>());
 }
@@ -226,7 +253,7 @@ std::unique_ptr<module::Channel<R>> BFER_ite<B,R,Q>
 	const auto seed_chn = rd_engine_seed[tid]();
 
 	std::unique_ptr<factory::Channel::parameters> params_chn(params_BFER_ite.chn->clone());
-	params_chn->seed = seed_chn;
+	params_chn->seed = seed_chn + this->resume_seed_shift();
 
 	if (this->distributions != nullptr)
 		return std::unique_ptr<module::Channel<R>>(params_chn->template build<R>(*this->distributions));
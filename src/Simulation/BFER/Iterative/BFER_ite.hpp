@@ -50,6 +50,7 @@ public:
 protected:
 	virtual void __build_communication_chain(const int tid = 0);
 	virtual void _launch();
+	virtual void reseed(const int tid, const int seed);
 
 	virtual std::unique_ptr<module::Source          <B    >> build_source     (const int tid = 0);
 	virtual std::unique_ptr<module::CRC             <B    >> build_crc        (const int tid = 0);
@@ -0,0 +1,292 @@
+#include <string>
+
+#include "Factory/Module/Coset/Coset.hpp"
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Dataflow/Dataflow.hpp"
+#include "Tools/Dataflow/Duplicator.hpp"
+#include "Tools/Dataflow/Router.hpp"
+#include "Tools/Dataflow/Funnel.hpp"
+#include "Tools/Dataflow/Predicate_node.hpp"
+#include "Simulation/BFER/Iterative/Dataflow/BFER_ite_dataflow.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::simulation;
+
+template <typename B, typename R, typename Q>
+BFER_ite_dataflow<B,R,Q>
+::BFER_ite_dataflow(const factory::BFER_ite::parameters &params_BFER_ite)
+: BFER_ite<B,R,Q>(params_BFER_ite),
+  coset_real_i(params_BFER_ite.n_threads),
+  predicate   (params_BFER_ite.n_threads),
+  nodes       (params_BFER_ite.n_threads),
+  channels    (params_BFER_ite.n_threads),
+  sources     (params_BFER_ite.n_threads, nullptr)
+{
+	if (params_BFER_ite.coded_monitoring)
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The dataflow simulation does not support the "
+		                                                            "coded monitoring.");
+
+	// in the pipelined chain, the first frames of a noise point are received and checked while the next frames are
+	// already generated: the frames cannot be dumped from the buffers of the source, the encoder and the channel
+	if (params_BFER_ite.dataflow_queue && params_BFER_ite.err_track_enable)
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The pipelined dataflow simulation does not "
+		                                                            "support the error tracking.");
+
+	// the tasks are executed by the threads of the dataflow runtime, which are not bound to the chains
+	if (params_BFER_ite.pin_policy != "NO")
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The dataflow simulation does not support the "
+		                                                            "thread pinning.");
+
+#ifdef AFF3CT_MPI
+	// the stop condition of the dataflow is shared by the threads: the frames can not be counted per thread
+	if (params_BFER_ite.mpi_dynamic)
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The dataflow simulation does not support the "
+		                                                            "dynamic MPI scheduling.");
+#endif
+
+	this->add_module("coset_real_i", params_BFER_ite.n_threads);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_ite_dataflow<B,R,Q>
+::__build_communication_chain(const int tid)
+{
+	BFER_ite<B,R,Q>::__build_communication_chain(tid);
+
+	this->set_module("coset_real_i", tid, coset_real_i[tid]);
+
+	this->interleaver_bit[tid]->set_custom_name(this->interleaver_llr[tid]->get_name() + "_bit");
+	this->interleaver_llr[tid]->set_custom_name(this->interleaver_llr[tid]->get_name() + "_llr");
+
+	// the interleaver is refreshed by the monitor (receiver side) while the next frames are interleaved (transmitter
+	// side) when the chain is pipelined
+	if (this->params_BFER_ite.dataflow_queue && this->interleaver_core[tid]->is_uniform())
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The pipelined dataflow simulation does not "
+		                                                            "support the uniform interleaver.");
+}
+
+template <typename B, typename R, typename Q>
+void BFER_ite_dataflow<B,R,Q>
+::_launch()
+{
+	BFER_ite<B,R,Q>::_launch();
+
+	std::vector<tools::Bounded_channel*> chans;
+	for (auto tid = 0; tid < this->params_BFER_ite.n_threads; tid++)
+	{
+		this->build_graph(tid);
+		if (this->channels[tid] != nullptr)
+			chans.push_back(this->channels[tid].get());
+	}
+
+	tools::Dataflow dataflow(this->sources, chans);
+	dataflow.exec([this]() { return !this->keep_looping_noise_point(); });
+}
+
+template <typename B, typename R, typename Q>
+tools::Task_node& BFER_ite_dataflow<B,R,Q>
+::add_node(const int tid, module::Task &task)
+{
+	auto node = new tools::Task_node(task);
+	this->nodes[tid].push_back(std::unique_ptr<tools::Node>(node));
+	return *node;
+}
+
+template <typename B, typename R, typename Q>
+void BFER_ite_dataflow<B,R,Q>
+::build_graph(const int tid)
+{
+	using namespace module;
+
+	const auto rayleigh = this->params_BFER_ite.chn->type.find("RAYLEIGH") != std::string::npos;
+	const auto coset    = this->params_BFER_ite.coset;
+
+	auto &src = *this->source         [tid];
+	auto &crc = *this->crc            [tid];
+	auto &enc = *this->codec          [tid]->get_encoder();
+	auto &itb = *this->interleaver_bit[tid];
+	auto &itl = *this->interleaver_llr[tid];
+	auto &mdm = *this->modem          [tid];
+	auto &chn = *this->channel        [tid];
+	auto &qnt = *this->quantizer      [tid];
+	auto &csr = *this->coset_real     [tid];
+	auto &csi = *this->coset_real_i   [tid];
+	auto &dch = *this->codec          [tid]->get_decoder_siho();
+	auto &dcs = *this->codec          [tid]->get_decoder_siso();
+	auto &csb = *this->coset_bit      [tid];
+	auto &mnt = *this->monitor_er     [tid];
+
+	this->nodes[tid].clear();
+	this->channels[tid].reset();
+	this->predicate[tid].reset(new tools::Predicate_ite(this->params_BFER_ite.n_ite));
+
+	auto &n_src = this->add_node(tid, src[src::tsk::generate    ]);
+	auto &n_crb = this->add_node(tid, crc[crc::tsk::build       ]);
+	auto &n_enc = this->add_node(tid, enc[enc::tsk::encode      ]);
+	auto &n_itb = this->add_node(tid, itb[itl::tsk::interleave  ]);
+	auto &n_mod = this->add_node(tid, mdm[mdm::tsk::modulate    ]);
+	auto &n_flt = this->add_node(tid, mdm[mdm::tsk::filter      ]);
+	auto &n_qnt = this->add_node(tid, qnt[qnt::tsk::process     ]);
+	auto &n_dil = this->add_node(tid, itl[itl::tsk::deinterleave]);
+	auto &n_dcs = this->add_node(tid, dcs[dec::tsk::decode_siso ]);
+	auto &n_itl = this->add_node(tid, itl[itl::tsk::interleave  ]);
+	auto &n_dch = this->add_node(tid, dch[dec::tsk::decode_siho ]);
+	auto &n_cre = this->add_node(tid, crc[crc::tsk::extract     ]);
+	auto &n_mnt = this->add_node(tid, mnt[mnt::tsk::check_errors]);
+
+	auto &n_chn = this->add_node(tid, chn[rayleigh ? chn::tsk::add_noise_wg   : chn::tsk::add_noise  ]);
+	auto &n_dmd = this->add_node(tid, mdm[rayleigh ? mdm::tsk::demodulate_wg  : mdm::tsk::demodulate ]);
+	auto &n_tdm = this->add_node(tid, mdm[rayleigh ? mdm::tsk::tdemodulate_wg : mdm::tsk::tdemodulate]);
+
+	auto add = [&](tools::Node *n) -> tools::Node& { this->nodes[tid].push_back(std::unique_ptr<tools::Node>(n));
+	                                                 return *n; };
+
+	auto &dp0 = add(new tools::Duplicator    (                        "Duplicator0"));
+	auto &dp1 = add(new tools::Duplicator    (                        "Duplicator1"));
+	auto &dp5 = add(new tools::Duplicator    (                        "Duplicator5"));
+	auto &rtr = add(new tools::Router        (*this->predicate[tid], "Router"     ));
+	auto &fnl = add(new tools::Funnel        (                        "Funnel"     ));
+	auto &prd = add(new tools::Predicate_node(*this->predicate[tid], "Predicate"  ));
+
+	// the edges between the transmitter and the receiver: they go through a bounded channel when the chain is
+	// pipelined (the transmitter and the receiver are then executed by two different threads), the frame from the
+	// quantizer has to be the last one (it starts the receiver)
+	struct Edge { tools::Node::Port_out from; tools::Port_in to; size_t bytes; };
+	std::vector<Edge> cut;
+
+	n_src.out(src[src::sck::generate::U_K ])(dp0.in());
+	cut.push_back({dp0.out(0), n_mnt.in(mnt[mnt::sck::check_errors::U]),
+	               src[src::sck::generate::U_K].get_databytes()});
+	dp0.out(1)(n_crb.in(crc[crc::sck::build::U_K1]));
+
+	if (coset)
+	{
+		auto &n_csr = this->add_node(tid, csr[cst::tsk::apply]);
+		auto &n_csi = this->add_node(tid, csi[cst::tsk::apply]);
+		auto &n_csb = this->add_node(tid, csb[cst::tsk::apply]);
+
+		auto &dp2 = add(new tools::Duplicator("Duplicator2"));
+		auto &dp3 = add(new tools::Duplicator("Duplicator3"));
+		auto &dp4 = add(new tools::Duplicator("Duplicator4"));
+
+		n_crb.out(crc[crc::sck::build::U_K2])(dp2.in());
+		cut.push_back({dp2.out(0), n_csb.in(csb[cst::sck::apply::ref]), crc[crc::sck::build::U_K2].get_databytes()});
+		dp2.out(1)(n_enc.in(enc[enc::sck::encode::U_K]));
+		n_enc.out(enc[enc::sck::encode::X_N])(dp3.in());
+		cut.push_back({dp3.out(0), dp4.in(), enc[enc::sck::encode::X_N].get_databytes()});
+		dp4.out(0)(n_csr.in(csr[cst::sck::apply::ref]));
+		dp4.out(1)(n_csi.in(csi[cst::sck::apply::ref]));
+		dp3.out(1)(n_itb.in(itb[itl::sck::interleave::nat]));
+
+		n_dil.out(itl[itl::sck::deinterleave::nat])(n_csr.in (csr[cst::sck::apply::in ]));
+		n_csr.out(csr[cst::sck::apply       ::out])(rtr  .in (                          ));
+		n_dcs.out(dcs[dec::sck::decode_siso ::Y_N2])(n_csi.in(csi[cst::sck::apply::in ]));
+		n_csi.out(csi[cst::sck::apply       ::out])(n_itl.in (itl[itl::sck::interleave::nat]));
+		n_dch.out(dch[dec::sck::decode_siho ::V_K])(n_csb.in (csb[cst::sck::apply::in ]));
+		n_csb.out(csb[cst::sck::apply       ::out])(n_cre.in (crc[crc::sck::extract::V_K1]));
+	}
+	else
+	{
+		n_crb.out(crc[crc::sck::build       ::U_K2])(n_enc.in(enc[enc::sck::encode    ::U_K ]));
+		n_enc.out(enc[enc::sck::encode      ::X_N ])(n_itb.in(itb[itl::sck::interleave::nat ]));
+
+		n_dil.out(itl[itl::sck::deinterleave::nat ])(rtr  .in(                                 ));
+		n_dcs.out(dcs[dec::sck::decode_siso ::Y_N2])(n_itl.in(itl[itl::sck::interleave::nat ]));
+		n_dch.out(dch[dec::sck::decode_siho ::V_K ])(n_cre.in(crc[crc::sck::extract   ::V_K1]));
+	}
+
+	n_itb.out(itb[itl::sck::interleave::itl ])(n_mod.in(mdm[mdm::sck::modulate::X_N1]));
+
+	if (rayleigh)
+	{
+		auto &dp6 = add(new tools::Duplicator("Duplicator6"));
+
+		n_mod.out(mdm[mdm::sck::modulate    ::X_N2])(n_chn.in(chn[chn::sck::add_noise_wg::X_N]));
+		cut.push_back({n_chn.out(chn[chn::sck::add_noise_wg::H_N]), dp6.in(),
+		               chn[chn::sck::add_noise_wg::H_N].get_databytes()});
+		dp6.out(0)(n_dmd.in(mdm[mdm::sck::demodulate_wg ::H_N]));
+		dp6.out(1)(n_tdm.in(mdm[mdm::sck::tdemodulate_wg::H_N]));
+		n_chn.out(chn[chn::sck::add_noise_wg::Y_N ])(n_flt.in(mdm[mdm::sck::filter::Y_N1]));
+
+		dp5.out(0)(n_tdm.in(mdm[mdm::sck::tdemodulate_wg::Y_N1]));
+		dp5.out(1)(n_dmd.in(mdm[mdm::sck::demodulate_wg ::Y_N1]));
+		n_dmd.out(mdm[mdm::sck::demodulate_wg ::Y_N2])(fnl.in(0));
+		n_itl.out(itl[itl::sck::interleave    ::itl ])(n_tdm.in(mdm[mdm::sck::tdemodulate_wg::Y_N2]));
+		n_tdm.out(mdm[mdm::sck::tdemodulate_wg::Y_N3])(fnl.in(1));
+	}
+	else
+	{
+		n_mod.out(mdm[mdm::sck::modulate ::X_N2])(n_chn.in(chn[chn::sck::add_noise::X_N ]));
+		n_chn.out(chn[chn::sck::add_noise::Y_N ])(n_flt.in(mdm[mdm::sck::filter   ::Y_N1]));
+
+		dp5.out(0)(n_tdm.in(mdm[mdm::sck::tdemodulate::Y_N1]));
+		dp5.out(1)(n_dmd.in(mdm[mdm::sck::demodulate ::Y_N1]));
+		n_dmd.out(mdm[mdm::sck::demodulate ::Y_N2])(fnl.in(0));
+		n_itl.out(itl[itl::sck::interleave ::itl ])(n_tdm.in(mdm[mdm::sck::tdemodulate::Y_N2]));
+		n_tdm.out(mdm[mdm::sck::tdemodulate::Y_N3])(fnl.in(1));
+	}
+
+	n_flt.out(mdm[mdm::sck::filter ::Y_N2])(n_qnt.in(qnt[qnt::sck::process::Y_N1]));
+	cut.push_back({n_qnt.out(qnt[qnt::sck::process::Y_N2]), dp5.in(), qnt[qnt::sck::process::Y_N2].get_databytes()});
+
+	// ---------------------------------------------------------------------------------------- turbo demodulation loop
+	fnl.out()(n_dil.in(itl[itl::sck::deinterleave::itl]));
+	rtr.out(0)(n_dcs.in(dcs[dec::sck::decode_siso::Y_N1]));
+	rtr.out(1)(n_dch.in(dch[dec::sck::decode_siho::Y_N ]));
+	// --------------------------------------------------------------------------------- end of turbo demodulation loop
+
+	n_cre.out(crc[crc::sck::extract::V_K2])(dp1.in());
+	dp1.out(0)(n_mnt.in(mnt[mnt::sck::check_errors::V]));
+	dp1.out(1)(prd.in());
+
+	if (this->params_BFER_ite.dataflow_queue)
+	{
+		std::vector<size_t> bytes;
+		for (auto &e : cut)
+			bytes.push_back(e.bytes);
+
+		this->channels[tid].reset(new tools::Bounded_channel(bytes, (size_t)this->params_BFER_ite.dataflow_queue,
+		                                             "Channel" + std::to_string(tid)));
+
+		for (size_t p = 0; p < cut.size(); p++)
+		{
+			cut[p].from(this->channels[tid]->in(p));
+			this->channels[tid]->out(p)(cut[p].to);
+		}
+	}
+	else
+	{
+		for (auto &e : cut)
+			e.from(e.to);
+	}
+
+	this->sources[tid] = &n_src;
+}
+
+template <typename B, typename R, typename Q>
+std::unique_ptr<module::Coset<B,Q>> BFER_ite_dataflow<B,R,Q>
+::build_coset_real(const int tid)
+{
+	factory::Coset::parameters cst_params;
+	cst_params.size     = this->params_BFER_ite.cdc->N_cw;
+	cst_params.n_frames = this->params_BFER_ite.src->n_frames;
+
+	// the coset is applied twice in the turbo demodulation loop: a second module is required as a task can only have
+	// one place in the graph
+	this->coset_real_i[tid].reset(cst_params.template build_real<B,Q>());
+	this->coset_real_i[tid]->set_custom_name("Coset_real_i");
+
+	return std::unique_ptr<module::Coset<B,Q>>(cst_params.template build_real<B,Q>());
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::simulation::BFER_ite_dataflow<B_8,R_8,Q_8>;
+template class aff3ct::simulation::BFER_ite_dataflow<B_16,R_16,Q_16>;
+template class aff3ct::simulation::BFER_ite_dataflow<B_32,R_32,Q_32>;
+template class aff3ct::simulation::BFER_ite_dataflow<B_64,R_64,Q_64>;
+#else
+template class aff3ct::simulation::BFER_ite_dataflow<B,R,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,46 @@
+#ifndef SIMULATION_BFER_ITE_DATAFLOW_HPP_
+#define SIMULATION_BFER_ITE_DATAFLOW_HPP_
+
+#include <vector>
+#include <memory>
+
+#include "Tools/Algo/Predicate_ite.hpp"
+#include "Tools/Dataflow/Node.hpp"
+#include "Tools/Dataflow/Task_node.hpp"
+#include "Tools/Dataflow/Bounded_channel.hpp"
+#include "Factory/Simulation/BFER/BFER_ite.hpp"
+#include "Module/Coset/Coset.hpp"
+#include "Simulation/BFER/Iterative/BFER_ite.hpp"
+
+namespace aff3ct
+{
+namespace simulation
+{
+template <typename B = int, typename R = float, typename Q = R>
+class BFER_ite_dataflow : public BFER_ite<B,R,Q>
+{
+protected:
+	std::vector<std::unique_ptr<module::Coset<B,Q>>>       coset_real_i;
+	std::vector<std::unique_ptr<tools::Predicate_ite>>     predicate;
+	std::vector<std::vector<std::unique_ptr<tools::Node>>> nodes;    // the nodes of the graph of each thread
+	std::vector<std::unique_ptr<tools::Bounded_channel>>   channels; // one per thread when the chain is pipelined
+	std::vector<tools::Task_node*>                         sources;
+
+public:
+	explicit BFER_ite_dataflow(const factory::BFER_ite::parameters &params_BFER_ite);
+	virtual ~BFER_ite_dataflow() = default;
+
+protected:
+	virtual void __build_communication_chain(const int tid = 0);
+	virtual void _launch();
+
+	virtual std::unique_ptr<module::Coset<B,Q>> build_coset_real(const int tid = 0);
+
+private:
+	void build_graph(const int tid = 0);
+	tools::Task_node& add_node(const int tid, module::Task &task);
+};
+}
+}
+
+#endif /* SIMULATION_BFER_ITE_DATAFLOW_HPP_ */
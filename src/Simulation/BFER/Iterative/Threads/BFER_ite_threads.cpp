@@ -1,6 +1,7 @@
 #include <stdexcept>
 #include <algorithm>
 #include <iostream>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <thread>
@@ -39,6 +40,7 @@ void BFER_ite_threads<B,R,Q>
 
 	// launch the master thread
 	BFER_ite_threads<B,R,Q>::start_thread(this, 0);
+	this->unpin_master_thread();
 
 	// join the slave threads with the master thread
 	for (auto tid = 1; tid < this->params_BFER_ite.n_threads; tid++)
@@ -54,6 +56,7 @@ void BFER_ite_threads<B,R,Q>
 {
 	try
 	{
+		simu->pin_thread(tid);
 		simu->sockets_binding(tid);
 		simu->simulation_loop(tid);
 	}
@@ -325,7 +328,13 @@ void BFER_ite_threads<B,R,Q>
 
 	using namespace module;
 
-	while (this->keep_looping_noise_point())
+	// the per-frame early termination requires a CRC, it is disabled with the inter-frame SIMD decoders (the frames of
+	// a SIMD wave are decoded together) and when the tasks have to be executed as a whole (statistics and debug)
+	const bool per_frame = this->params_BFER_ite.crc->type != "NO" && this->params_BFER_ite.src->n_frames > 1 &&
+	                       decoder_siso.get_simd_inter_frame_level() == 1 &&
+	                       !this->params_BFER_ite.statistics && !this->params_BFER_ite.debug;
+
+	while (this->keep_looping_noise_point(tid))
 	{
 		if (this->params_BFER_ite.debug)
 		{
@@ -379,7 +388,10 @@ void BFER_ite_threads<B,R,Q>
 		// ------------------------------------------------------------------------------------------------------------
 		// ------------------------------------------------------------------------------------ turbo demodulation loop
 		// ------------------------------------------------------------------------------------------------------------
-		for (auto ite = 1; ite <= this->params_BFER_ite.n_ite; ite++)
+		if (per_frame)
+			this->turbo_demodulation_per_frame(tid);
+
+		for (auto ite = 1; !per_frame && ite <= this->params_BFER_ite.n_ite; ite++)
 		{
 			// ------------------------------------------------------------------------------------------- CRC checking
 			if (this->params_BFER_ite.crc->type != "NO" && ite >= this->params_BFER_ite.crc_start)
@@ -457,6 +469,104 @@ void BFER_ite_threads<B,R,Q>
 	}
 }
 
+template <typename B, typename R, typename Q>
+void BFER_ite_threads<B,R,Q>
+::turbo_demodulation_per_frame(const int tid)
+{
+	auto &crc             = *this->crc            [tid];
+	auto &codec           = *this->codec          [tid];
+	auto &modem           = *this->modem          [tid];
+	auto &interleaver_llr = *this->interleaver_llr[tid];
+	auto &coset_real      = *this->coset_real     [tid];
+
+	auto &decoder_siso = *codec.get_decoder_siso();
+
+	using namespace module;
+
+	const bool rayleigh = this->params_BFER_ite.chn->type.find("RAYLEIGH") != std::string::npos;
+
+	// the modules are directly called on the data of the sockets (bound once in 'sockets_binding')
+	auto data = [](Task &t, const size_t s) { return t.sockets[s]->get_dataptr(); };
+	auto &ext = codec          [cdc::tsk::extract_sys_bit];
+	auto &chk = crc            [crc::tsk::check          ];
+	auto &cst = coset_real     [cst::tsk::apply          ];
+	auto &dcs = decoder_siso   [dec::tsk::decode_siso    ];
+	auto &itl = interleaver_llr[itl::tsk::interleave     ];
+	auto &dtl = interleaver_llr[itl::tsk::deinterleave   ];
+	auto &tdm = modem          [rayleigh ? mdm::tsk::tdemodulate_wg : mdm::tsk::tdemodulate];
+
+	auto ext_Y_N  = (const Q*)data(ext, (size_t)cdc::sck::extract_sys_bit::Y_N );
+	auto ext_V_K  = (      B*)data(ext, (size_t)cdc::sck::extract_sys_bit::V_K );
+	auto chk_V_K  = (const B*)data(chk, (size_t)crc::sck::check          ::V_K );
+	auto cst_ref  = (const B*)data(cst, (size_t)cst::sck::apply          ::ref );
+	auto cst_in   = (const Q*)data(cst, (size_t)cst::sck::apply          ::in  );
+	auto cst_out  = (      Q*)data(cst, (size_t)cst::sck::apply          ::out );
+	auto dcs_Y_N1 = (const Q*)data(dcs, (size_t)dec::sck::decode_siso    ::Y_N1);
+	auto dcs_Y_N2 = (      Q*)data(dcs, (size_t)dec::sck::decode_siso    ::Y_N2);
+	auto itl_nat  = (const Q*)data(itl, (size_t)itl::sck::interleave     ::nat );
+	auto itl_itl  = (      Q*)data(itl, (size_t)itl::sck::interleave     ::itl );
+	auto dtl_itl  = (const Q*)data(dtl, (size_t)itl::sck::deinterleave   ::itl );
+	auto dtl_nat  = (      Q*)data(dtl, (size_t)itl::sck::deinterleave   ::nat );
+
+	const R* tdm_H_N  = rayleigh ? (const R*)data(tdm, (size_t)mdm::sck::tdemodulate_wg::H_N ) : nullptr;
+	const Q* tdm_Y_N1 = (const Q*)data(tdm, rayleigh ? (size_t)mdm::sck::tdemodulate_wg::Y_N1
+	                                                 : (size_t)mdm::sck::tdemodulate   ::Y_N1);
+	const Q* tdm_Y_N2 = (const Q*)data(tdm, rayleigh ? (size_t)mdm::sck::tdemodulate_wg::Y_N2
+	                                                 : (size_t)mdm::sck::tdemodulate   ::Y_N2);
+	      Q* tdm_Y_N3 = (      Q*)data(tdm, rayleigh ? (size_t)mdm::sck::tdemodulate_wg::Y_N3
+	                                                 : (size_t)mdm::sck::tdemodulate   ::Y_N3);
+
+	// the frames which pass the CRC are frozen, the next iterations only process the active frames
+	std::vector<int> active(this->params_BFER_ite.src->n_frames);
+	std::iota(active.begin(), active.end(), 0);
+
+	for (auto ite = 1; ite <= this->params_BFER_ite.n_ite; ite++)
+	{
+		// ----------------------------------------------------------------------------------------------- CRC checking
+		if (ite >= this->params_BFER_ite.crc_start)
+		{
+			active.erase(std::remove_if(active.begin(), active.end(), [&](const int f)
+			{
+				codec.extract_sys_bit(ext_Y_N, ext_V_K, f);
+				return crc.check(chk_V_K, -1, f);
+			}), active.end());
+
+			if (active.empty())
+				break;
+		}
+
+		for (auto f : active)
+		{
+			// ------------------------------------------------------------------------------------------- decoding
+			if (this->params_BFER_ite.coset)
+			{
+				coset_real  .apply      (cst_ref, cst_in, cst_out, f);
+				decoder_siso.decode_siso(dcs_Y_N1, dcs_Y_N2, f);
+				coset_real  .apply      (cst_ref, cst_in, cst_out, f);
+			}
+			else
+			{
+				decoder_siso.decode_siso(dcs_Y_N1, dcs_Y_N2, f);
+			}
+
+			// --------------------------------------------------------------------------------------- interleaving
+			interleaver_llr.interleave(itl_nat, itl_itl, f);
+
+			// --------------------------------------------------------------------------------------- demodulation
+			if (modem.is_demodulator())
+			{
+				if (rayleigh)
+					modem.tdemodulate_wg(tdm_H_N, tdm_Y_N1, tdm_Y_N2, tdm_Y_N3, f);
+				else
+					modem.tdemodulate(tdm_Y_N1, tdm_Y_N2, tdm_Y_N3, f);
+			}
+
+			// ------------------------------------------------------------------------------------- deinterleaving
+			interleaver_llr.deinterleave(dtl_itl, dtl_nat, f);
+		}
+	}
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -21,6 +21,7 @@ protected:
 private:
 	void sockets_binding(const int tid = 0);
 	void simulation_loop(const int tid = 0);
+	void turbo_demodulation_per_frame(const int tid = 0);
 
 	static void start_thread(BFER_ite_threads<B,R,Q> *simu, const int tid = 0);
 };
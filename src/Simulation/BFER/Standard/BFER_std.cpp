@@ -24,7 +24,9 @@ BFER_std<B,R,Q>
   coset_real(params_BFER_std.n_threads),
   coset_bit (params_BFER_std.n_threads),
 
-  rd_engine_seed(params_BFER_std.n_threads)
+  rd_engine_seed(params_BFER_std.n_threads),
+
+  dec_implem(params_BFER_std.cdc->dec->get_implem())
 {
 	for (auto tid = 0; tid < params_BFER_std.n_threads; tid++)
 		rd_engine_seed[tid].seed(params_BFER_std.local_seed + tid);
@@ -139,6 +141,27 @@ void BFER_std<B,R,Q>
 	}
 }
 
+template <typename B, typename R, typename Q>
+void BFER_std<B,R,Q>
+::reseed(const int tid, const int seed)
+{
+	std::mt19937 rd_engine(seed);
+
+	this->source [tid]->set_seed(rd_engine());
+	this->channel[tid]->set_seed(rd_engine());
+
+	try
+	{
+		auto& interleaver = codec[tid]->get_interleaver(); // can raise an exceptions
+		if (interleaver->is_uniform())
+		{
+			interleaver->set_seed(rd_engine());
+			interleaver->refresh();
+		}
+	}
+	catch (const std::exception&) { /* do nothing if there is no interleaver */ }
+}
+
 template <typename B, typename R, typename Q>
 std::unique_ptr<module::Source<B>> BFER_std<B,R,Q>
 ::build_source(const int tid)
@@ -146,7 +169,7 @@ std::unique_ptr<module::Source<B>> BFER_std<B,R,Q>
 	const auto seed_src = rd_engine_seed[tid]();
 
 	std::unique_ptr<factory::Source::parameters> params_src(params_BFER_std.src->clone());
-	params_src->seed = seed_src;
+	params_src->seed = seed_src + this->resume_seed_shift();
 
 	return std::unique_ptr<module::Source<B>>(params_src->template build<B>());
 }
@@ -168,6 +191,7 @@ std::unique_ptr<module::Codec_SIHO<B,Q>> BFER_std<B,R,Q>
 	std::unique_ptr<factory::Codec::parameters> params_cdc(params_BFER_std.cdc->clone());
 	params_cdc->enc->seed = seed_enc;
 	params_cdc->dec->seed = seed_dec;
+	params_cdc->dec->set_implem(this->dec_implem);
 
 	if (params_cdc->itl != nullptr)
 	{
@@ -211,7 +235,7 @@ std::unique_ptr<module::Channel<R>> BFER_std<B,R,Q>
 	const auto seed_chn = rd_engine_seed[tid]();
 
 	std::unique_ptr<factory::Channel::parameters> params_chn(this->params_BFER_std.chn->clone());
-	params_chn->seed = seed_chn;
+	params_chn->seed = seed_chn + this->resume_seed_shift();
 
 	if (this->distributions != nullptr)
 		return std::unique_ptr<module::Channel<R>>(params_chn->template build<R>(*this->distributions));
@@ -5,6 +5,7 @@
 #include <vector>
 #include <random>
 #include <memory>
+#include <string>
 
 #include "Module/Source/Source.hpp"
 #include "Module/CRC/CRC.hpp"
@@ -41,6 +42,9 @@ protected:
 	// a vector of random generator to generate the seeds
 	std::vector<std::mt19937> rd_engine_seed;
 
+	// implementation of the decoders (the one of the parameters, or the one selected by the autotuning)
+	std::string dec_implem;
+
 public:
 	explicit BFER_std(const factory::BFER_std::parameters &params_BFER_std);
 	virtual ~BFER_std() = default;
@@ -48,6 +52,7 @@ public:
 protected:
 	virtual void __build_communication_chain(const int tid = 0);
 	virtual void _launch();
+	virtual void reseed(const int tid, const int seed);
 
 	std::unique_ptr<module::Source    <B    >> build_source    (const int tid = 0);
 	std::unique_ptr<module::CRC       <B    >> build_crc       (const int tid = 0);
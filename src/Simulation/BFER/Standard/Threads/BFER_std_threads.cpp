@@ -1,11 +1,23 @@
+#include <algorithm>
 #include <stdexcept>
 #include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <fstream>
+#include <chrono>
 #include <string>
 #include <vector>
 #include <thread>
+#include <cmath>
+#include <mipp.h>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/rang_format/rang_format.h"
+#include "Tools/Display/Statistics/Statistics.hpp"
+#include "Tools/Display/Terminal/Terminal.hpp"
+#include "Module/Monitor/Monitor_reduction.hpp"
+#include "Tools/Sequence/Sequence.hpp"
+#include "Tools/system_functions.h"
 #include "Simulation/BFER/Standard/Threads/BFER_std_threads.hpp"
 
 using namespace aff3ct;
@@ -38,6 +50,7 @@ void BFER_std_threads<B,R,Q>
 
 	// launch the master thread
 	BFER_std_threads<B,R,Q>::start_thread(this, 0);
+	this->unpin_master_thread();
 
 	// join the slave threads with the master thread
 	for (auto tid = 1; tid < this->params_BFER_std.n_threads; tid++)
@@ -53,6 +66,7 @@ void BFER_std_threads<B,R,Q>
 {
 	try
 	{
+		simu->pin_thread(tid);
 		simu->sockets_binding(tid);
 		simu->simulation_loop(tid);
 	}
@@ -257,123 +271,317 @@ void BFER_std_threads<B,R,Q>
 	}
 }
 
+template <typename B, typename R, typename Q>
+std::vector<module::Task*> BFER_std_threads<B,R,Q>
+::get_first_tasks(const int tid)
+{
+	using namespace module;
+
+	auto &source  = *this->source [tid];
+	auto &channel = *this->channel[tid];
+
+	// the execution order is deduced from the sockets binding, the bypassed modules ("NO" types) are not executed,
+	// with the "AZCW" source the modulated frame is constant (modulated once in 'sockets_binding')
+	std::vector<Task*> firsts;
+	if (this->params_BFER_std.src->type != "AZCW")
+		firsts.push_back(&source[src::tsk::generate]);
+	else if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
+		firsts.push_back(&channel[chn::tsk::add_noise_wg]);
+	else
+		firsts.push_back(&channel[chn::tsk::add_noise]);
+
+	return firsts;
+}
+
 template <typename B, typename R, typename Q>
 void BFER_std_threads<B,R,Q>
-::simulation_loop(const int tid)
+::bench()
 {
-	auto &source     = *this->source    [tid];
-	auto &crc        = *this->crc       [tid];
-	auto &encoder    = *this->codec     [tid]->get_encoder();
-	auto &puncturer  = *this->codec     [tid]->get_puncturer();
-	auto &modem      = *this->modem     [tid];
-	auto &channel    = *this->channel   [tid];
-	auto &quantizer  = *this->quantizer [tid];
-	auto &coset_real = *this->coset_real[tid];
-	auto &decoder    = *this->codec     [tid]->get_decoder_siho();
-	auto &coset_bit  = *this->coset_bit [tid];
-	auto &monitor    = *this->monitor_er[tid];
+	BFER_std<B,R,Q>::_launch(); // set the noise in the modules
 
-	using namespace module;
+	// avoid the migrations of the thread between the cores during the measures
+	const auto core = tools::get_current_core();
+	const auto pinned = tools::pin_thread(core);
 
-	// communication chain execution
-	while (this->keep_looping_noise_point())
+	this->sockets_binding(0);
+
+	// execute the chain once to fill the sockets with realistic data, then each task is executed alone on these data
+	tools::Sequence sequence(this->get_first_tasks(0));
+	sequence.exec_seq();
+
+	const auto n_reps   = this->params_BFER_std.bench;
+	const auto n_warmup = this->params_BFER_std.bench_warmup;
+	const auto n_frames = this->params_BFER_std.src->n_frames;
+	const auto K        = this->params_BFER_std.src->K;
+
+	std::vector<const module::Task*> tasks;
+	std::vector<uint64_t> cycles;
+	for (auto t : sequence.get_tasks(0))
 	{
-		if (this->params_BFER_std.debug)
-		{
-			if (!monitor[mnt::tsk::check_errors].get_n_calls())
-				std::cout << "#" << std::endl;
+		for (unsigned w = 0; w < n_warmup; w++)
+			t->exec();
 
-			auto fid = monitor[mnt::tsk::check_errors].get_n_calls();
-			std::cout << "# -------------------------------"     << std::endl;
-			std::cout << "# New communication (n°" << fid << ")" << std::endl;
-			std::cout << "# -------------------------------"     << std::endl;
-			std::cout << "#"                                     << std::endl;
-		}
+		t->reset_stats();
+		t->set_stats(true);
 
-		if (this->params_BFER_std.src->type != "AZCW")
-		{
-			source[src::tsk::generate].exec();
-			if (this->params_BFER_std.crc->type != "NO")
-				crc[crc::tsk::build].exec();
-			if (this->params_BFER_std.cdc->enc->type != "NO")
-				encoder[enc::tsk::encode].exec();
-			if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
-				puncturer[pct::tsk::puncture].exec();
-			modem[mdm::tsk::modulate].exec();
-		}
+		const auto c_start = tools::get_cycles();
+		for (unsigned r = 0; r < n_reps; r++)
+			t->exec();
+		cycles.push_back(tools::get_cycles() - c_start);
 
-		if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
-		{
-			if (this->params_BFER_std.chn->type != "NO")
-				channel[chn::tsk::add_noise_wg].exec();
-			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate_wg].exec();
-			if (this->params_BFER_std.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-		}
-		else if (this->params_BFER_std.chn->type == "OPTICAL" && this->params_BFER_std.mdm->rop_est_bits > 0)
-		{
-			channel[chn::tsk::add_noise].exec();
-			modem[mdm::tsk::demodulate_wg].exec();
-			if (this->params_BFER_std.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-		}
+		tasks.push_back(t);
+	}
+
+	std::cout << "# Benchmark: " << (sizeof(Q) * 8) << "-bit precision, " << mipp::InstructionFullType << " ("
+	          << mipp::N<Q>() << " elements per register), " << n_frames << " frame(s) per task execution, "
+	          << n_reps << " execution(s) per task";
+	if (pinned)
+		std::cout << ", pinned on the core " << core;
+	std::cout << "." << std::endl;
+	std::cout << "#" << std::endl;
+
+	tools::Stats::show(tasks, false, std::cout);
+
+	std::cout << "#" << std::endl;
+	std::cout << "# " << rang::style::bold << "-------------|-------------------||------------|------------|------------"
+	          << rang::style::reset << std::endl;
+	std::cout << "# " << rang::style::bold << "      MODULE |              TASK ||   NS/FRAME |       MB/S | CYCLES/BIT"
+	          << rang::style::reset << std::endl;
+	std::cout << "# " << rang::style::bold << "             |                   ||            |   (K bits) |   (K bits) "
+	          << rang::style::reset << std::endl;
+	std::cout << "# " << rang::style::bold << "-------------|-------------------||------------|------------|------------"
+	          << rang::style::reset << std::endl;
+	for (size_t t = 0; t < tasks.size(); t++)
+	{
+		const auto n_exec_frames = (double)n_reps * (double)n_frames;
+		const auto ns_per_frame  = (double)tasks[t]->get_duration_total().count() / n_exec_frames;
+		const auto mbps          = (double)K * 1000. / ns_per_frame;
+
+		std::stringstream sscycles;
+		if (cycles[t])
+			sscycles << std::setprecision(2) << std::fixed << std::setw(10)
+			         << (double)cycles[t] / (n_exec_frames * (double)K);
 		else
-		{
-			if (this->params_BFER_std.chn->type != "NO")
-				channel[chn::tsk::add_noise].exec();
-			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate].exec();
-			if (this->params_BFER_std.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-		}
+			sscycles << std::setw(10) << "-";
+
+		std::cout << "# " << std::setw(12) << tasks[t]->get_module().get_short_name() << " | "
+		                  << std::setw(17) << tasks[t]->get_name()                     << " || "
+		          << std::setprecision(2) << std::fixed
+		          << std::setw(10) << ns_per_frame << " | "
+		          << std::setw(10) << mbps         << " | "
+		          << sscycles.str() << std::endl;
+	}
+	std::cout << "#" << std::endl;
+}
 
-		if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
-			puncturer[pct::tsk::depuncture].exec();
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::autotune()
+{
+	using namespace module;
 
-		if (this->params_BFER_std.coset)
-		{
-			coset_real[cst::tsk::apply].exec();
+	// budget of the evaluation of each candidate and BER tolerance regarding the reference implementation
+	constexpr unsigned long long max_fe    = 100;
+	constexpr double             tolerance = 0.1;
+	const auto                   max_time  = std::chrono::seconds(2);
 
-			if (this->params_BFER_std.coded_monitoring)
+	const auto &params_dec = *this->params_BFER_std.cdc->dec;
+	const auto &path = this->params_BFER_std.autotune_path;
+
+	// the fingerprint contains the implementation given by the user: the reference of the BER comparison
+	std::stringstream ss_key;
+	ss_key << std::hex << std::setfill('0') << std::setw(16) << this->fingerprint() << std::dec << "_"
+	       << (sizeof(Q) * 8) << "-bit_" << mipp::InstructionFullType;
+	auto key = ss_key.str();
+	std::replace(key.begin(), key.end(), ' ', '_');
+
+	// reuse the choice previously made on this CPU for this simulation
+	std::ifstream cache_in(path);
+	if (cache_in.is_open())
+	{
+		std::string cache_key, cache_implem;
+		while (cache_in >> cache_key >> cache_implem)
+			if (cache_key == key)
 			{
-				decoder  [dec::tsk::decode_siho_cw].exec();
-				coset_bit[cst::tsk::apply         ].exec();
+				this->dec_implem = cache_implem;
+				std::cout << "# Autotuning: '" << cache_implem << "' decoder implementation (from the '" << path
+				          << "' cache)." << std::endl;
+				std::cout << "#" << std::endl;
+				return;
 			}
-			else
+		cache_in.close();
+	}
+
+	// the candidates are the implementations of the decoder, the reference is the user one
+	const auto ref_implem = params_dec.get_implem();
+	std::vector<std::string> candidates = {ref_implem};
+	for (auto &implem : params_dec.get_implems())
+		if (std::find(candidates.begin(), candidates.end(), implem) == candidates.end())
+			candidates.push_back(implem);
+
+	struct Result
+	{
+		std::string implem;
+		double      ns_per_frame;
+		double      ber;
+		double      n_bits;
+	};
+	std::vector<Result> results;
+
+	std::cout << "# Autotuning: " << candidates.size() << " candidate decoder implementation(s) on "
+	          << mipp::InstructionFullType << " (" << (sizeof(Q) * 8) << "-bit precision)." << std::endl;
+
+	for (auto &implem : candidates)
+	{
+		if (tools::Terminal::is_interrupt())
+			break;
+
+		this->dec_implem = implem;
+
+		this->monitor_er_red->clear_callbacks();
+		if (this->monitor_mi_red != nullptr)
+			this->monitor_mi_red->clear_callbacks();
+
+		try
+		{
+			// only the chain of the first thread is built and executed during the autotuning
+			this->__build_communication_chain(0);
+
+			for (auto &m : this->modules)
+				if (m.second[0] != nullptr)
+					for (auto &t : m.second[0]->tasks)
+					{
+						t->set_autoalloc(true);
+						t->set_fast(true);
+					}
+
+			this->channel[0]->set_noise(*this->noise);
+			this->modem  [0]->set_noise(*this->noise);
+			this->codec  [0]->set_noise(*this->noise);
+
+			this->sockets_binding(0);
+			tools::Sequence sequence(this->get_first_tasks(0));
+
+			auto &decoder = *this->codec[0]->get_decoder_siho();
+			auto &monitor = *this->monitor_er[0];
+			for (auto tsk : {dec::tsk::decode_siho, dec::tsk::decode_siho_cw})
 			{
-				decoder  [dec::tsk::decode_siho].exec();
-				coset_bit[cst::tsk::apply      ].exec();
-				if (this->params_BFER_std.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
+				decoder[tsk].set_fast(false);
+				decoder[tsk].set_stats(true);
+				decoder[tsk].reset_stats();
 			}
+			monitor.reset();
+
+			const auto t_start = std::chrono::steady_clock::now();
+			do
+				sequence.exec_seq();
+			while (monitor.get_n_fe() < max_fe &&
+			       std::chrono::steady_clock::now() - t_start < max_time &&
+			       !tools::Terminal::is_interrupt());
+
+			double ns = 0.;
+			for (auto tsk : {dec::tsk::decode_siho, dec::tsk::decode_siho_cw})
+				ns += (double)decoder[tsk].get_duration_total().count();
+
+			Result r;
+			r.implem       = implem;
+			r.n_bits       = (double)monitor.get_n_analyzed_fra() * (double)monitor.get_K();
+			r.ns_per_frame = ns / (double)monitor.get_n_analyzed_fra();
+			r.ber          = (double)monitor.get_ber();
+			results.push_back(r);
+
+			std::cout << "#  * " << std::setw(16) << std::left << implem << std::right << ": "
+			          << std::setprecision(2) << std::fixed << std::setw(12) << r.ns_per_frame << " ns/frame, BER = "
+			          << std::setprecision(2) << std::scientific << r.ber << std::defaultfloat << " ("
+			          << monitor.get_n_fe() << " FE)" << std::endl;
 		}
-		else
+		catch (std::exception const& e)
 		{
-			if (this->params_BFER_std.coded_monitoring)
-			{
-				decoder[dec::tsk::decode_siho_cw].exec();
-			}
+			auto save = tools::exception::no_backtrace;
+			tools::exception::no_backtrace = true;
+			std::string msg = e.what(); // get only the function signature
+			tools::exception::no_backtrace = save;
+
+			std::cout << "#  * " << std::setw(16) << std::left << implem << std::right << ": skipped ("
+			          << msg.substr(0, msg.find('\n')) << ")" << std::endl;
+		}
+	}
+
+	this->monitor_er_red->clear_callbacks();
+	if (this->monitor_mi_red != nullptr)
+		this->monitor_mi_red->clear_callbacks();
+	Monitor_reduction::reset_all();
+
+	// without the BER of the reference, the other implementations can not be validated
+	const auto ref_it = std::find_if(results.begin(), results.end(),
+	                                 [&ref_implem](const Result &r) { return r.implem == ref_implem; });
+	if (ref_it == results.end() || ref_it->n_bits == 0.)
+	{
+		this->dec_implem = ref_implem;
+
+		std::clog << rang::tag::warning << "Autotuning aborted: the reference decoder implementation could not be "
+		          << "evaluated ('ref_implem' = " << ref_implem << ")." << std::endl;
+		std::cout << "# Autotuning: '" << ref_implem << "' decoder implementation kept." << std::endl;
+		std::cout << "#" << std::endl;
+		return;
+	}
+
+	// the fastest implementation with a BER compatible with the reference one (3 standard deviations margin)
+	const auto &ref = *ref_it;
+	const auto ber_max = ref.ber * (1. + tolerance) + 3. * std::sqrt(ref.ber / ref.n_bits) + 3. / ref.n_bits;
+	auto best = &ref;
+	for (auto &r : results)
+		if (r.ber <= ber_max && r.ns_per_frame < best->ns_per_frame)
+			best = &r;
+
+	this->dec_implem = best->implem;
+
+	// interrupted evaluations are not reliable enough to be cached
+	if (!tools::Terminal::is_interrupt())
+	{
+#ifdef AFF3CT_MPI
+		if (this->params_BFER_std.mpi_rank == 0)
+#endif
+		{
+			std::ofstream cache_out(path, std::ios::app);
+			if (cache_out.is_open())
+				cache_out << key << " " << best->implem << std::endl;
 			else
-			{
-				decoder[dec::tsk::decode_siho].exec();
-				if (this->params_BFER_std.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
+				std::clog << rang::tag::warning << "Impossible to write the autotuning cache ('path' = " << path
+				          << ")." << std::endl;
 		}
+	}
+
+	std::cout << "# Autotuning: '" << best->implem << "' decoder implementation selected." << std::endl;
+	std::cout << "#" << std::endl;
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::simulation_loop(const int tid)
+{
+	using namespace module;
 
-		monitor[mnt::tsk::check_errors].exec();
+	auto &monitor = *this->monitor_er[tid];
 
-		if (this->params_BFER_std.mnt_mutinfo)
+	tools::Sequence sequence(this->get_first_tasks(tid));
+
+	// communication chain execution
+	while (this->keep_looping_noise_point(tid))
+	{
+		if (this->params_BFER_std.debug)
 		{
-			auto &monitor = *this->monitor_mi[tid];
+			if (!monitor[mnt::tsk::check_errors].get_n_calls())
+				std::cout << "#" << std::endl;
 
-			monitor[mnt::tsk::get_mutual_info].exec();
+			auto fid = monitor[mnt::tsk::check_errors].get_n_calls();
+			std::cout << "# -------------------------------"     << std::endl;
+			std::cout << "# New communication (n°" << fid << ")" << std::endl;
+			std::cout << "# -------------------------------"     << std::endl;
+			std::cout << "#"                                     << std::endl;
 		}
+
+		sequence.exec_seq();
 	}
 }
 
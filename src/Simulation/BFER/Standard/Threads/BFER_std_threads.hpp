@@ -1,6 +1,9 @@
 #ifndef SIMULATION_BFER_STD_THREADS_HPP_
 #define SIMULATION_BFER_STD_THREADS_HPP_
 
+#include <vector>
+
+#include "Module/Task.hpp"
 #include "Factory/Simulation/BFER/BFER_std.hpp"
 #include "Simulation/BFER/Standard/BFER_std.hpp"
 
@@ -17,8 +20,11 @@ public:
 
 protected:
 	virtual void _launch();
+	virtual void bench();
+	virtual void autotune();
 
 private:
+	std::vector<module::Task*> get_first_tasks(const int tid = 0);
 	void sockets_binding(const int tid = 0);
 	void simulation_loop(const int tid = 0);
 
@@ -13,6 +13,7 @@
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/rang_format/rang_format.h"
 #include "Tools/Display/Statistics/Statistics.hpp"
+#include "Tools/Display/Terminal/JSON/Terminal_JSON.hpp"
 #include "Tools/general_utils.h"
 #include "Tools/Math/utils.h"
 #include "Tools/Display/Reporter/EXIT/Reporter_EXIT.hpp"
@@ -200,6 +201,11 @@ void EXIT<B,R>
 					std::cout << "#" << std::endl;
 					tools::Stats::show(mod_vec, true, std::cout);
 					std::cout << "#" << std::endl;
+
+					// the machine readable terminal also writes the statistics as a record
+					auto terminal_json = dynamic_cast<tools::Terminal_JSON*>(terminal.get());
+					if (terminal_json != nullptr)
+						terminal_json->statistics(mod_vec);
 				}
 			}
 
@@ -1,6 +1,7 @@
 #include <sstream>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Code/Code_disk_cache.hpp"
 #include "Simulation/Simulation.hpp"
 
 using namespace aff3ct;
@@ -10,6 +11,8 @@ Simulation
 ::Simulation(const factory::Simulation::parameters& simu_params)
 : params(simu_params), simu_error(false)
 {
+	// the codes are built after the simulation: their costly constructions can be loaded from the disk
+	tools::Code_disk_cache::set_directory(params.cache_path);
 }
 
 bool Simulation
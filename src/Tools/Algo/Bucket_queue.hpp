@@ -0,0 +1,61 @@
+#ifndef BUCKET_QUEUE_HPP__
+#define BUCKET_QUEUE_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aff3ct
+{
+namespace tools
+{
+
+/*
+ * Approximate max-priority queue of the elements in [0;n_elmts[: the priorities are quantized in 'n_buckets' buckets
+ * and the elements of the same bucket are served in LIFO order.
+ * The updates are lazy: moving an element only pushes it in its new bucket, its previous entry becomes stale and is
+ * skipped when it is reached. All the operations are in O(1) (amortized for 'pop').
+ */
+class Bucket_queue
+{
+protected:
+	std::vector<std::vector<uint32_t>> buckets;
+	std::vector<int> elmt_bucket; // current bucket of each element (-1 if not in the queue)
+	int top;                      // highest bucket that may be non-empty
+	size_t n_queued;
+
+public:
+	inline Bucket_queue(const size_t n_elmts, const size_t n_buckets);
+
+	~Bucket_queue() = default;
+
+	inline size_t get_n_buckets() const;
+
+	inline bool empty() const;
+
+	/*
+	 * return the bucket of 'elmt' (-1 if it is not in the queue)
+	 */
+	inline int get_bucket(const uint32_t elmt) const;
+
+	/*
+	 * insert 'elmt' in 'bucket' or move it in 'bucket' if it is already in the queue
+	 */
+	inline void update(const uint32_t elmt, const int bucket);
+
+	inline void remove(const uint32_t elmt);
+
+	/*
+	 * remove and return an element of the highest non-empty bucket (the queue must not be empty)
+	 */
+	inline uint32_t pop();
+
+	inline void clear();
+};
+
+}
+}
+
+#include "Tools/Algo/Bucket_queue.hxx"
+
+#endif /* BUCKET_QUEUE_HPP__ */
@@ -0,0 +1,105 @@
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bucket_queue.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+
+Bucket_queue
+::Bucket_queue(const size_t n_elmts, const size_t n_buckets)
+: buckets(n_buckets), elmt_bucket(n_elmts, -1), top(-1), n_queued(0)
+{
+	if (n_buckets == 0)
+	{
+		std::stringstream message;
+		message << "'n_buckets' has to be greater than 0.";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+size_t Bucket_queue
+::get_n_buckets() const
+{
+	return this->buckets.size();
+}
+
+bool Bucket_queue
+::empty() const
+{
+	return this->n_queued == 0;
+}
+
+int Bucket_queue
+::get_bucket(const uint32_t elmt) const
+{
+	return this->elmt_bucket[elmt];
+}
+
+void Bucket_queue
+::update(const uint32_t elmt, const int bucket)
+{
+	if (this->elmt_bucket[elmt] == bucket)
+		return;
+
+	if (this->elmt_bucket[elmt] < 0)
+		this->n_queued++;
+
+	this->elmt_bucket[elmt] = bucket;
+	this->buckets[bucket].push_back(elmt);
+	this->top = std::max(this->top, bucket);
+}
+
+void Bucket_queue
+::remove(const uint32_t elmt)
+{
+	if (this->elmt_bucket[elmt] >= 0)
+	{
+		this->elmt_bucket[elmt] = -1;
+		this->n_queued--;
+	}
+}
+
+uint32_t Bucket_queue
+::pop()
+{
+	while (true)
+	{
+		auto &b = this->buckets[this->top];
+		if (b.empty())
+		{
+			this->top--;
+			continue;
+		}
+
+		const auto elmt = b.back();
+		b.pop_back();
+
+		// skip the stale entries
+		if (this->elmt_bucket[elmt] == this->top)
+		{
+			this->elmt_bucket[elmt] = -1;
+			this->n_queued--;
+			return elmt;
+		}
+	}
+}
+
+void Bucket_queue
+::clear()
+{
+	for (auto &b : this->buckets)
+	{
+		for (auto elmt : b)
+			this->elmt_bucket[elmt] = -1;
+		b.clear();
+	}
+	this->top = -1;
+	this->n_queued = 0;
+}
+
+}
+}
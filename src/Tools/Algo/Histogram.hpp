@@ -6,7 +6,6 @@
 #include <string>
 #include <cmath>
 #include <vector>
-#include <map>
 
 namespace aff3ct
 {
@@ -18,7 +17,16 @@ class Histogram
 {
 protected:
 	size_t n_values = 0;
-	std::map<int, size_t> hist;
+
+	// flat bins: 'bins[i]' counts the calibrated value 'offset + i'
+	std::vector<size_t> bins;
+	int offset = 0;
+
+	// with a fixed range, the values outside [cal_min, cal_max] are counted in two overflow bins ('cal_min -1' and
+	// 'cal_max +1') and the add operations never allocate
+	bool fixed_range = false;
+	int  cal_min     = 0;
+	int  cal_max     = 0;
 
 	const unsigned precision;
 	const R  stock_norm = (R)std::pow((unsigned)10,precision);
@@ -27,9 +35,17 @@ protected:
 public:
 	/*
 	 * @precision the number of decimal took into account in the given values
+	 * the range of the bins grows with the added values
 	 */
 	inline explicit Histogram(unsigned precision = 3);
 
+	/*
+	 * @precision the number of decimal took into account in the given values
+	 * @range_min is the smallest value with its own bin
+	 * @range_max is the biggest value with its own bin
+	 */
+	inline Histogram(unsigned precision, R range_min, R range_max);
+
 	~Histogram() = default;
 
 	inline Histogram<R>& operator=(const Histogram<R>& other);
@@ -85,13 +101,35 @@ public:
 
 	inline R uncalibrate_val(int val) const;
 
+	/*
+	 * the smallest and the biggest added values in [range_min, range_max] with a fixed range (the overflow bins are
+	 * not included, 'range_min' and 'range_max' are returned when all the values are outside of the range)
+	 */
 	inline R get_hist_min() const;
 
 	inline R get_hist_max() const;
 
 	inline size_t get_n_values() const;
 
+	/*
+	 * the number of values smaller than 'range_min' and bigger than 'range_max' (always 0 without a fixed range), they
+	 * are dumped on separated lines and only counted in the borders with 'cumul_borders'
+	 */
+	inline size_t get_n_underflows() const;
+
+	inline size_t get_n_overflows() const;
+
 private:
+	inline void add_calibrated_value(int x, size_t weight);
+
+	inline void grow(int x);
+
+	inline size_t first_bin() const; // the first bin which is not an overflow bin
+
+	inline size_t last_bin() const; // one past the last bin which is not an overflow bin
+
+	inline void dump_overflows(std::ofstream& hist_file) const;
+
 	inline int dump_all_values(std::ofstream& hist_file, R hist_min, R hist_max) const;
 
 	inline int dump_intervals(std::ofstream& hist_file, R hist_min, R hist_max) const;
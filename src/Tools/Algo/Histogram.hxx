@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <sstream>
 #include <ios>
 
@@ -16,6 +17,26 @@ Histogram<R>
 {
 }
 
+template <typename R>
+Histogram<R>
+::Histogram(unsigned precision, R range_min, R range_max)
+: fixed_range(true), precision(precision)
+{
+	cal_min = calibrate_val(range_min);
+	cal_max = calibrate_val(range_max);
+
+	if (cal_min > cal_max)
+	{
+		std::stringstream message;
+		message << "'range_min' has to be smaller than 'range_max' ('range_min' = " << range_min
+		        << ", 'range_max' = " << range_max << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	offset = cal_min -1;
+	bins.resize((size_t)(cal_max - cal_min) + 3, 0);
+}
+
 template <typename R>
 Histogram<R>& Histogram<R>
 ::operator=(const Histogram<R>& other)
@@ -28,8 +49,12 @@ Histogram<R>& Histogram<R>
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	n_values = other.n_values;
-	hist     = other.hist;
+	n_values    = other.n_values;
+	bins        = other.bins;
+	offset      = other.offset;
+	fixed_range = other.fixed_range;
+	cal_min     = other.cal_min;
+	cal_max     = other.cal_max;
 
 	return *this;
 }
@@ -46,13 +71,16 @@ void Histogram<R>
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	for (auto& o : other.hist)
+	if (this->offset == other.offset && this->bins.size() == other.bins.size())
 	{
-		auto it = hist.find(o.first);
-		if (it == hist.end())
-			hist[o.first] = o.second;
-		else
-			it->second += o.second;
+		for (size_t i = 0; i < bins.size(); i++)
+			bins[i] += other.bins[i];
+	}
+	else
+	{
+		for (size_t i = 0; i < other.bins.size(); i++)
+			if (other.bins[i])
+				add_calibrated_value(other.offset + (int)i, other.bins[i]);
 	}
 
 	n_values += other.n_values;
@@ -77,15 +105,7 @@ void Histogram<R>
 ::add_values(const R* draw, size_t size)
 {
 	for (size_t i = 0; i < size; i++)
-	{
-		auto x = calibrate_val(draw[i]);
-
-		auto it = hist.find(x);
-		if (it == hist.end())
-			hist[x] = 1;
-		else
-			it->second++;
-	}
+		add_calibrated_value(calibrate_val(draw[i]), 1);
 
 	n_values += size;
 }
@@ -94,17 +114,55 @@ template <typename R>
 void Histogram<R>
 ::add_value(const R& d, size_t weight)
 {
-	auto x = calibrate_val(d);
-
-	auto it = hist.find(x);
-	if (it == hist.end())
-		hist[x] = weight;
-	else
-		it->second += weight;
+	add_calibrated_value(calibrate_val(d), weight);
 
 	n_values += weight;
 }
 
+template <typename R>
+void Histogram<R>
+::add_calibrated_value(int x, size_t weight)
+{
+	if (fixed_range)
+		x = std::min(std::max(x, cal_min -1), cal_max +1);
+	else if (x < offset || x >= offset + (int)bins.size())
+		grow(x);
+
+	bins[x - offset] += weight;
+}
+
+template <typename R>
+void Histogram<R>
+::grow(int x)
+{
+	if (bins.empty())
+	{
+		offset = x;
+		bins.resize(1, 0);
+		return;
+	}
+
+	// the range at least doubles in the direction of 'x' to amortize the reallocations
+	const auto size = (int)bins.size();
+	const auto lo   = x < offset ? std::min(x, offset - size) : offset;
+	const auto hi   = x < offset ? offset + size -1 : std::max(x, offset + 2 * size -1);
+
+	constexpr long long max_bins = 1 << 24;
+	if ((long long)hi - (long long)lo + 1 > max_bins)
+	{
+		std::stringstream message;
+		message << "The range of the histogram is too large, use a fixed range instead ('x' = " << uncalibrate_val(x)
+		        << ", 'max_bins' = " << max_bins << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::vector<size_t> new_bins((size_t)(hi - lo +1), 0);
+	std::copy(bins.begin(), bins.end(), new_bins.begin() + (offset - lo));
+
+	bins.swap(new_bins);
+	offset = lo;
+}
+
 template <typename R>
 void Histogram<R>
 ::norm_sum_to_1(bool val)
@@ -214,7 +272,7 @@ void Histogram<R>
 ::reset()
 {
 	n_values = 0;
-	hist.clear();
+	std::fill(bins.begin(), bins.end(), 0);
 }
 
 template <typename R>
@@ -235,28 +293,36 @@ template <typename R>
 R Histogram<R>
 ::get_hist_min() const
 {
-	if (hist.empty())
+	if (n_values == 0)
 	{
 		std::stringstream message;
 		message << "The histogram is empty." << std::endl;
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	return uncalibrate_val(hist.begin()->first);
+	for (auto i = first_bin(); i < last_bin(); i++)
+		if (bins[i])
+			return uncalibrate_val(offset + (int)i);
+
+	return uncalibrate_val(cal_min);
 }
 
 template <typename R>
 R Histogram<R>
 ::get_hist_max() const
 {
-	if (hist.empty())
+	if (n_values == 0)
 	{
 		std::stringstream message;
 		message << "The histogram is empty." << std::endl;
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	return uncalibrate_val(hist.rbegin()->first);
+	for (auto i = last_bin(); i > first_bin(); i--)
+		if (bins[i -1])
+			return uncalibrate_val(offset + (int)i -1);
+
+	return uncalibrate_val(cal_max);
 }
 
 template <typename R>
@@ -266,6 +332,44 @@ size_t Histogram<R>
 	return n_values;
 }
 
+template <typename R>
+size_t Histogram<R>
+::get_n_underflows() const
+{
+	return fixed_range ? bins.front() : 0;
+}
+
+template <typename R>
+size_t Histogram<R>
+::get_n_overflows() const
+{
+	return fixed_range ? bins.back() : 0;
+}
+
+template <typename R>
+size_t Histogram<R>
+::first_bin() const
+{
+	return fixed_range ? 1 : 0;
+}
+
+template <typename R>
+size_t Histogram<R>
+::last_bin() const
+{
+	return fixed_range ? bins.size() -1 : bins.size();
+}
+
+template <typename R>
+void Histogram<R>
+::dump_overflows(std::ofstream& hist_file) const
+{
+	if (get_n_underflows())
+		hist_file << "# values < " << uncalibrate_val(cal_min) << data_separator() << get_n_underflows() << std::endl;
+	if (get_n_overflows())
+		hist_file << "# values > " << uncalibrate_val(cal_max) << data_separator() << get_n_overflows() << std::endl;
+}
+
 template <typename R>
 int Histogram<R>
 ::dump_all_values(std::ofstream& hist_file, R hist_min, R hist_max) const
@@ -276,16 +380,20 @@ int Histogram<R>
 		factor = (R)1 /(R)get_n_values();
 	}
 
-	size_t cumul = 0;
+	size_t cumul = cumul_borders() ? get_n_underflows() : 0;
 	bool dumped_hist_min = false;
 
 	auto cal_hist_min = calibrate_val(hist_min);
 	auto cal_hist_max = calibrate_val(hist_max);
 	R value;
 
-	for (auto it = hist.begin(); it != hist.end(); it++)
+	for (auto i = first_bin(); i < last_bin(); i++)
 	{
-		if ((it->first > cal_hist_min) && (cal_hist_max > it->first))
+		if (!bins[i])
+			continue;
+
+		const auto x = offset + (int)i;
+		if ((x > cal_hist_min) && (cal_hist_max > x))
 		{
 			value = (R)cumul * factor;
 			if (norm_sum_to_1() && norm_minus_1())
@@ -298,22 +406,25 @@ int Histogram<R>
 			}
 
 			if (cumul_vals())
-				cumul += it->second;
+				cumul += bins[i];
 			else
-				cumul = it->second;
+				cumul = bins[i];
 
 			value = (R)cumul * factor;
 			if (norm_sum_to_1() && norm_minus_1())
 				value = (R)1 - value;
 
-			hist_file << uncalibrate_val(it->first) << data_separator() << std::scientific << value << std::endl;
+			hist_file << uncalibrate_val(x) << data_separator() << std::scientific << value << std::endl;
 		}
-		else if (cumul_borders() || it->first == cal_hist_min || it->first == cal_hist_max)
+		else if (cumul_borders() || x == cal_hist_min || x == cal_hist_max)
 		{
-			cumul += it->second;
+			cumul += bins[i];
 		}
 	}
 
+	if (cumul_borders())
+		cumul += get_n_overflows();
+
 	if (cumul != 0) // then end of the cumul border on the right
 	{
 		value = (R)cumul * factor;
@@ -322,6 +433,8 @@ int Histogram<R>
 		hist_file << hist_max << data_separator() << std::scientific << value << std::endl;
 	}
 
+	dump_overflows(hist_file);
+
 	return 0;
 }
 
@@ -338,19 +451,28 @@ int Histogram<R>
 	R dump_step = (R)n_rung() / (hist_max - hist_min);
 	std::vector<size_t> dump_hist(n_rung() + 1, 0);
 
-	for (auto it = hist.begin(); it != hist.end(); it++)
+	if (cumul_borders())
 	{
-		auto x = (int)round((uncalibrate_val(it->first) - hist_min) * dump_step);
+		dump_hist.front() += get_n_underflows();
+		dump_hist.back () += get_n_overflows ();
+	}
+
+	for (auto i = first_bin(); i < last_bin(); i++)
+	{
+		if (!bins[i])
+			continue;
+
+		auto x = (int)round((uncalibrate_val(offset + (int)i) - hist_min) * dump_step);
 		if (x >= 0 && x <= (int)n_rung())
 		{
-			dump_hist[x] += it->second;
+			dump_hist[x] += bins[i];
 		}
 		else if (cumul_borders())
 		{
 			if (x < 0)
-				dump_hist.front() += it->second;
+				dump_hist.front() += bins[i];
 			else // x > n_intervals
-				dump_hist.back() += it->second;
+				dump_hist.back() += bins[i];
 		}
 	}
 
@@ -370,6 +492,9 @@ int Histogram<R>
 
 		hist_file << ((R) i * _dump_step + hist_min) << data_separator() << std::scientific << value << std::endl;
 	}
+
+	dump_overflows(hist_file);
+
 	return 0;
 }
 }
@@ -0,0 +1,54 @@
+/*!
+ * \file
+ * \brief Process wide cache of the read-only code descriptors (matrices, LUTs, ...) shared by the simulation threads.
+ */
+#ifndef CODE_DESCRIPTOR_CACHE_HPP_
+#define CODE_DESCRIPTOR_CACHE_HPP_
+
+#include <functional>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <map>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Code_descriptor_cache
+ *
+ * \brief Store the immutable descriptors of a code (type D) indexed by a key built from the construction parameters.
+ *
+ * The descriptors are reference counted: a descriptor lives as long as at least one codec holds it, then the next
+ * call to 'get' with the same key rebuilds it. Only the mutable decoding states have to be kept per thread.
+ */
+template <class D>
+class Code_descriptor_cache
+{
+private:
+	static std::mutex                                  mtx;
+	static std::map<std::string, std::weak_ptr<const D>> descriptors;
+
+public:
+	/*!
+	 * \brief Get the descriptor matching the given key, build it with 'builder' if it does not exist.
+	 *
+	 * \param key:     unique string built from all the parameters used by 'builder'.
+	 * \param builder: function allocating a new descriptor (called at most once per key at a time).
+	 *
+	 * \return a shared read-only descriptor.
+	 */
+	static std::shared_ptr<const D> get(const std::string &key, std::function<D*(void)> builder);
+
+	/*!
+	 * \brief Forget all the descriptors (the descriptors still referenced elsewhere are not deallocated).
+	 */
+	static void clear();
+};
+}
+}
+
+#include "Tools/Code/Code_descriptor_cache.hxx"
+
+#endif /* CODE_DESCRIPTOR_CACHE_HPP_ */
@@ -0,0 +1,42 @@
+#include "Tools/Code/Code_descriptor_cache.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <class D>
+std::mutex Code_descriptor_cache<D>::mtx;
+
+template <class D>
+std::map<std::string, std::weak_ptr<const D>> Code_descriptor_cache<D>::descriptors;
+
+template <class D>
+std::shared_ptr<const D> Code_descriptor_cache<D>
+::get(const std::string &key, std::function<D*(void)> builder)
+{
+	// the lock is kept during the build: the other threads wait for the descriptor instead of building their own
+	std::lock_guard<std::mutex> lock(Code_descriptor_cache<D>::mtx);
+
+	auto it = Code_descriptor_cache<D>::descriptors.find(key);
+	if (it != Code_descriptor_cache<D>::descriptors.end())
+	{
+		auto desc = it->second.lock();
+		if (desc != nullptr)
+			return desc;
+	}
+
+	std::shared_ptr<const D> desc(builder());
+	Code_descriptor_cache<D>::descriptors[key] = desc;
+
+	return desc;
+}
+
+template <class D>
+void Code_descriptor_cache<D>
+::clear()
+{
+	std::lock_guard<std::mutex> lock(Code_descriptor_cache<D>::mtx);
+	Code_descriptor_cache<D>::descriptors.clear();
+}
+}
+}
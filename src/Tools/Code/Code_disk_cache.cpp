@@ -0,0 +1,235 @@
+#if defined(_WIN32) || defined(_WIN64)
+#include <direct.h>
+#include <process.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include <functional>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <cstring>
+#include <cstdio>
+#include <thread>
+#include <ios>
+
+#include "Tools/version.h"
+#include "Tools/Code/Code_disk_cache.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+namespace
+{
+const char     magic[8]       = {'A', 'F', 'F', '3', 'C', 'T', 'C', 'C'};
+const uint32_t format_version = 2;
+
+// parse an entry: | magic | format version | stamp size | stamp | data size | data |, the data are read in place
+bool parse(const char *file, const size_t file_size, const std::string &stamp,
+           const std::function<bool(const char*, const size_t)> &read)
+{
+	const auto header_size = sizeof(magic) + sizeof(uint32_t) + sizeof(uint64_t) + stamp.size() + sizeof(uint64_t);
+	if (file_size < header_size)
+		return false;
+
+	auto ptr = file;
+	if (std::memcmp(ptr, magic, sizeof(magic)))
+		return false;
+	ptr += sizeof(magic);
+
+	uint32_t version;
+	std::memcpy(&version, ptr, sizeof(version));
+	ptr += sizeof(version);
+
+	uint64_t stamp_size;
+	std::memcpy(&stamp_size, ptr, sizeof(stamp_size));
+	ptr += sizeof(stamp_size);
+
+	if (version != format_version || stamp_size != stamp.size() || std::memcmp(ptr, stamp.data(), stamp.size()))
+		return false;
+	ptr += stamp_size;
+
+	uint64_t data_size;
+	std::memcpy(&data_size, ptr, sizeof(data_size));
+	ptr += sizeof(data_size);
+
+	if (data_size != file_size - header_size)
+		return false;
+
+	return read(ptr, (size_t)data_size);
+}
+}
+
+std::string Code_disk_cache::directory = "";
+
+void Code_disk_cache
+::set_directory(const std::string &directory)
+{
+	Code_disk_cache::directory = directory;
+
+	if (directory.empty())
+		return;
+
+	// mkdir mod = rwx r.x r.x, the errors (the directory already exists, ...) are detected later when writing
+#if defined(_WIN32) || defined(_WIN64)
+	_mkdir(directory.c_str());
+#else
+	mkdir(directory.c_str(), S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH);
+#endif
+}
+
+const std::string& Code_disk_cache
+::get_directory()
+{
+	return Code_disk_cache::directory;
+}
+
+bool Code_disk_cache
+::is_enabled()
+{
+	return !Code_disk_cache::directory.empty();
+}
+
+std::string Code_disk_cache
+::hash(const std::string &data)
+{
+	uint64_t h = 14695981039346656037ULL;
+	for (auto c : data)
+	{
+		h ^= (uint64_t)(uint8_t)c;
+		h *= 1099511628211ULL;
+	}
+
+	std::stringstream ss;
+	ss << std::hex << std::setw(16) << std::setfill('0') << h;
+	return ss.str();
+}
+
+std::string Code_disk_cache
+::get_stamp(const std::string &key)
+{
+	return tools::version() + "|" + tools::sha1() + "|" + key;
+}
+
+std::string Code_disk_cache
+::get_path(const std::string &stamp)
+{
+	return Code_disk_cache::directory + "/" + Code_disk_cache::hash(stamp) + ".cache";
+}
+
+bool Code_disk_cache
+::load(const std::string &key, const std::function<bool(const char *data, const size_t size)> &read)
+{
+	if (!Code_disk_cache::is_enabled())
+		return false;
+
+	const auto stamp = Code_disk_cache::get_stamp(key);
+	const auto path  = Code_disk_cache::get_path(stamp);
+
+#if defined(_WIN32) || defined(_WIN64)
+	std::ifstream file(path, std::ios::binary);
+	if (!file.is_open())
+		return false;
+
+	const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	return parse(content.data(), content.size(), stamp, read);
+#else
+	const int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size <= 0)
+	{
+		close(fd);
+		return false;
+	}
+
+	const auto file_size = (size_t)st.st_size;
+	void* file = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	if (file == MAP_FAILED)
+		return false;
+
+	const auto valid = parse((const char*)file, file_size, stamp, read);
+	munmap(file, file_size);
+
+	return valid;
+#endif
+}
+
+bool Code_disk_cache
+::load(const std::string &key, std::string &data)
+{
+	return Code_disk_cache::load(key, [&data](const char *bytes, const size_t size)
+	{
+		data.assign(bytes, size);
+		return true;
+	});
+}
+
+void Code_disk_cache
+::save(const std::string &key, const std::function<void(std::ostream &stream)> &write)
+{
+	if (!Code_disk_cache::is_enabled())
+		return;
+
+	const auto stamp = Code_disk_cache::get_stamp(key);
+	const auto path  = Code_disk_cache::get_path(stamp);
+
+	// a unique temporary file per process and per thread, renamed at the end (atomic on POSIX systems)
+#if defined(_WIN32) || defined(_WIN64)
+	const auto pid = _getpid();
+#else
+	const auto pid = getpid();
+#endif
+	std::stringstream tmp_path;
+	tmp_path << path << ".tmp." << pid << "." << std::hash<std::thread::id>()(std::this_thread::get_id());
+
+	{
+		std::ofstream file(tmp_path.str(), std::ios::binary);
+		if (!file.is_open())
+			return;
+
+		const uint64_t stamp_size = stamp.size();
+		uint64_t       data_size  = 0;
+		file.write(magic, sizeof(magic));
+		file.write((const char*)&format_version, sizeof(format_version));
+		file.write((const char*)&stamp_size, sizeof(stamp_size));
+		file.write(stamp.data(), stamp.size());
+
+		// the data are written directly in the file, their size is completed after
+		const auto data_size_pos = file.tellp();
+		file.write((const char*)&data_size, sizeof(data_size));
+		write(file);
+		data_size = (uint64_t)(file.tellp() - data_size_pos) - sizeof(data_size);
+		file.seekp(data_size_pos);
+		file.write((const char*)&data_size, sizeof(data_size));
+
+		if (!file.good())
+		{
+			file.close();
+			std::remove(tmp_path.str().c_str());
+			return;
+		}
+	}
+
+#if defined(_WIN32) || defined(_WIN64)
+	std::remove(path.c_str());
+#endif
+	if (std::rename(tmp_path.str().c_str(), path.c_str()) != 0)
+		std::remove(tmp_path.str().c_str());
+}
+
+void Code_disk_cache
+::save(const std::string &key, const std::string &data)
+{
+	Code_disk_cache::save(key, [&data](std::ostream &stream)
+	{
+		stream.write(data.data(), data.size());
+	});
+}
@@ -0,0 +1,89 @@
+/*!
+ * \file
+ * \brief Persistent (on disk) cache of the code constructions shared by successive runs of the simulator.
+ */
+#ifndef CODE_DISK_CACHE_HPP_
+#define CODE_DISK_CACHE_HPP_
+
+#include <functional>
+#include <ostream>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Code_disk_cache
+ *
+ * \brief Store the results of the costly code constructions (frozen bits, generator matrices, ...) in a directory.
+ *
+ * The entries are content addressed: the file name is a hash of the key (built from all the construction parameters
+ * and inputs) and of the version of the simulator, so a new version never reads the constructions of an older one.
+ * The hash is not cryptographic, it only names the files: the whole key is stored in the entry and compared on load.
+ * The keys have thus to contain the full inputs of the construction (a parity matrix for instance), not a hash of
+ * them. A missing, stale or corrupted entry is silently rebuilt and
+ * a failure to write an entry is ignored (the cache is only an optimization). The entries are written in a temporary
+ * file and then renamed, so many simulations can share the same directory at the same time.
+ *
+ * The cache is disabled until a directory is given with 'set_directory'.
+ */
+class Code_disk_cache
+{
+private:
+	static std::string directory;
+
+public:
+	/*!
+	 * \brief Set the cache directory (created if it does not exist), an empty string disables the cache.
+	 */
+	static void set_directory(const std::string &directory);
+
+	static const std::string& get_directory();
+
+	static bool is_enabled();
+
+	/*!
+	 * \brief Load the data of an entry in place (the file is memory mapped when it is possible).
+	 *
+	 * \param key:  unique string built from all the parameters and inputs of the construction.
+	 * \param read: reads the data of the entry ('data' is only valid during the call), returns false if the data are
+	 *              invalid.
+	 *
+	 * \return true if the entry exists and is valid.
+	 */
+	static bool load(const std::string &key, const std::function<bool(const char *data, const size_t size)> &read);
+
+	/*!
+	 * \brief Save the data of an entry (nothing is done if the cache is disabled).
+	 *
+	 * \param key:   unique string built from all the parameters and inputs of the construction.
+	 * \param write: writes the data of the entry in the given stream.
+	 */
+	static void save(const std::string &key, const std::function<void(std::ostream &stream)> &write);
+
+	static bool load(const std::string &key, std::string &data);
+
+	static void save(const std::string &key, const std::string &data);
+
+	template <typename T>
+	static bool load(const std::string &key, std::vector<T> &data);
+
+	template <typename T>
+	static void save(const std::string &key, const std::vector<T> &data);
+
+private:
+	// 64-bit FNV-1a hash of the given data as a 16 characters hexadecimal string
+	static std::string hash(const std::string &data);
+
+	static std::string get_stamp(const std::string &key);
+	static std::string get_path (const std::string &stamp);
+};
+}
+}
+
+#include "Tools/Code/Code_disk_cache.hxx"
+
+#endif /* CODE_DISK_CACHE_HPP_ */
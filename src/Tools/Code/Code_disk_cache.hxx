@@ -0,0 +1,39 @@
+#include <type_traits>
+#include <cstring>
+
+#include "Tools/Code/Code_disk_cache.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <typename T>
+bool Code_disk_cache
+::load(const std::string &key, std::vector<T> &data)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "'T' has to be trivially copyable.");
+
+	return Code_disk_cache::load(key, [&data](const char *bytes, const size_t size)
+	{
+		if (size % sizeof(T))
+			return false;
+
+		data.resize(size / sizeof(T));
+		std::memcpy((void*)data.data(), bytes, size);
+		return true;
+	});
+}
+
+template <typename T>
+void Code_disk_cache
+::save(const std::string &key, const std::vector<T> &data)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "'T' has to be trivially copyable.");
+
+	Code_disk_cache::save(key, [&data](std::ostream &stream)
+	{
+		stream.write((const char*)data.data(), data.size() * sizeof(T));
+	});
+}
+}
+}
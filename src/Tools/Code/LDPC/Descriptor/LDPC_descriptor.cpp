@@ -0,0 +1,212 @@
+#include <sstream>
+#include <fstream>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/LDPC/AList/AList.hpp"
+#include "Tools/Code/Code_descriptor_cache.hpp"
+#include "Tools/Code/Code_disk_cache.hpp"
+#include "Tools/Code/LDPC/Descriptor/LDPC_descriptor.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+namespace
+{
+// binary form of a sparse matrix: | n_rows | n_cols | for each row: | degree | column indexes | | (32-bit integers)
+void write_binary(const Sparse_matrix &matrix, std::ostream &stream)
+{
+	const uint32_t sizes[2] = {(uint32_t)matrix.get_n_rows(), (uint32_t)matrix.get_n_cols()};
+	stream.write((const char*)sizes, sizeof(sizes));
+
+	for (auto &cols : matrix.get_row_to_cols())
+	{
+		const uint32_t degree = (uint32_t)cols.size();
+		stream.write((const char*)&degree, sizeof(degree));
+		stream.write((const char*)cols.data(), cols.size() * sizeof(cols[0]));
+	}
+}
+
+// binary form of the info bits positions: | n_positions | positions | (32-bit integers)
+void write_binary(const LDPC_matrix_handler::Positions_vector &positions, std::ostream &stream)
+{
+	const uint32_t n_positions = (uint32_t)positions.size();
+	stream.write((const char*)&n_positions, sizeof(n_positions));
+	stream.write((const char*)positions.data(), positions.size() * sizeof(positions[0]));
+}
+
+// read G and its info bits positions in place (they are written in binary form one after the other), return false if
+// the data are invalid
+bool read_binary(const char *data, const size_t size, Sparse_matrix &matrix,
+                 LDPC_matrix_handler::Positions_vector &positions)
+{
+	const auto end = data + size;
+	auto read_u32 = [&data, end](uint32_t &value)
+	{
+		if (end - data < (std::ptrdiff_t)sizeof(value))
+			return false;
+		std::memcpy(&value, data, sizeof(value));
+		data += sizeof(value);
+		return true;
+	};
+
+	uint32_t n_rows, n_cols;
+	if (!read_u32(n_rows) || !read_u32(n_cols))
+		return false;
+
+	Sparse_matrix m(n_rows, n_cols);
+	for (uint32_t r = 0; r < n_rows; r++)
+	{
+		uint32_t degree;
+		if (!read_u32(degree))
+			return false;
+
+		for (uint32_t d = 0; d < degree; d++)
+		{
+			uint32_t c;
+			if (!read_u32(c) || c >= n_cols)
+				return false;
+			m.add_connection(r, c);
+		}
+	}
+
+	uint32_t n_positions;
+	if (!read_u32(n_positions) || (size_t)(end - data) != n_positions * sizeof(uint32_t))
+		return false;
+
+	positions.resize(n_positions);
+	std::memcpy((void*)positions.data(), data, n_positions * sizeof(uint32_t));
+
+	matrix = std::move(m);
+	return true;
+}
+}
+
+LDPC_descriptor
+::LDPC_descriptor(const std::string &enc_type,
+                  const int K,
+                  const int N,
+                  const int N_cw,
+                  const std::string &G_path,
+                  const std::string &H_path,
+                  const std::string &H_reorder,
+                  const std::string &G_method,
+                  const std::string &G_save_path,
+                  const bool read_pattern)
+{
+	if (enc_type == "LDPC")
+	{
+		G = LDPC_matrix_handler::read(G_path, &info_bits_pos);
+	}
+	else if (enc_type == "LDPC_DVBS2")
+	{
+		dvbs2 = build_dvbs2(K, N);
+		H     = build_H(*dvbs2);
+	}
+
+	if (H.get_n_connections() == 0)
+	{
+		LDPC_matrix_handler::Positions_vector* ibp = nullptr;
+		std::vector<bool>* pct = nullptr;
+
+		if (info_bits_pos.empty())
+			ibp = &info_bits_pos;
+
+		if (read_pattern)
+			pct = &pct_pattern;
+
+		H = LDPC_matrix_handler::read(H_path, ibp, pct);
+	}
+
+	if (H_reorder != "NONE")
+	{	// reorder the H matrix following the check node degrees
+		H.sort_cols_per_density(H_reorder == "ASC" ? Matrix::Sort::ASCENDING : Matrix::Sort::DESCENDING);
+	}
+
+	if (!info_bits_pos.empty())
+		LDPC_matrix_handler::check_info_pos(info_bits_pos, K, N_cw);
+
+	if (enc_type == "LDPC_H")
+	{
+		// the G matrix generation is the most time consuming step of the codec construction
+		auto H_hor = H.turn(Matrix::Way::HORIZONTAL);
+
+		// G only depends on H and on the generation method: look for it in the on disk cache, the whole H is part of
+		// the key (the cache compares the keys on load)
+		std::string cache_key;
+		if (Code_disk_cache::is_enabled())
+		{
+			std::stringstream H_bin;
+			write_binary(H_hor, H_bin);
+			cache_key = "LDPC_G|" + G_method + "|" + H_bin.str();
+		}
+
+		auto read_G = [this](const char *data, const size_t size)
+		{
+			return read_binary(data, size, this->G, this->G_info_bits_pos);
+		};
+
+		if (cache_key.empty() || !Code_disk_cache::load(cache_key, read_G))
+		{
+			if (G_method == "IDENTITY")
+				G = LDPC_matrix_handler::transform_H_to_G_identity(H_hor, G_info_bits_pos);
+			else if (G_method == "LU_DEC")
+				G = LDPC_matrix_handler::transform_H_to_G_decomp_LU(H_hor, G_info_bits_pos);
+			else
+			{
+				std::stringstream message;
+				message << "Generation method of G 'G_method' is unknown ('G_method' = \"" << G_method << "\").";
+				throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+			}
+
+			if (!cache_key.empty())
+				Code_disk_cache::save(cache_key, [this](std::ostream &stream)
+				{
+					write_binary(this->G,               stream);
+					write_binary(this->G_info_bits_pos, stream);
+				});
+		}
+
+		if (G_save_path != "")
+		{
+			std::ofstream file(G_save_path);
+			if (!file.is_open())
+			{
+				std::stringstream message;
+				message << "'G_save_path' could not be opened ('G_save_path' = \"" << G_save_path << "\").";
+				throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+			}
+
+			AList::write(G, file);
+			AList::write_info_bits_pos(G_info_bits_pos, file);
+		}
+
+		if (info_bits_pos.empty())
+			info_bits_pos = G_info_bits_pos;
+	}
+}
+
+std::shared_ptr<const LDPC_descriptor> LDPC_descriptor
+::get(const std::string &enc_type,
+      const int K,
+      const int N,
+      const int N_cw,
+      const std::string &G_path,
+      const std::string &H_path,
+      const std::string &H_reorder,
+      const std::string &G_method,
+      const std::string &G_save_path,
+      const bool read_pattern)
+{
+	std::stringstream key;
+	key << enc_type << "|" << K << "|" << N << "|" << N_cw << "|" << G_path << "|" << H_path << "|" << H_reorder
+	    << "|" << G_method << "|" << G_save_path << "|" << read_pattern;
+
+	return Code_descriptor_cache<LDPC_descriptor>::get(key.str(), [&]() -> LDPC_descriptor*
+	{
+		return new LDPC_descriptor(enc_type, K, N, N_cw, G_path, H_path, H_reorder, G_method, G_save_path,
+		                           read_pattern);
+	});
+}
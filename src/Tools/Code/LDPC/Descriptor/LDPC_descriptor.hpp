@@ -0,0 +1,80 @@
+/*!
+ * \file
+ * \brief Read-only description of a LDPC code (parity and generator matrices, information bits positions, ...).
+ */
+#ifndef LDPC_DESCRIPTOR_HPP_
+#define LDPC_DESCRIPTOR_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Code/LDPC/Standard/DVBS2/DVBS2_constants.hpp"
+#include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \struct LDPC_descriptor
+ *
+ * \brief Everything that can be computed once per LDPC code and then shared by all the codecs (one per thread).
+ */
+struct LDPC_descriptor
+{
+public:
+	Sparse_matrix H; /*!< Parity matrix (reordered if requested). */
+	Sparse_matrix G; /*!< Generator matrix (read from a file or generated from H for the 'LDPC_H' encoder). */
+	LDPC_matrix_handler::Positions_vector info_bits_pos;     /*!< Info. bits positions (read from the files). */
+	LDPC_matrix_handler::Positions_vector G_info_bits_pos;   /*!< Info. bits positions related to the generated G. */
+	std::vector<bool>                     pct_pattern;       /*!< Puncturing pattern (read from the H file). */
+	std::unique_ptr<dvbs2_values>         dvbs2;             /*!< DVB-S2 constants (only for 'LDPC_DVBS2'). */
+
+	/*!
+	 * \brief Build the descriptor (read the matrices from the files, reorder H, generate G, ...).
+	 *
+	 * \param enc_type:     type of the encoder ('LDPC', 'LDPC_H', 'LDPC_DVBS2', ...).
+	 * \param K:            number of information bits.
+	 * \param N:            codeword size (after puncturing, used for DVB-S2).
+	 * \param N_cw:         codeword size (before puncturing).
+	 * \param G_path:       path to the generator matrix (only for the 'LDPC' encoder).
+	 * \param H_path:       path to the parity matrix.
+	 * \param H_reorder:    reorder the H columns according to their density ('NONE', 'ASC' or 'DSC').
+	 * \param G_method:     method to generate G from H ('IDENTITY' or 'LU_DEC', only for 'LDPC_H').
+	 * \param G_save_path:  path to save the generated G matrix (empty to disable).
+	 * \param read_pattern: read the puncturing pattern from the H file.
+	 */
+	LDPC_descriptor(const std::string &enc_type,
+	                const int K,
+	                const int N,
+	                const int N_cw,
+	                const std::string &G_path,
+	                const std::string &H_path,
+	                const std::string &H_reorder,
+	                const std::string &G_method,
+	                const std::string &G_save_path,
+	                const bool read_pattern);
+
+	virtual ~LDPC_descriptor() = default;
+
+	/*!
+	 * \brief Same parameters as the constructor, return a descriptor shared by all the callers with the same
+	 *        parameters (the descriptor is built only once).
+	 */
+	static std::shared_ptr<const LDPC_descriptor> get(const std::string &enc_type,
+	                                                  const int K,
+	                                                  const int N,
+	                                                  const int N_cw,
+	                                                  const std::string &G_path,
+	                                                  const std::string &H_path,
+	                                                  const std::string &H_reorder,
+	                                                  const std::string &G_method,
+	                                                  const std::string &G_save_path,
+	                                                  const bool read_pattern);
+};
+}
+}
+
+#endif /* LDPC_DESCRIPTOR_HPP_ */
@@ -1,6 +1,7 @@
 #ifndef LDPC_SYNDROME_HPP_
 #define LDPC_SYNDROME_HPP_
 
+#include <cstddef>
 #include <vector>
 
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
@@ -23,6 +24,10 @@ public:
 
 	template <typename R>
 	static inline bool check_soft(const R *Y_N, const Sparse_matrix &H);
+
+	// only check the nodes in ['first_chk';'last_chk'[ (the matrix has to be in the vertical way)
+	template <typename R>
+	static inline bool check_soft(const R *Y_N, const Sparse_matrix &H, const size_t first_chk, const size_t last_chk);
 };
 }
 }
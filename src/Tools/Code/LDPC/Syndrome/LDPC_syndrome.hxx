@@ -43,11 +43,18 @@ bool LDPC_syndrome
 template <typename R>
 bool LDPC_syndrome
 ::check_soft(const R *Y_N, const Sparse_matrix &H)
+{
+	return LDPC_syndrome::check_soft<R>(Y_N, H, 0, H.get_n_cols());
+}
+
+template <typename R>
+bool LDPC_syndrome
+::check_soft(const R *Y_N, const Sparse_matrix &H, const size_t first_chk, const size_t last_chk)
 {
 	auto syndrome = false;
 
-	const auto n_chk_nodes = (int)H.get_n_cols();
-	auto c = 0;
+	const auto n_chk_nodes = (int)last_chk;
+	auto c = (int)first_chk;
 	while (c < n_chk_nodes && !syndrome)
 	{
 		auto sign = 0;
@@ -7,6 +7,8 @@
 
 #include "Tools/Noise/noise_utils.h"
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Code/Code_disk_cache.hpp"
+#include "Tools/Code/Code_descriptor_cache.hpp"
 #include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator.hpp"
 
 using namespace aff3ct;
@@ -60,7 +62,30 @@ void Frozenbits_generator
 		throw length_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	this->evaluate();
+	const auto cache_key = this->get_cache_key();
+	if (cache_key.empty())
+	{
+		this->best_channels.resize(N);
+		this->evaluate();
+	}
+	else
+	{
+		// the best channels are evaluated (or loaded from the disk) once and shared by the generators of the other
+		// simulation threads, the generators which are still evaluating with the same key wait for the result
+		this->shared_best_channels = Code_descriptor_cache<std::vector<uint32_t>>::get(cache_key,
+			[this, &cache_key]() -> std::vector<uint32_t>*
+			{
+				if (!Code_disk_cache::load(cache_key, this->best_channels) || this->best_channels.size() != (size_t)N)
+				{
+					this->best_channels.resize(N);
+					this->evaluate();
+
+					Code_disk_cache::save(cache_key, this->best_channels);
+				}
+				return new std::vector<uint32_t>(this->best_channels);
+			});
+		this->best_channels = *this->shared_best_channels;
+	}
 
 	// init frozen_bits vector, true means frozen bits, false means information bits
 	std::fill(frozen_bits.begin(), frozen_bits.end(), true);
@@ -97,6 +122,12 @@ const std::vector<uint32_t>& Frozenbits_generator
 	return best_channels;
 }
 
+std::string Frozenbits_generator
+::get_cache_key()
+{
+	return "";
+}
+
 void Frozenbits_generator
 ::check_noise()
 {
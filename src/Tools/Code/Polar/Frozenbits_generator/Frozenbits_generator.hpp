@@ -38,6 +38,9 @@ protected:
 
 	std::vector<uint32_t> best_channels; /*!< The best channels in a codeword sorted by descending order. */
 
+	std::shared_ptr<const std::vector<uint32_t>> shared_best_channels; /*!< The best channels shared by the
+	                                                                        generators with the same cache key. */
+
 public:
 	/*!
 	 * \brief Constructor.
@@ -97,6 +100,15 @@ protected:
 	 */
 	virtual void evaluate() = 0;
 
+	/*!
+	 * \brief Gets the key of the best channels in the on disk cache (see Code_disk_cache) and in the cache shared by
+	 *        the generators of the process (see Code_descriptor_cache).
+	 *
+	 * \return a string built from all the parameters of the evaluation, or an empty string to disable the caches (the
+	 *         default, for the generators which are cheaper than a cache access).
+	 */
+	virtual std::string get_cache_key();
+
 	/*!
 	 * \brief Check that the noise has the expected type
 	 */
@@ -2,6 +2,9 @@
 #define _USE_MATH_DEFINES
 #endif
 #include <algorithm>
+#include <sstream>
+#include <iomanip>
+#include <limits>
 #include <cmath>
 
 #include "Tools/Noise/Noise.hpp"
@@ -57,4 +60,15 @@ void Frozenbits_generator_BEC
 	Frozenbits_generator::check_noise();
 
 	this->n->is_of_type_throw(tools::Noise_type::EP);
-}
\ No newline at end of file
+}
+
+std::string Frozenbits_generator_BEC
+::get_cache_key()
+{
+	this->check_noise();
+
+	std::stringstream key;
+	key << "polar_best_channels_BEC|N" << this->N << "|" << std::setprecision(std::numeric_limits<float>::max_digits10)
+	    << this->n->get_noise();
+	return key.str();
+}
@@ -0,0 +1,245 @@
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <cmath>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/fft.h"
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_DE.hpp"
+
+using namespace aff3ct::tools;
+
+Frozenbits_generator_DE
+::Frozenbits_generator_DE(const int K, const int N, const std::string &channel_type, const int n_bins,
+                          const double step, const size_t n_threads, const std::string &dump_channels_path,
+                          const bool dump_channels_single_thread)
+: Frozenbits_generator_tree<C>(K, N, n_threads, dump_channels_path, dump_channels_single_thread),
+  channel_type(channel_type),
+  h(n_bins / 2),
+  step(step),
+  window(0),
+  e_half(n_bins / 2 +1)
+{
+	if (channel_type != "AWGN" && channel_type != "BSC")
+	{
+		std::stringstream message;
+		message << "'channel_type' has to be 'AWGN' or 'BSC' ('channel_type' = " << channel_type << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_bins < 5 || n_bins % 2 == 0)
+	{
+		std::stringstream message;
+		message << "'n_bins' has to be an odd number greater or equal to 5 ('n_bins' = " << n_bins << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (step <= 0.)
+	{
+		std::stringstream message;
+		message << "'step' has to be strictly positive ('step' = " << step << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto i = 0; i <= this->h; i++)
+		this->e_half[i] = std::exp(-0.5 * (double)i * this->step);
+
+	// |a [+] b| = min(|a|,|b|) - delta with delta <= exp(-||a| - |b||): beyond 'window' bins, the rounded output
+	// magnitude is the smallest input one
+	this->window = std::min(this->h, (int)std::ceil(std::log(2. / this->step) / this->step) +1);
+	this->cn_table.resize((this->h +1) * (this->window +1));
+	for (auto i = 0; i <= this->h; i++)
+		for (auto d = 0; d <= this->window; d++)
+		{
+			const auto j = std::min(i + d, this->h);
+			const auto t = std::tanh(0.5 * i * this->step) * std::tanh(0.5 * j * this->step);
+			const auto o = 2. * std::atanh(t) / this->step;
+			this->cn_table[i * (this->window +1) + d] = std::isfinite(o) ? std::min(i, (int)std::round(o)) : i;
+		}
+}
+
+void Frozenbits_generator_DE
+::normalize(C &w) const
+{
+	// the probability of the magnitude i is w[i] (exp(m_i/2) + exp(-m_i/2))
+	auto sum = w[0];
+	for (auto i = 1; i <= this->h; i++)
+		sum += w[i] * (1. / this->e_half[i] + this->e_half[i]);
+
+	if (sum > 0.)
+		for (auto &v : w)
+			v /= sum;
+}
+
+void Frozenbits_generator_DE
+::init_channel(C &w)
+{
+	const auto n = 2 * this->h +1;
+	std::vector<double> p(n, 0.); // the (not tilted) density, p[h] is LLR = 0
+
+	const auto noise = (double)this->n->get_noise();
+	if (this->channel_type == "BSC")
+	{
+		const auto pr  = std::min(noise, 1. - noise);
+		const auto llr = pr > 0. ? std::min(std::log((1. - pr) / pr), this->h * this->step) : this->h * this->step;
+		const auto pos = llr / this->step;
+		const auto i0  = std::min((int)pos, this->h -1);
+		const auto fr  = pos - i0;
+
+		// the masses are split between the two closest bins
+		p[this->h + i0   ] += (1. - fr) * (1. - pr);
+		p[this->h + i0 +1] +=       fr  * (1. - pr);
+		p[this->h - i0   ] += (1. - fr) *       pr;
+		p[this->h - i0 -1] +=       fr  *       pr;
+	}
+	else // AWGN with a BPSK modulation: LLR ~ N(2/sigma^2, 4/sigma^2)
+	{
+		const auto mean = 2. / (noise * noise);
+		const auto dev  = 2. / noise;
+		const auto cdf  = [&](const double x) { return 0.5 * std::erfc(-(x - mean) / (dev * std::sqrt(2.))); };
+		const auto ccdf = [&](const double x) { return 0.5 * std::erfc( (x - mean) / (dev * std::sqrt(2.))); };
+		const auto inf  = std::numeric_limits<double>::infinity();
+
+		for (auto k = 0; k < n; k++)
+		{
+			const auto llr = (k - this->h) * this->step;
+			const auto lo  = k == 0     ? -inf : llr - 0.5 * this->step;
+			const auto hi  = k == n -1  ? +inf : llr + 0.5 * this->step;
+			// compute the mass from the closest tail to keep the relative precision
+			p[k] = llr < mean ? cdf(hi) - cdf(lo) : ccdf(lo) - ccdf(hi);
+		}
+	}
+
+	w.resize(this->h +1);
+	w[0] = p[this->h];
+	for (auto i = 1; i <= this->h; i++)
+		w[i] = 0.5 * (p[this->h + i] * this->e_half[i] + p[this->h - i] / this->e_half[i]);
+	this->normalize(w);
+}
+
+void Frozenbits_generator_DE
+::minus(const C &w, C &w_m)
+{
+	// densities of the magnitudes for the positive and the negative LLRs
+	std::vector<double> pp(this->h +1), pn(this->h +1);
+	pp[0] = pn[0] = 0.5 * w[0];
+	for (auto i = 1; i <= this->h; i++)
+	{
+		pp[i] = w[i] / this->e_half[i];
+		pn[i] = w[i] * this->e_half[i];
+	}
+
+	std::vector<double> sp(this->h +2, 0.), sn(this->h +2, 0.);
+	for (auto i = this->h; i >= 0; i--)
+	{
+		sp[i] = sp[i +1] + pp[i];
+		sn[i] = sn[i +1] + pn[i];
+	}
+
+	// the sign of the output is the product of the signs, (i,j) and (j,i) give the same output
+	std::vector<double> op(this->h +1, 0.), on(this->h +1, 0.);
+	for (auto i = 0; i <= this->h; i++)
+	{
+		const auto d_max = std::min(this->window, this->h - i);
+		const auto table = this->cn_table.data() + i * (this->window +1);
+		for (auto d = 0; d <= d_max; d++)
+		{
+			const auto j = i + d;
+			const auto f = d ? 2. : 1.;
+			const auto o = table[d];
+			op[o] += f * (pp[i] * pp[j] + pn[i] * pn[j]);
+			on[o] += f * (pp[i] * pn[j] + pn[i] * pp[j]);
+		}
+
+		const auto j = i + this->window +1;
+		if (j <= this->h)
+		{
+			op[i] += 2. * (pp[i] * sp[j] + pn[i] * sn[j]);
+			on[i] += 2. * (pp[i] * sn[j] + pn[i] * sp[j]);
+		}
+	}
+
+	w_m.resize(this->h +1);
+	w_m[0] = op[0] + on[0];
+	for (auto o = 1; o <= this->h; o++)
+		w_m[o] = 0.5 * (op[o] * this->e_half[o] + on[o] / this->e_half[o]);
+	this->normalize(w_m);
+}
+
+void Frozenbits_generator_DE
+::plus(const C &w, C &w_p)
+{
+	// the output density is the convolution of the input densities (the LLRs are added), in the tilted domain too.
+	// The saturated magnitude 'a' is made of two Diracs in +/-M:
+	// q * q = a^2 (d(2M) + 2d(0) + d(-2M)) + 2a (r(L - M) + r(L + M)) + r * r, only 'r' is convolved with the FFT
+	const auto a = w[this->h];
+	std::vector<double> r_q(2 * this->h -1), r_p(2 * this->h -1);
+	auto s_q = 0., s_p = 0.;
+	for (auto j = 0; j < (int)r_q.size(); j++)
+	{
+		const auto i = std::abs(j - (this->h -1));
+		r_q[j] = w[i];
+		r_p[j] = j < this->h -1 ? w[i] * this->e_half[i] : w[i] / this->e_half[i];
+		s_q += r_q[j];
+		s_p += r_p[j];
+	}
+
+	// the FFT rounding errors are relative to the largest values: in the tilted domain (r_q) they are amplified by
+	// exp(L/2) on the large LLRs, in the probability domain (r_p) they drown the small masses. Both convolutions are
+	// computed and the most accurate one is kept for each bin. They share the same FFTs: 'r_p' is scaled to the mass
+	// of 'r_q' to not add its rounding errors to the ones of 'r_q'.
+	const auto scale = s_q > 0. && s_p > 0. ? s_q / s_p : 1.;
+	for (auto &v : r_p)
+		v *= scale;
+
+	std::vector<double> c_q, c_p;
+	auto_convolution(r_q, r_p, c_q, c_p);
+
+	w_p.assign(this->h +1, 0.);
+	for (auto i = 0; i < this->h; i++)
+	{
+		const auto k = 2 * (this->h -1) + i;
+		const auto use_p = s_p * s_p * this->e_half[i] < s_q * s_q;
+		w_p[i] = std::max(use_p ? c_p[k] / (scale * scale) * this->e_half[i] : c_q[k], 0.);
+	}
+	for (auto i = 1; i < this->h; i++)
+		w_p[i] += 2. * a * w[this->h - i];
+	w_p[0] += 2. * a * a;
+
+	// the saturated mass is deduced from the other ones (the total probability is 1): the FFT rounding errors on the
+	// saturated LLRs would be amplified by exp(M/2)
+	auto sum = w_p[0];
+	for (auto i = 1; i < this->h; i++)
+		sum += w_p[i] * (1. / this->e_half[i] + this->e_half[i]);
+	w_p[this->h] = std::max(1. - sum, 0.) / (1. / this->e_half[this->h] + this->e_half[this->h]);
+}
+
+double Frozenbits_generator_DE
+::error_probability(const C &w)
+{
+	auto pe = 0.5 * w[0];
+	for (auto i = 1; i <= this->h; i++)
+		pe += w[i] * this->e_half[i];
+	return pe;
+}
+
+void Frozenbits_generator_DE
+::check_noise()
+{
+	Frozenbits_generator::check_noise();
+
+	this->n->is_of_type_throw(this->channel_type == "BSC" ? tools::Noise_type::EP : tools::Noise_type::SIGMA);
+}
+
+std::string Frozenbits_generator_DE
+::get_cache_key()
+{
+	this->check_noise();
+
+	std::stringstream key;
+	key << "polar_best_channels_DE|" << this->channel_type << "|bins" << (2 * this->h +1) << "|step"
+	    << std::setprecision(std::numeric_limits<double>::max_digits10) << this->step << "|N" << this->N << "|"
+	    << std::setprecision(std::numeric_limits<float>::max_digits10) << this->n->get_noise();
+	return key.str();
+}
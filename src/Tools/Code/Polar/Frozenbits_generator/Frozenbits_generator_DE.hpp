@@ -0,0 +1,60 @@
+#ifndef FROZENBITS_GENERATOR_DE_HPP_
+#define FROZENBITS_GENERATOR_DE_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_tree.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Density evolution construction: the LLR density of each bit channel is tracked on a uniform grid of 'n_bins' bins
+ * (of width 'step', centered on LLR = 0, the last bins accumulate the saturated LLRs). The variable nodes convolve
+ * the densities with a FFT, the check nodes combine the quantized magnitudes with a lookup table (the output
+ * magnitude is the smallest input one as soon as the inputs are far enough, so only a few pairs of bins need the
+ * table).
+ * The densities are stored tilted by exp(-LLR/2): the density of a symmetric channel becomes an even function (only
+ * the magnitudes are stored) and the very small error probabilities of the best channels are not drowned in the
+ * rounding errors of the FFT.
+ * The AWGN channel (sigma noise) and the BSC (event probability noise) are supported.
+ */
+class Frozenbits_generator_DE : public Frozenbits_generator_tree<std::vector<double>>
+{
+	using C = std::vector<double>;
+
+private:
+	const std::string   channel_type;
+	const int           h;        // the number of magnitudes (n_bins = 2h +1), the last one holds the saturated LLRs
+	const double        step;
+	int                 window;   // the maximal distance between two magnitudes for which the table is needed
+	std::vector<int>    cn_table; // the check node output magnitude of (i, i+d), 0 <= d <= window
+	std::vector<double> e_half;   // exp(-LLR/2) for each magnitude
+
+public:
+	Frozenbits_generator_DE(const int K, const int N, const std::string &channel_type = "AWGN",
+	                        const int n_bins = 1023, const double step = 0.25, const size_t n_threads = 0,
+	                        const std::string &dump_channels_path = "",
+	                        const bool dump_channels_single_thread = true);
+
+	virtual ~Frozenbits_generator_DE() = default;
+
+protected:
+	void   init_channel     (C &w              );
+	void   minus            (const C &w, C &w_m);
+	void   plus             (const C &w, C &w_p);
+	double error_probability(const C &w        );
+
+	virtual void check_noise();
+	virtual std::string get_cache_key();
+
+private:
+	void normalize(C &w) const;
+};
+}
+}
+
+#endif /* FROZENBITS_GENERATOR_DE_HPP_ */
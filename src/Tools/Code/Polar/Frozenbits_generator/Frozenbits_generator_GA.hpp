@@ -41,6 +41,7 @@ protected:
 	double phi    (double t);
 	double phi_inv(double t);
 	virtual void check_noise();
+	virtual std::string get_cache_key();
 };
 }
 }
@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <cmath>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_TV_native.hpp"
+
+using namespace aff3ct::tools;
+
+// binary entropy function
+static double h2(const double p)
+{
+	if (p <= 0. || p >= 1.)
+		return 0.;
+	return -p * std::log2(p) - (1. - p) * std::log2(1. - p);
+}
+
+// probability that a Gaussian variable of mean 'mean' and standard deviation 'sigma' is in [lo, hi]
+static double gaussian_mass(const double lo, const double hi, const double mean, const double sigma)
+{
+	const auto q = [&](const double x) { return 0.5 * std::erfc((x - mean) / (sigma * std::sqrt(2.))); };
+	return q(lo) - (std::isinf(hi) ? 0. : q(hi));
+}
+
+Frozenbits_generator_TV_native
+::Frozenbits_generator_TV_native(const int K, const int N, const std::string &channel_type, const int mu,
+                                 const size_t n_threads, const std::string &dump_channels_path,
+                                 const bool dump_channels_single_thread)
+: Frozenbits_generator_tree<C>(K, N, n_threads, dump_channels_path, dump_channels_single_thread),
+  channel_type(channel_type),
+  mu(mu),
+  bins(mu / 2 -1)
+{
+	if (channel_type != "AWGN" && channel_type != "BSC")
+	{
+		std::stringstream message;
+		message << "'channel_type' has to be 'AWGN' or 'BSC' ('channel_type' = " << channel_type << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (mu < 4 || mu % 2)
+	{
+		std::stringstream message;
+		message << "'mu' has to be an even number greater or equal to 4 ('mu' = " << mu << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the posterior probability 'p' (in [0.5, 1]) of the bin boundary 'k' verifies: 1 - h2(p) = (k +1) / (mu / 2)
+	for (size_t k = 0; k < this->bins.size(); k++)
+	{
+		const auto capacity = (double)(k +1) / (double)(mu / 2);
+		auto lo = 0.5, hi = 1.;
+		for (auto it = 0; it < 64; it++)
+		{
+			const auto mid = 0.5 * (lo + hi);
+			(1. - h2(mid) < capacity ? lo : hi) = mid;
+		}
+		this->bins[k] = 0.5 * (lo + hi);
+	}
+}
+
+size_t Frozenbits_generator_TV_native
+::bin(const double a, const double b) const
+{
+	return std::upper_bound(this->bins.begin(), this->bins.end(), a / (a + b)) - this->bins.begin();
+}
+
+void Frozenbits_generator_TV_native
+::compact(C &w)
+{
+	w.erase(std::remove_if(w.begin(), w.end(), [](const std::pair<double,double> &s)
+	{
+		return s.first + s.second <= 0.;
+	}), w.end());
+}
+
+void Frozenbits_generator_TV_native
+::init_channel(C &w)
+{
+	w.assign(this->mu / 2, std::make_pair(0., 0.));
+
+	const auto noise = (double)this->n->get_noise();
+	if (this->channel_type == "BSC")
+	{
+		const auto p = std::min(noise, 1. - noise);
+		w[this->bin(1. - p, p)] = std::make_pair(1. - p, p);
+	}
+	else // AWGN with a BPSK modulation: y = 1 - 2u + n, the bins are mapped on y >= 0 (the conjugates are y < 0)
+	{
+		const auto sigma2 = noise * noise;
+		auto lo = 0.;
+		for (size_t k = 0; k <= this->bins.size(); k++)
+		{
+			// LLR = ln(p / (1 - p)) = 2y / sigma^2
+			const auto hi = k < this->bins.size() ?
+			                0.5 * sigma2 * std::log(this->bins[k] / (1. - this->bins[k])) :
+			                std::numeric_limits<double>::infinity();
+			w[k].first  = gaussian_mass(lo, hi, +1., noise);
+			w[k].second = gaussian_mass(lo, hi, -1., noise);
+			lo = hi;
+		}
+	}
+
+	compact(w);
+}
+
+void Frozenbits_generator_TV_native
+::minus(const C &w, C &w_m)
+{
+	// W-(y1,y2|u1) = 1/2 sum_u2 W(y1|u1^u2) W(y2|u2), the symbols (y1,y2) and (y1*,y2*) are merged (same likelihoods)
+	w_m.assign(this->mu / 2, std::make_pair(0., 0.));
+	for (size_t i = 0; i < w.size(); i++)
+		for (size_t j = i; j < w.size(); j++)
+		{
+			const auto f = i == j ? 1. : 2.; // (i,j) and (j,i) give the same symbol
+			const auto a = f * (w[i].first * w[j].first  + w[i].second * w[j].second);
+			const auto b = f * (w[i].first * w[j].second + w[i].second * w[j].first );
+			auto &s = w_m[this->bin(a, b)];
+			s.first  += a;
+			s.second += b;
+		}
+	compact(w_m);
+}
+
+void Frozenbits_generator_TV_native
+::plus(const C &w, C &w_p)
+{
+	// W+(y1,y2,u1|u2) = 1/2 W(y1|u1^u2) W(y2|u2): two kinds of symbols, (a1 a2, b1 b2) and (a1 b2, b1 a2)
+	w_p.assign(this->mu / 2, std::make_pair(0., 0.));
+	for (size_t i = 0; i < w.size(); i++)
+		for (size_t j = i; j < w.size(); j++)
+		{
+			const auto f = i == j ? 1. : 2.;
+
+			const auto a1 = f * w[i].first  * w[j].first;
+			const auto b1 = f * w[i].second * w[j].second;
+			auto &s1 = w_p[this->bin(a1, b1)];
+			s1.first  += a1;
+			s1.second += b1;
+
+			auto a2 = f * w[i].first  * w[j].second;
+			auto b2 = f * w[i].second * w[j].first;
+			if (a2 < b2) std::swap(a2, b2); // the conjugate symbol
+			if (a2 + b2 > 0.)
+			{
+				auto &s2 = w_p[this->bin(a2, b2)];
+				s2.first  += a2;
+				s2.second += b2;
+			}
+		}
+	compact(w_p);
+}
+
+double Frozenbits_generator_TV_native
+::error_probability(const C &w)
+{
+	// the ML decision fails on the symbols (y and y*) less likely under the sent bit
+	auto pe = 0.;
+	for (auto &s : w)
+		pe += s.second;
+	return pe;
+}
+
+void Frozenbits_generator_TV_native
+::check_noise()
+{
+	Frozenbits_generator::check_noise();
+
+	this->n->is_of_type_throw(this->channel_type == "BSC" ? tools::Noise_type::EP : tools::Noise_type::SIGMA);
+}
+
+std::string Frozenbits_generator_TV_native
+::get_cache_key()
+{
+	this->check_noise();
+
+	std::stringstream key;
+	key << "polar_best_channels_TV_NATIVE|" << this->channel_type << "|mu" << this->mu << "|N" << this->N << "|"
+	    << std::setprecision(std::numeric_limits<float>::max_digits10) << this->n->get_noise();
+	return key.str();
+}
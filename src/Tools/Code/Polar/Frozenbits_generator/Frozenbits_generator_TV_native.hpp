@@ -0,0 +1,55 @@
+#ifndef FROZENBITS_GENERATOR_TV_NATIVE_HPP_
+#define FROZENBITS_GENERATOR_TV_NATIVE_HPP_
+
+#include <cstddef>
+#include <utility>
+#include <string>
+#include <vector>
+
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_tree.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Built-in Tal-Vardy construction: each bit channel is approximated by a degraded channel with at most 'mu' output
+ * symbols. A channel is stored as a list of symbols 'y' with their conjugates, a symbol is the pair
+ * (W(y|0), W(y|1)) with W(y|0) >= W(y|1). After each transform the symbols are merged by bins of equal capacity
+ * (merging symbols is a degradation: the error probabilities are upper bounds).
+ * The AWGN channel (sigma noise) and the BSC (event probability noise) are supported.
+ */
+class Frozenbits_generator_TV_native : public Frozenbits_generator_tree<std::vector<std::pair<double,double>>>
+{
+	using C = std::vector<std::pair<double,double>>;
+
+private:
+	const std::string   channel_type;
+	const int           mu;
+	std::vector<double> bins; // the posterior probabilities bounding the bins of equal capacity
+
+public:
+	Frozenbits_generator_TV_native(const int K, const int N, const std::string &channel_type = "AWGN",
+	                               const int mu = 64, const size_t n_threads = 0,
+	                               const std::string &dump_channels_path = "",
+	                               const bool dump_channels_single_thread = true);
+
+	virtual ~Frozenbits_generator_TV_native() = default;
+
+protected:
+	void   init_channel     (C &w              );
+	void   minus            (const C &w, C &w_m);
+	void   plus             (const C &w, C &w_p);
+	double error_probability(const C &w        );
+
+	virtual void check_noise();
+	virtual std::string get_cache_key();
+
+private:
+	inline size_t bin(const double a, const double b) const;
+	static void compact(C &w);
+};
+}
+}
+
+#endif /* FROZENBITS_GENERATOR_TV_NATIVE_HPP_ */
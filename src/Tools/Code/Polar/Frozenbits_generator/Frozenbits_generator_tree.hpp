@@ -0,0 +1,70 @@
+/*!
+ * \file
+ * \brief Evaluates the polar bit channels by tracking a channel model along the polarization tree.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef FROZENBITS_GENERATOR_TREE_HPP_
+#define FROZENBITS_GENERATOR_TREE_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Frozenbits_generator_tree
+ * \brief Evaluates the polar bit channels by tracking a channel model along the polarization tree.
+ *
+ * \tparam C: the channel model (an output alphabet, a LLR density, ...).
+ *
+ * The root channel is transformed 'm' times by the 'minus' (check node) and the 'plus' (variable node) transforms,
+ * the bit channels are then sorted by their error probabilities. The first levels of the tree are computed
+ * sequentially, the remaining subtrees are independent and are dispatched over 'n_threads' threads.
+ */
+template <class C>
+class Frozenbits_generator_tree : public Frozenbits_generator
+{
+protected:
+	const int    m;
+	const size_t n_threads;
+
+	std::vector<double> pe; /*!< The error probability of each bit channel. */
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param K:         number of information bits in the frame.
+	 * \param N:         codeword size (or frame size).
+	 * \param n_threads: number of threads used to evaluate the bit channels (0 means one per hardware thread).
+	 */
+	Frozenbits_generator_tree(const int K, const int N, const size_t n_threads = 0,
+	                          const std::string &dump_channels_path = "",
+	                          const bool dump_channels_single_thread = true);
+
+	virtual ~Frozenbits_generator_tree() = default;
+
+protected:
+	void evaluate();
+
+	virtual void   init_channel     (C &w                   ) = 0; /*!< Builds the channel seen by the codeword bits. */
+	virtual void   minus            (const C &w, C &w_minus ) = 0; /*!< Builds W- from W (check node). */
+	virtual void   plus             (const C &w, C &w_plus  ) = 0; /*!< Builds W+ from W (variable node). */
+	virtual double error_probability(const C &w             ) = 0; /*!< ML decision error probability of W. */
+
+private:
+	void evaluate_subtree(const C &w, const int depth, const size_t idx);
+};
+}
+}
+
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_tree.hxx"
+
+#endif /* FROZENBITS_GENERATOR_TREE_HPP_ */
@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <exception>
+#include <atomic>
+#include <thread>
+#include <cmath>
+
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_tree.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <class C>
+Frozenbits_generator_tree<C>
+::Frozenbits_generator_tree(const int K, const int N, const size_t n_threads, const std::string &dump_channels_path,
+                            const bool dump_channels_single_thread)
+: Frozenbits_generator(K, N, dump_channels_path, dump_channels_single_thread),
+  m((int)std::log2(N)),
+  n_threads(n_threads ? n_threads : std::max((size_t)1, (size_t)std::thread::hardware_concurrency())),
+  pe(N, 0.)
+{
+}
+
+template <class C>
+void Frozenbits_generator_tree<C>
+::evaluate()
+{
+	this->check_noise();
+
+	// the channel at depth 'd' and position 'idx' gives W- at 'idx' and W+ at 'idx + N / 2^(d+1)' (same bit channels
+	// order as in the GA generator)
+	std::vector<C>      layer    (1);
+	std::vector<size_t> layer_idx(1, 0);
+	this->init_channel(layer[0]);
+
+	// compute sequentially the first levels to get enough subtrees to balance the load between the threads
+	auto depth = 0;
+	const auto n_subtrees = this->n_threads > 1 ? 8 * this->n_threads : 1;
+	while (depth < this->m && layer.size() < n_subtrees)
+	{
+		std::vector<C>      next    (2 * layer.size());
+		std::vector<size_t> next_idx(2 * layer.size());
+		const auto half = (size_t)this->N >> (depth +1);
+		for (size_t t = 0; t < layer.size(); t++)
+		{
+			this->minus(layer[t], next[2 * t +0]);
+			this->plus (layer[t], next[2 * t +1]);
+			next_idx[2 * t +0] = layer_idx[t];
+			next_idx[2 * t +1] = layer_idx[t] + half;
+		}
+		layer    .swap(next    );
+		layer_idx.swap(next_idx);
+		depth++;
+	}
+
+	std::atomic<size_t> next_subtree(0);
+	std::exception_ptr  error;
+	std::atomic<bool>   failed(false);
+	auto thread_loop = [&]()
+	{
+		try
+		{
+			for (auto t = next_subtree++; t < layer.size() && !failed; t = next_subtree++)
+				this->evaluate_subtree(layer[t], depth, layer_idx[t]);
+		}
+		catch (...)
+		{
+			if (!failed.exchange(true))
+				error = std::current_exception();
+		}
+	};
+
+	const auto n_workers = std::min(this->n_threads, layer.size());
+	std::vector<std::thread> threads;
+	for (size_t tid = 1; tid < n_workers; tid++)
+		threads.push_back(std::thread(thread_loop));
+	thread_loop();
+	for (auto &t : threads)
+		t.join();
+
+	if (error)
+		std::rethrow_exception(error);
+
+	// the best channels first, a tie (saturated error probabilities) is broken in favor of the most "plus" channel
+	for (unsigned i = 0; i != this->best_channels.size(); i++)
+		this->best_channels[i] = i;
+	std::sort(this->best_channels.begin(), this->best_channels.end(), [this](uint32_t i1, uint32_t i2)
+	{
+		return pe[i1] < pe[i2] || (pe[i1] == pe[i2] && i1 > i2);
+	});
+}
+
+template <class C>
+void Frozenbits_generator_tree<C>
+::evaluate_subtree(const C &w, const int depth, const size_t idx)
+{
+	if (depth == this->m)
+	{
+		this->pe[idx] = this->error_probability(w);
+		return;
+	}
+
+	C w_child;
+	this->minus(w, w_child);
+	this->evaluate_subtree(w_child, depth +1, idx);
+	this->plus(w, w_child);
+	this->evaluate_subtree(w_child, depth +1, idx + ((size_t)this->N >> (depth +1)));
+}
+}
+}
@@ -106,6 +106,20 @@ __forceinline R v_LR(const R& a, const R& b);
 template <typename R>
 __forceinline R v_LLR(const R& a, const R& b);
 
+template <typename R>
+__forceinline mipp::Reg<R> f_LLR_r(const mipp::Reg<R>& r_lambda_a, const mipp::Reg<R>& r_lambda_b);
+
+template <typename R>
+__forceinline mipp::Reg<R> v_LLR_r(const mipp::Reg<R>& r_a, const mipp::Reg<R>& r_b);
+
+// l_c[i] = f(l_a[i], v(l_b[i], l_d[i])) for i in [0;n_elmts[ (soft-output decoders)
+template <typename R>
+inline void fv_LLR(const R *l_a, const R *l_b, const R *l_d, R *l_c, const int n_elmts);
+
+// l_c[i] = v(l_a[i], f(l_b[i], l_d[i])) for i in [0;n_elmts[ (soft-output decoders)
+template <typename R>
+inline void vf_LLR(const R *l_a, const R *l_b, const R *l_d, R *l_c, const int n_elmts);
+
 template <typename B>
 __forceinline B xo_STD(const B& u_a, const B& u_b);
 
@@ -247,6 +247,67 @@ inline R v_LLR(const R& a, const R& b)
 	return g0_LLR<R>(a, b);
 }
 
+template <typename R>
+inline mipp::Reg<R> f_LLR_r(const mipp::Reg<R>& r_lambda_a, const mipp::Reg<R>& r_lambda_b)
+{
+	const auto r_min_abs_lambda = mipp::min(mipp::abs(r_lambda_a), mipp::abs(r_lambda_b));
+	return mipp::neg(r_min_abs_lambda, mipp::sign(r_lambda_a) ^ mipp::sign(r_lambda_b));
+}
+
+template <typename R>
+inline mipp::Reg<R> v_LLR_r(const mipp::Reg<R>& r_a, const mipp::Reg<R>& r_b)
+{
+	return r_a + r_b;
+}
+
+template <>
+inline mipp::Reg<int16_t> v_LLR_r(const mipp::Reg<int16_t>& r_a, const mipp::Reg<int16_t>& r_b)
+{
+	// the 16-bit additions saturate in hardware and 'sat_val' is half of the range: clipping the sum is exact
+	return mipp::min(mipp::max(r_a + r_b, mipp::Reg<int16_t>(sat_vals<int16_t>().first)),
+	                                      mipp::Reg<int16_t>(sat_vals<int16_t>().second));
+}
+
+template <>
+inline mipp::Reg<int8_t> v_LLR_r(const mipp::Reg<int8_t>& r_a, const mipp::Reg<int8_t>& r_b)
+{
+	// the 8-bit additions saturate in hardware and 'sat_val' is half of the range: clipping the sum is exact
+	return mipp::min(mipp::max(r_a + r_b, mipp::Reg<int8_t>(sat_vals<int8_t>().first)),
+	                                      mipp::Reg<int8_t>(sat_vals<int8_t>().second));
+}
+
+template <typename R>
+inline void fv_LLR(const R *l_a, const R *l_b, const R *l_d, R *l_c, const int n_elmts)
+{
+	const auto vec_loop_size = (n_elmts / mipp::nElReg<R>()) * mipp::nElReg<R>();
+	for (auto i = 0; i < vec_loop_size; i += mipp::nElReg<R>())
+	{
+		mipp::Reg<R> r_a, r_b, r_d;
+		r_a.loadu(l_a +i);
+		r_b.loadu(l_b +i);
+		r_d.loadu(l_d +i);
+		f_LLR_r(r_a, v_LLR_r(r_b, r_d)).storeu(l_c +i);
+	}
+	for (auto i = vec_loop_size; i < n_elmts; i++)
+		l_c[i] = f_LLR(l_a[i], v_LLR(l_b[i], l_d[i]));
+}
+
+template <typename R>
+inline void vf_LLR(const R *l_a, const R *l_b, const R *l_d, R *l_c, const int n_elmts)
+{
+	const auto vec_loop_size = (n_elmts / mipp::nElReg<R>()) * mipp::nElReg<R>();
+	for (auto i = 0; i < vec_loop_size; i += mipp::nElReg<R>())
+	{
+		mipp::Reg<R> r_a, r_b, r_d;
+		r_a.loadu(l_a +i);
+		r_b.loadu(l_b +i);
+		r_d.loadu(l_d +i);
+		v_LLR_r(r_a, f_LLR_r(r_b, r_d)).storeu(l_c +i);
+	}
+	for (auto i = vec_loop_size; i < n_elmts; i++)
+		l_c[i] = v_LLR(l_a[i], f_LLR(l_b[i], l_d[i]));
+}
+
 template <typename B>
 inline B xo_STD(const B& r_u_a, const B& r_u_b)
 {
@@ -0,0 +1,56 @@
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/RM/rm_functions.h"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+int tools::rm_dimension(const int r, const int m)
+{
+	auto K = 0, binom = 1;
+	for (auto i = 0; i <= r && i <= m; i++)
+	{
+		K += binom;
+		binom = binom * (m - i) / (i +1);
+	}
+	return K;
+}
+
+int tools::rm_order(const int K, const int N)
+{
+	if (N <= 0 || (N & (N -1)))
+	{
+		std::stringstream message;
+		message << "'N' has to be a positive power of 2 ('N' = " << N << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto m = 0;
+	while ((1 << m) < N) m++;
+
+	for (auto r = 0; r <= m; r++)
+		if (rm_dimension(r, m) == K)
+			return r;
+
+	std::stringstream message;
+	message << "'K' does not match any Reed-Muller code of length 'N' ('K' = " << K << ", 'N' = " << N
+	        << ", valid 'K' values = {";
+	for (auto r = 0; r <= m; r++)
+		message << rm_dimension(r, m) << (r < m ? ", " : "");
+	message << "}).";
+	throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+}
+
+std::vector<bool> tools::rm_frozen_bits(const int r, const int m)
+{
+	std::vector<bool> frozen_bits(1 << m);
+	for (auto i = 0; i < (1 << m); i++)
+	{
+		auto w = 0;
+		for (auto j = i; j; j >>= 1)
+			w += j & 1;
+		frozen_bits[i] = w < m - r;
+	}
+	return frozen_bits;
+}
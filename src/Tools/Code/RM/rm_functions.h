@@ -0,0 +1,29 @@
+#ifndef RM_FUNCTIONS_H_
+#define RM_FUNCTIONS_H_
+
+#include <vector>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Return the number of information bits of the RM(r,m) Reed-Muller code: sum_{i=0}^{r} (m choose i).
+ */
+int rm_dimension(const int r, const int m);
+
+/*
+ * Return the order 'r' of the RM(r,m) Reed-Muller code with 'K' information bits and 'N' = 2^m bits in a codeword.
+ * Throw an 'invalid_argument' exception when there is no such code.
+ */
+int rm_order(const int K, const int N);
+
+/*
+ * Return the frozen bits of the RM(r,m) Reed-Muller code in the polar (Arikan kernel) basis: the row 'i' of the
+ * generator matrix is selected when the Hamming weight of 'i' is at least m - r (true means frozen).
+ */
+std::vector<bool> rm_frozen_bits(const int r, const int m);
+}
+}
+
+#endif /* RM_FUNCTIONS_H_ */
@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Dataflow/Bounded_channel.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Bounded_channel
+::Bounded_channel(const std::vector<size_t> &bytes, const size_t capacity, const std::string &name)
+: Node(bytes.size(), bytes.size(), name),
+  bytes(bytes),
+  capacity(capacity),
+  slots(capacity),
+  fed(bytes.size(), false),
+  n_fed(0),
+  head(0),
+  tail(0),
+  closed(false),
+  discard(false)
+{
+	if (bytes.empty())
+	{
+		std::stringstream message;
+		message << "'bytes.size()' has to be greater than 0 ('name' = " << name << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (capacity == 0)
+	{
+		std::stringstream message;
+		message << "'capacity' has to be greater than 0 ('name' = " << name << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto &s : this->slots)
+		for (auto b : bytes)
+			s.push_back(mipp::vector<uint8_t>(b));
+}
+
+size_t Bounded_channel
+::get_capacity() const
+{
+	return this->capacity;
+}
+
+void Bounded_channel
+::transport(const size_t id, void* dataptr)
+{
+	if (this->fed[id])
+	{
+		std::stringstream message;
+		message << "The port has already been fed for the current frame ('id' = " << id << ", 'name' = "
+		        << this->name << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->n_fed == 0)
+	{
+		// wait for a free slot, only the producer moves 'head' so it can be read without the lock after
+		std::unique_lock<std::mutex> lock(this->mtx);
+		this->cv_not_full.wait(lock, [this]() { return this->closed || this->head - this->tail < this->capacity; });
+		if (this->closed)
+			return;
+	}
+
+	auto &slot = this->slots[this->head % this->capacity];
+	std::copy((uint8_t*)dataptr, (uint8_t*)dataptr + this->bytes[id], slot[id].begin());
+	this->fed[id] = true;
+
+	if (++this->n_fed == this->bytes.size())
+	{
+		std::fill(this->fed.begin(), this->fed.end(), false);
+		this->n_fed = 0;
+
+		{
+			std::lock_guard<std::mutex> lock(this->mtx);
+			this->head++;
+		}
+		this->cv_not_empty.notify_one();
+	}
+}
+
+bool Bounded_channel
+::pull()
+{
+	{
+		std::unique_lock<std::mutex> lock(this->mtx);
+		this->cv_not_empty.wait(lock, [this]() { return this->closed || this->head != this->tail; });
+		if (this->discard || this->head == this->tail)
+			return false;
+	}
+
+	// the slot is released after the forward: the downstream tasks read it during the forward
+	auto &slot = this->slots[this->tail % this->capacity];
+	for (size_t p = 0; p < slot.size(); p++)
+		this->forward(p, (void*)slot[p].data());
+
+	{
+		std::lock_guard<std::mutex> lock(this->mtx);
+		this->tail++;
+	}
+	this->cv_not_full.notify_one();
+
+	return true;
+}
+
+void Bounded_channel
+::close(const bool discard)
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mtx);
+		this->closed  = true;
+		this->discard = this->discard || discard;
+	}
+	this->cv_not_full .notify_all();
+	this->cv_not_empty.notify_all();
+}
+
+void Bounded_channel
+::open()
+{
+	std::lock_guard<std::mutex> lock(this->mtx);
+	std::fill(this->fed.begin(), this->fed.end(), false);
+	this->n_fed   = 0;
+	this->head    = 0;
+	this->tail    = 0;
+	this->closed  = false;
+	this->discard = false;
+}
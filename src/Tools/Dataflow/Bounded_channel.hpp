@@ -0,0 +1,89 @@
+/*!
+ * \file
+ * \brief A bounded channel which decouples two parts of a dataflow graph executed by two different threads.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef BOUNDED_CHANNEL_HPP_
+#define BOUNDED_CHANNEL_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <mipp.h>
+
+#include "Tools/Dataflow/Node.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Bounded_channel
+ *
+ * \brief A bounded channel which decouples two parts of a dataflow graph executed by two different threads.
+ *
+ * All the edges which cross the cut between the producer and the consumer parts have to go through the same channel
+ * (one port per edge). A frame is pushed when all the input ports have been fed: the data are copied in a slot of the
+ * channel and the producer can continue with the next frame. The consumer thread pulls the slots and forwards the
+ * ports in order (port 0 first). The producer blocks when all the slots are used.
+ *
+ * There is one producer thread and one consumer thread per channel.
+ */
+class Bounded_channel : public Node
+{
+protected:
+	const std::vector<size_t> bytes;    // the number of bytes of each port
+	const size_t              capacity; // the number of slots
+
+	std::vector<std::vector<mipp::vector<uint8_t>>> slots;
+	std::vector<bool>                               fed;
+	size_t                                          n_fed;
+	size_t                                          head;
+	size_t                                          tail;
+	bool                                            closed;
+	bool                                            discard;
+
+	std::mutex              mtx;
+	std::condition_variable cv_not_full;
+	std::condition_variable cv_not_empty;
+
+public:
+	explicit Bounded_channel(const std::vector<size_t> &bytes, const size_t capacity = 16,
+	                         const std::string &name = "Bounded_channel");
+	virtual ~Bounded_channel() = default;
+
+	size_t get_capacity() const;
+
+	/*!
+	 * \brief Copies the frame in the current slot, the slot is pushed when all the ports have been fed.
+	 */
+	void transport(const size_t id, void* dataptr);
+
+	/*!
+	 * \brief Pulls a slot and forwards its ports (consumer side).
+	 *
+	 * \return false when the channel is closed and there is nothing more to forward.
+	 */
+	bool pull();
+
+	/*!
+	 * \brief Closes the channel and wakes up the producer and the consumer.
+	 *
+	 * \param discard: if true, the slots not yet forwarded are dropped.
+	 */
+	void close(const bool discard = false);
+
+	/*!
+	 * \brief Empties and re-opens the channel.
+	 */
+	void open();
+};
+}
+}
+
+#endif /* BOUNDED_CHANNEL_HPP_ */
@@ -0,0 +1,109 @@
+#include <exception>
+#include <sstream>
+#include <atomic>
+#include <thread>
+#include <mutex>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Dataflow/Dataflow.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Dataflow
+::Dataflow(const std::vector<Task_node*> &sources, const std::vector<Bounded_channel*> &channels)
+: sources(sources), channels(channels)
+{
+	if (sources.empty())
+	{
+		std::stringstream message;
+		message << "'sources.size()' has to be greater than 0.";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto s : sources)
+		if (s == nullptr)
+			throw invalid_argument(__FILE__, __LINE__, __func__, "'sources' can't contain null pointers.");
+
+	for (auto c : channels)
+		if (c == nullptr)
+			throw invalid_argument(__FILE__, __LINE__, __func__, "'channels' can't contain null pointers.");
+}
+
+size_t Dataflow
+::get_n_threads() const
+{
+	return this->sources.size() + this->channels.size();
+}
+
+void Dataflow
+::exec(std::function<bool()> stop_condition)
+{
+	std::atomic<bool> stop(false);
+	std::exception_ptr first_exception;
+	std::mutex mtx;
+
+	auto on_error = [&]()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			if (first_exception == nullptr)
+				first_exception = std::current_exception();
+		}
+		stop = true;
+		for (auto c : this->channels)
+			c->close(true);
+	};
+
+	auto source_loop = [&](const size_t s)
+	{
+		try
+		{
+			while (!stop && !stop_condition())
+				this->sources[s]->fire();
+		}
+		catch (...)
+		{
+			on_error();
+		}
+	};
+
+	auto channel_loop = [&](const size_t c)
+	{
+		try
+		{
+			while (this->channels[c]->pull());
+		}
+		catch (...)
+		{
+			on_error();
+		}
+	};
+
+	for (auto c : this->channels)
+		c->open();
+
+	std::vector<std::thread> consumers;
+	for (size_t c = 0; c < this->channels.size(); c++)
+		consumers.push_back(std::thread(channel_loop, c));
+
+	std::vector<std::thread> producers;
+	for (size_t s = 1; s < this->sources.size(); s++)
+		producers.push_back(std::thread(source_loop, s));
+
+	source_loop(0);
+
+	for (auto &t : producers)
+		t.join();
+
+	// the sources are stopped: the frames still in the channels are forwarded before the consumers exit (a channel is
+	// closed when the channels before it are emptied)
+	for (size_t c = 0; c < this->channels.size(); c++)
+	{
+		this->channels[c]->close();
+		consumers[c].join();
+	}
+
+	if (first_exception != nullptr)
+		std::rethrow_exception(first_exception);
+}
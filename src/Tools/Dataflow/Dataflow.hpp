@@ -0,0 +1,63 @@
+/*!
+ * \file
+ * \brief Execute dataflow graphs (made of tasks, duplicators, routers, funnels, predicates and channels) with threads.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef DATAFLOW_HPP_
+#define DATAFLOW_HPP_
+
+#include <functional>
+#include <cstddef>
+#include <vector>
+
+#include "Tools/Dataflow/Task_node.hpp"
+#include "Tools/Dataflow/Bounded_channel.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Dataflow
+ *
+ * \brief Execute dataflow graphs with threads (native replacement of the SystemC simulation kernel).
+ *
+ * Each source (a task without input socket) is fired in a loop by its own thread, the frames are transported through
+ * the graph by the source thread until a channel is met. Each channel is emptied by its own thread which transports
+ * the frames through the rest of the graph. Independent graphs (one per simulation thread) can be executed together.
+ */
+class Dataflow
+{
+protected:
+	std::vector<Task_node*      > sources;
+	std::vector<Bounded_channel*> channels;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param sources:  the source nodes (one thread per source).
+	 * \param channels: the channels of the graphs (one thread per channel), in the order of the graphs.
+	 */
+	explicit Dataflow(const std::vector<Task_node*> &sources, const std::vector<Bounded_channel*> &channels = {});
+
+	virtual ~Dataflow() = default;
+
+	size_t get_n_threads() const;
+
+	/*!
+	 * \brief Fires the sources until the stop condition is true, then waits until the channels are emptied.
+	 *
+	 * If a node raises an exception, all the threads are stopped (the frames in the channels are dropped) and the
+	 * first exception is re-thrown.
+	 *
+	 * \param stop_condition: called by each source thread before each firing of its source.
+	 */
+	void exec(std::function<bool()> stop_condition);
+};
+}
+}
+
+#endif /* DATAFLOW_HPP_ */
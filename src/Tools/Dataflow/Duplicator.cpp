@@ -0,0 +1,17 @@
+#include "Tools/Dataflow/Duplicator.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Duplicator
+::Duplicator(const std::string &name, const size_t n_outputs)
+: Node(1, n_outputs, name)
+{
+}
+
+void Duplicator
+::transport(const size_t id, void* dataptr)
+{
+	for (size_t o = 0; o < this->outputs.size(); o++)
+		this->forward(o, dataptr);
+}
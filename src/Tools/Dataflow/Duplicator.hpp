@@ -0,0 +1,36 @@
+/*!
+ * \file
+ * \brief Forwards each frame received on its input port to all its output ports.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef DUPLICATOR_HPP_
+#define DUPLICATOR_HPP_
+
+#include <cstddef>
+#include <string>
+
+#include "Tools/Dataflow/Node.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Duplicator
+ *
+ * \brief Forwards each frame received on its input port to all its output ports (in the order of the ports).
+ */
+class Duplicator : public Node
+{
+public:
+	explicit Duplicator(const std::string &name = "Duplicator", const size_t n_outputs = 2);
+	virtual ~Duplicator() = default;
+
+	void transport(const size_t id, void* dataptr);
+};
+}
+}
+
+#endif /* DUPLICATOR_HPP_ */
@@ -0,0 +1,16 @@
+#include "Tools/Dataflow/Funnel.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Funnel
+::Funnel(const std::string &name, const size_t n_inputs)
+: Node(n_inputs, 1, name)
+{
+}
+
+void Funnel
+::transport(const size_t id, void* dataptr)
+{
+	this->forward(0, dataptr);
+}
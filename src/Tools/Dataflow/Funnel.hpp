@@ -0,0 +1,36 @@
+/*!
+ * \file
+ * \brief Forwards the frames received on any of its input ports to its output port.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef FUNNEL_HPP_
+#define FUNNEL_HPP_
+
+#include <cstddef>
+#include <string>
+
+#include "Tools/Dataflow/Node.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Funnel
+ *
+ * \brief Forwards the frames received on any of its input ports to its output port (used to close a loop).
+ */
+class Funnel : public Node
+{
+public:
+	explicit Funnel(const std::string &name = "Funnel", const size_t n_inputs = 2);
+	virtual ~Funnel() = default;
+
+	void transport(const size_t id, void* dataptr);
+};
+}
+}
+
+#endif /* FUNNEL_HPP_ */
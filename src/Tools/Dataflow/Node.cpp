@@ -0,0 +1,71 @@
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Dataflow/Node.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Node::Port_out
+::Port_out(Node &node, const size_t id)
+: node(node), id(id)
+{
+}
+
+void Node::Port_out
+::operator()(const Port_in &in)
+{
+	this->node.outputs[this->id].push_back(in);
+}
+
+Node
+::Node(const size_t n_inputs, const size_t n_outputs, const std::string &name)
+: name(name), n_inputs(n_inputs), outputs(n_outputs)
+{
+}
+
+const std::string& Node
+::get_name() const
+{
+	return this->name;
+}
+
+size_t Node
+::get_n_inputs() const
+{
+	return this->n_inputs;
+}
+
+size_t Node
+::get_n_outputs() const
+{
+	return this->outputs.size();
+}
+
+Port_in Node
+::in(const size_t id)
+{
+	if (id >= this->n_inputs)
+	{
+		std::stringstream message;
+		message << "'id' has to be smaller than 'n_inputs' ('id' = " << id << ", 'n_inputs' = " << this->n_inputs
+		        << ", 'name' = " << this->name << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return Port_in{*this, id};
+}
+
+Node::Port_out Node
+::out(const size_t id)
+{
+	if (id >= this->outputs.size())
+	{
+		std::stringstream message;
+		message << "'id' has to be smaller than 'outputs.size()' ('id' = " << id << ", 'outputs.size()' = "
+		        << this->outputs.size() << ", 'name' = " << this->name << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return Port_out(*this, id);
+}
@@ -0,0 +1,86 @@
+/*!
+ * \file
+ * \brief A node of a dataflow graph: receives frames on its input ports and forwards frames on its output ports.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef NODE_HPP_
+#define NODE_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace aff3ct
+{
+namespace tools
+{
+class Node;
+
+struct Port_in
+{
+	Node  &node;
+	size_t id;
+};
+
+/*!
+ * \class Node
+ *
+ * \brief A node of a dataflow graph: receives frames on its input ports and forwards frames on its output ports.
+ *
+ * A frame is only transported by pointer (the data are not copied): the 'transport' call on an input port returns
+ * when the frame has been processed by the downstream nodes (like a blocking transport in SystemC/TLM).
+ */
+class Node
+{
+public:
+	class Port_out
+	{
+	private:
+		Node        &node;
+		const size_t id;
+
+	public:
+		Port_out(Node &node, const size_t id);
+
+		/*!
+		 * \brief Binds this output port to an input port (an output port can be bound to many input ports).
+		 */
+		void operator()(const Port_in &in);
+	};
+
+protected:
+	const std::string name;
+	const size_t      n_inputs;
+
+	std::vector<std::vector<Port_in>> outputs; // for each output port, the bound input ports
+
+public:
+	Node(const size_t n_inputs, const size_t n_outputs, const std::string &name);
+	virtual ~Node() = default;
+
+	const std::string& get_name     () const;
+	size_t             get_n_inputs () const;
+	size_t             get_n_outputs() const;
+
+	virtual Port_in  in (const size_t id = 0);
+	virtual Port_out out(const size_t id = 0);
+
+	/*!
+	 * \brief Transports a frame to an input port of the node.
+	 *
+	 * \param id:      the input port id.
+	 * \param dataptr: the pointer to the frame.
+	 */
+	virtual void transport(const size_t id, void* dataptr) = 0;
+
+protected:
+	inline void forward(const size_t id, void* dataptr);
+};
+}
+}
+
+#include "Tools/Dataflow/Node.hxx"
+
+#endif /* NODE_HPP_ */
@@ -0,0 +1,14 @@
+#include "Tools/Dataflow/Node.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+void Node
+::forward(const size_t id, void* dataptr)
+{
+	for (auto &in : this->outputs[id])
+		in.node.transport(in.id, dataptr);
+}
+}
+}
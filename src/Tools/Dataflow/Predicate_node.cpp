@@ -0,0 +1,16 @@
+#include "Tools/Dataflow/Predicate_node.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Predicate_node
+::Predicate_node(Predicate &p, const std::string &name)
+: Node(1, 0, name), p(p)
+{
+}
+
+void Predicate_node
+::transport(const size_t id, void* dataptr)
+{
+	this->p.reset();
+}
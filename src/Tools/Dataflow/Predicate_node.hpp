@@ -0,0 +1,40 @@
+/*!
+ * \file
+ * \brief Resets a predicate when a frame is received (end of a loop).
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef PREDICATE_NODE_HPP_
+#define PREDICATE_NODE_HPP_
+
+#include <cstddef>
+#include <string>
+
+#include "Tools/Algo/Predicate.hpp"
+#include "Tools/Dataflow/Node.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Predicate_node
+ *
+ * \brief Resets a predicate when a frame is received (end of a loop), the frame is not forwarded.
+ */
+class Predicate_node : public Node
+{
+private:
+	Predicate &p;
+
+public:
+	explicit Predicate_node(Predicate &p, const std::string &name = "Predicate");
+	virtual ~Predicate_node() = default;
+
+	void transport(const size_t id, void* dataptr);
+};
+}
+}
+
+#endif /* PREDICATE_NODE_HPP_ */
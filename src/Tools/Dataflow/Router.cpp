@@ -0,0 +1,16 @@
+#include "Tools/Dataflow/Router.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Router
+::Router(Predicate &p, const std::string &name)
+: Node(1, 2, name), p(p)
+{
+}
+
+void Router
+::transport(const size_t id, void* dataptr)
+{
+	this->forward(this->p() ? 1 : 0, dataptr);
+}
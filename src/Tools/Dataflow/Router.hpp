@@ -0,0 +1,43 @@
+/*!
+ * \file
+ * \brief Forwards the frames to one of its two output ports depending on a predicate.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef ROUTER_HPP_
+#define ROUTER_HPP_
+
+#include <cstddef>
+#include <string>
+
+#include "Tools/Algo/Predicate.hpp"
+#include "Tools/Dataflow/Node.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Router
+ *
+ * \brief Forwards the frames to one of its two output ports depending on a predicate.
+ *
+ * The predicate is evaluated for each frame: the frame is forwarded to the output port 0 if it is false and to the
+ * output port 1 if it is true.
+ */
+class Router : public Node
+{
+private:
+	Predicate &p;
+
+public:
+	explicit Router(Predicate &p, const std::string &name = "Router");
+	virtual ~Router() = default;
+
+	void transport(const size_t id, void* dataptr);
+};
+}
+}
+
+#endif /* ROUTER_HPP_ */
@@ -0,0 +1,121 @@
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+#include "Module/Module.hpp"
+#include "Tools/Dataflow/Task_node.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Task_node
+::Task_node(module::Task &task)
+: Node(task.sockets.size(), task.sockets.size(), task.get_module().get_name() + "::" + task.get_name()),
+  task(task),
+  last_in(0),
+  has_inputs(false)
+{
+	task.set_autoexec (false);
+	task.set_autoalloc(true );
+
+	for (size_t s = 0; s < task.sockets.size(); s++)
+		if (task.get_socket_type(*task.sockets[s]) != module::socket_t::SOUT)
+		{
+			this->last_in    = s;
+			this->has_inputs = true;
+		}
+}
+
+module::Task& Task_node
+::get_task() const
+{
+	return this->task;
+}
+
+Port_in Task_node
+::in(const size_t id)
+{
+	auto p = Node::in(id);
+
+	if (this->task.get_socket_type(*this->task.sockets[id]) == module::socket_t::SOUT)
+	{
+		std::stringstream message;
+		message << "The socket is not an input socket ('socket.name' = " << this->task.sockets[id]->get_name()
+		        << ", 'name' = " << this->name << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return p;
+}
+
+Node::Port_out Task_node
+::out(const size_t id)
+{
+	auto p = Node::out(id);
+
+	if (this->task.get_socket_type(*this->task.sockets[id]) == module::socket_t::SIN)
+	{
+		std::stringstream message;
+		message << "The socket is not an output socket ('socket.name' = " << this->task.sockets[id]->get_name()
+		        << ", 'name' = " << this->name << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return p;
+}
+
+Port_in Task_node
+::in(const module::Socket &s)
+{
+	return this->in(this->get_socket_id(s));
+}
+
+Node::Port_out Task_node
+::out(const module::Socket &s)
+{
+	return this->out(this->get_socket_id(s));
+}
+
+size_t Task_node
+::get_socket_id(const module::Socket &s) const
+{
+	for (size_t id = 0; id < this->task.sockets.size(); id++)
+		if (this->task.sockets[id].get() == &s)
+			return id;
+
+	std::stringstream message;
+	message << "The socket does not belong to the task ('socket.name' = " << s.get_name() << ", 'name' = "
+	        << this->name << ").";
+	throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+}
+
+void Task_node
+::transport(const size_t id, void* dataptr)
+{
+	this->task.sockets[id]->bind(dataptr);
+
+	if (id == this->last_in)
+		this->exec_and_forward();
+}
+
+void Task_node
+::fire()
+{
+	if (this->has_inputs)
+	{
+		std::stringstream message;
+		message << "Only a task without input socket can be fired ('name' = " << this->name << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->exec_and_forward();
+}
+
+void Task_node
+::exec_and_forward()
+{
+	this->task.exec();
+
+	for (size_t s = 0; s < this->outputs.size(); s++)
+		if (!this->outputs[s].empty())
+			this->forward(s, this->task.sockets[s]->get_dataptr());
+}
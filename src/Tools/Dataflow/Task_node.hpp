@@ -0,0 +1,65 @@
+/*!
+ * \file
+ * \brief A node of a dataflow graph which executes a task.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef TASK_NODE_HPP_
+#define TASK_NODE_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "Module/Task.hpp"
+#include "Module/Socket.hpp"
+#include "Tools/Dataflow/Node.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Task_node
+ *
+ * \brief A node of a dataflow graph which executes a task (native replacement of the 'SC_Module').
+ *
+ * The ports ids are the ids of the sockets of the task. A frame received on an input socket is bound to it, the task
+ * is executed when the frame of its last input socket is received. Then the output sockets are forwarded in the order
+ * of their declaration. A task without input socket (a source) is executed by calling 'fire'.
+ */
+class Task_node : public Node
+{
+protected:
+	module::Task &task;
+	size_t        last_in;
+	bool          has_inputs;
+
+public:
+	explicit Task_node(module::Task &task);
+	virtual ~Task_node() = default;
+
+	module::Task& get_task() const;
+
+	Port_in  in (const size_t id);
+	Port_out out(const size_t id);
+
+	Port_in  in (const module::Socket &s);
+	Port_out out(const module::Socket &s);
+
+	void transport(const size_t id, void* dataptr);
+
+	/*!
+	 * \brief Executes the task and forwards its outputs (only for the tasks without input socket).
+	 */
+	void fire();
+
+protected:
+	void exec_and_forward();
+
+	size_t get_socket_id(const module::Socket &s) const;
+};
+}
+}
+
+#endif /* TASK_NODE_HPP_ */
@@ -2,6 +2,8 @@
 #include <iostream>
 #include <cstdint>
 #include <sstream>
+#include <iomanip>
+#include <ios>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/Dumper/Dumper.hpp"
@@ -12,9 +14,243 @@ using namespace aff3ct::tools;
 const std::string aff3ct::tools::Dumper::default_ext = "dump";
 
 Dumper
-::Dumper()
-: add_threshold(0)
+::Dumper(const unsigned max_captures, const unsigned sampling, const size_t queue_size)
+: add_threshold(0),
+  max_captures(max_captures),
+  sampling(sampling),
+  n_candidates(0),
+  n_captures(0),
+  queue_size(queue_size),
+  slots(queue_size),
+  slots_frame_id(queue_size, 0),
+  q_head(0),
+  q_tail(0),
+  n_dropped(0),
+  sink(this),
+  sources(1, this),
+  writer_stop(false)
 {
+	if (sampling == 0)
+	{
+		std::stringstream message;
+		message << "'sampling' has to be greater than 0 ('sampling' = " << sampling << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+Dumper
+::~Dumper()
+{
+	this->close_stream();
+}
+
+void Dumper
+::resize_slots()
+{
+	this->flush();
+
+	this->slot_offsets.resize(this->registered_data_ptr.size());
+	size_t slot_bytes = 0;
+	for (auto i = 0; i < (int)this->registered_data_ptr.size(); i++)
+	{
+		this->slot_offsets[i] = slot_bytes;
+		slot_bytes += this->registered_data_size[i] * this->registered_data_sizeof[i];
+	}
+
+	for (auto &s : this->slots)
+		s.resize(slot_bytes);
+}
+
+// the number of frames is completed when the stream is closed, it is written on a fixed width in the text files
+static const int stream_n_data_width = 10;
+
+bool Dumper
+::is_streaming() const
+{
+	return !this->stream_path.empty();
+}
+
+void Dumper
+::open(const std::string& base_path)
+{
+	if (base_path.empty())
+		throw invalid_argument(__FILE__, __LINE__, __func__, "'base_path' can't be empty.");
+
+	for (auto s : this->sources)
+		if (s->queue_size == 0)
+			throw runtime_error(__FILE__, __LINE__, __func__, "The frames can only be streamed with a capture queue.");
+
+	this->close_stream();
+
+	const auto &ref = *this->sources[0];
+	this->files    .clear();
+	this->n_written.assign(ref.registered_data_ptr.size(), 0);
+	for (auto i = 0; i < (int)ref.registered_data_ptr.size(); i++)
+	{
+		const std::string path = base_path + "." + ref.registered_data_ext[i];
+		if (ref.registered_data_bin[i])
+		{
+			this->files.push_back(std::ofstream(path, std::ofstream::out | std::ios_base::binary));
+			this->write_header_binary(this->files[i], 0, ref.registered_data_size[i], ref.registered_data_head[i]);
+		}
+		else
+		{
+			this->files.push_back(std::ofstream(path, std::ofstream::out));
+			this->write_header_text(this->files[i], 0, ref.registered_data_size[i], ref.registered_data_head[i],
+			                        stream_n_data_width);
+		}
+
+		if (!this->files[i].is_open())
+		{
+			std::stringstream message;
+			message << "Impossible to open the file ('path' = " << path << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	this->stream_path = base_path;
+	this->writer_stop = false;
+	this->writer      = std::thread(&Dumper::writer_loop, this);
+}
+
+void Dumper
+::close_stream()
+{
+	if (this->writer.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> lock(this->mutex_writer);
+			this->writer_stop = true;
+		}
+		this->cond_writer.notify_one();
+		this->writer.join();
+	}
+
+	// the number of frames is known now, it is written in the headers
+	for (auto i = 0; i < (int)this->files.size(); i++)
+	{
+		if (this->sources[0]->registered_data_bin[i])
+		{
+			this->files[i].seekp(0);
+			this->files[i].write((char*)&this->n_written[i], sizeof(this->n_written[i]));
+		}
+		else
+		{
+			this->files[i].seekp(0);
+			this->files[i] << std::setw(stream_n_data_width) << this->n_written[i];
+		}
+		this->files[i].close();
+	}
+
+	this->files.clear();
+	this->stream_path.clear();
+}
+
+void Dumper
+::wake_writer()
+{
+	// the lock prevents the notification from being lost between the check and the wait of the writer
+	{
+		std::lock_guard<std::mutex> lock(this->mutex_writer);
+	}
+	this->cond_writer.notify_one();
+}
+
+bool Dumper
+::is_pending() const
+{
+	for (auto s : this->sources)
+		if (s->q_tail.load(std::memory_order_relaxed) != s->q_head.load(std::memory_order_acquire))
+			return true;
+	return false;
+}
+
+void Dumper
+::drain(Dumper &source)
+{
+	auto tail = source.q_tail.load(std::memory_order_relaxed);
+	while (tail != source.q_head.load(std::memory_order_acquire))
+	{
+		const auto s        = tail % source.queue_size;
+		const auto frame_id = source.slots_frame_id[s];
+
+		for (auto i = 0; i < (int)source.registered_data_ptr.size(); i++)
+		{
+			// the overall limit of frames is applied here when the sink is a reduction
+			if ((unsigned)frame_id >= source.registered_data_n_frames[i] ||
+			    (this->max_captures && this->n_written[i] >= this->max_captures))
+				continue;
+
+			const auto data = source.slots[s].data() + source.slot_offsets[i];
+			if (source.registered_data_bin[i])
+				this->files[i].write(data, source.registered_data_size[i] * source.registered_data_sizeof[i]);
+			else
+				this->write_record_text(this->files[i], data, source.registered_data_size[i],
+				                        source.registered_data_type[i]);
+			this->n_written[i]++;
+		}
+
+		source.q_tail.store(++tail, std::memory_order_release);
+	}
+}
+
+void Dumper
+::writer_loop()
+{
+	std::unique_lock<std::mutex> lock(this->mutex_writer);
+	while (true)
+	{
+		this->cond_writer.wait(lock, [this]() { return this->writer_stop || this->is_pending(); });
+
+		if (!this->is_pending()) // writer_stop
+			break;
+
+		// the frames are written without holding the lock
+		lock.unlock();
+		for (auto s : this->sources)
+			this->drain(*s);
+		lock.lock();
+
+		this->cond_flushed.notify_all();
+	}
+	this->cond_flushed.notify_all();
+}
+
+void Dumper
+::flush()
+{
+	if (this->sink != this)
+	{
+		this->sink->flush();
+		return;
+	}
+
+	if (this->writer.joinable())
+	{
+		std::unique_lock<std::mutex> lock(this->mutex_writer);
+		this->cond_flushed.wait(lock, [this]() { return !this->is_pending(); });
+	}
+}
+
+unsigned Dumper
+::get_n_dropped() const
+{
+	return this->n_dropped;
+}
+
+void Dumper
+::copy_frame(const int frame_id)
+{
+	for (auto i = 0; i < (int)this->registered_data_ptr.size(); i++)
+	{
+		if ((unsigned)frame_id < this->registered_data_n_frames[i])
+		{
+			const auto bytes = this->registered_data_size[i] * this->registered_data_sizeof[i];
+			const auto ptr   = this->registered_data_ptr[i] + bytes * frame_id;
+
+			this->buffer[i].push_back(std::vector<char>(ptr, ptr + bytes));
+		}
+	}
 }
 
 template <typename T>
@@ -54,6 +290,8 @@ void Dumper
 	this->registered_data_n_frames.push_back(n_frames   );
 
 	this->add_threshold = add_threshold;
+
+	this->resize_slots();
 }
 
 template <typename T, class A>
@@ -86,6 +324,32 @@ void Dumper
 	if (n_err < this->add_threshold)
 		return;
 
+	if (this->max_captures && this->n_captures >= this->max_captures)
+		return;
+
+	if ((this->n_candidates++ % this->sampling) != 0)
+		return;
+
+	if (this->queue_size == 0)
+	{
+		this->copy_frame(frame_id);
+		this->n_captures++;
+		return;
+	}
+
+	if (!this->sink->is_streaming())
+		throw runtime_error(__FILE__, __LINE__, __func__, "The capture queue requires the 'open' method to be called "
+		                                                  "before.");
+
+	const auto head = this->q_head.load(std::memory_order_relaxed);
+	if (head - this->q_tail.load(std::memory_order_acquire) >= this->queue_size)
+	{
+		this->n_dropped++;
+		return;
+	}
+
+	// only copy the frame in the ring here, the buffers are filled by the writer thread
+	const auto s = head % this->queue_size;
 	for (auto i = 0; i < (int)this->registered_data_ptr.size(); i++)
 	{
 		if ((unsigned)frame_id < this->registered_data_n_frames[i])
@@ -93,13 +357,16 @@ void Dumper
 			const auto ptr   = this->registered_data_ptr [i];
 			const auto bytes = this->registered_data_size[i] * this->registered_data_sizeof[i];
 
-			this->buffer[i].push_back(std::vector<char>(bytes));
-
 			std::copy(ptr + bytes * (frame_id +0),
 			          ptr + bytes * (frame_id +1),
-			          this->buffer[i][this->buffer[i].size() -1].begin());
+			          this->slots[s].begin() + this->slot_offsets[i]);
 		}
 	}
+	this->slots_frame_id[s] = frame_id;
+	this->q_head.store(head +1, std::memory_order_release);
+	this->n_captures++;
+
+	this->sink->wake_writer();
 }
 
 void Dumper
@@ -108,6 +375,21 @@ void Dumper
 	if (base_path.empty())
 		throw invalid_argument(__FILE__, __LINE__, __func__, "'base_path' can't be empty.");
 
+	// the frames have already been written by the writer thread
+	if (this->is_streaming())
+	{
+		if (base_path != this->stream_path)
+		{
+			std::stringstream message;
+			message << "'base_path' should be equal to 'stream_path' ('base_path' = " << base_path
+			        << ", 'stream_path' = " << this->stream_path << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->close_stream();
+		return;
+	}
+
 	for (auto i = 0; i < (int)this->registered_data_ptr.size(); i++)
 	{
 		const auto size    = this->registered_data_size  [i];
@@ -142,8 +424,14 @@ void Dumper
 void Dumper
 ::clear()
 {
+	this->flush();
+
 	for (auto &b : this->buffer)
 		b.clear();
+
+	this->n_candidates = 0;
+	this->n_captures   = 0;
+	this->n_dropped    = 0;
 //	this->buffer.clear();
 
 //	this->registered_data_ptr   .clear();
@@ -157,9 +445,9 @@ void Dumper
 
 void Dumper
 ::write_header_text(std::ofstream &file, const unsigned n_data, const unsigned data_size,
-                    const std::vector<unsigned> &headers)
+                    const std::vector<unsigned> &headers, const int n_data_width)
 {
-	file << n_data    << std::endl << std::endl;
+	file << std::setw(n_data_width) << n_data << std::endl << std::endl;
 	file << data_size << std::endl << std::endl;
 	for (auto h : headers)
 		file << h << " ";
@@ -171,31 +459,35 @@ void Dumper
 ::write_body_text(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned size,
                   const std::type_index type)
 {
-	if      (type == typeid( int8_t )) this->_write_body_text< int8_t >(file, buffer, size);
-	else if (type == typeid(uint8_t )) this->_write_body_text<uint8_t >(file, buffer, size);
-	else if (type == typeid( int16_t)) this->_write_body_text< int16_t>(file, buffer, size);
-	else if (type == typeid(uint16_t)) this->_write_body_text<uint16_t>(file, buffer, size);
-	else if (type == typeid( int32_t)) this->_write_body_text< int32_t>(file, buffer, size);
-	else if (type == typeid(uint32_t)) this->_write_body_text<uint32_t>(file, buffer, size);
-	else if (type == typeid( int64_t)) this->_write_body_text< int64_t>(file, buffer, size);
-	else if (type == typeid(uint64_t)) this->_write_body_text<uint64_t>(file, buffer, size);
-	else if (type == typeid(float   )) this->_write_body_text<float   >(file, buffer, size);
-	else if (type == typeid(double  )) this->_write_body_text<double  >(file, buffer, size);
+	for (auto &b : buffer)
+		this->write_record_text(file, b.data(), size, type);
+}
+
+void Dumper
+::write_record_text(std::ofstream &file, const char *data, const unsigned size, const std::type_index type)
+{
+	if      (type == typeid( int8_t )) this->_write_record_text< int8_t >(file, data, size);
+	else if (type == typeid(uint8_t )) this->_write_record_text<uint8_t >(file, data, size);
+	else if (type == typeid( int16_t)) this->_write_record_text< int16_t>(file, data, size);
+	else if (type == typeid(uint16_t)) this->_write_record_text<uint16_t>(file, data, size);
+	else if (type == typeid( int32_t)) this->_write_record_text< int32_t>(file, data, size);
+	else if (type == typeid(uint32_t)) this->_write_record_text<uint32_t>(file, data, size);
+	else if (type == typeid( int64_t)) this->_write_record_text< int64_t>(file, data, size);
+	else if (type == typeid(uint64_t)) this->_write_record_text<uint64_t>(file, data, size);
+	else if (type == typeid(float   )) this->_write_record_text<float   >(file, data, size);
+	else if (type == typeid(double  )) this->_write_record_text<double  >(file, data, size);
 	else
 		throw invalid_argument(__FILE__, __LINE__, __func__, "Unsupported data type.");
 }
 
 template <typename T>
 void Dumper
-::_write_body_text(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned size)
+::_write_record_text(std::ofstream &file, const char *data, const unsigned size)
 {
-	for (auto b : buffer)
-	{
-		const auto data = (T*)b.data();
-		for (unsigned i = 0; i < size; i++)
-			file << +data[i] << " ";
-		file << std::endl << std::endl;
-	}
+	const auto values = (const T*)data;
+	for (unsigned i = 0; i < size; i++)
+		file << +values[i] << " ";
+	file << std::endl << std::endl;
 }
 
 void Dumper
@@ -250,10 +542,10 @@ template void Dumper::register_data<uint64_t, mipp::allocator<uint64_t>>(const s
 template void Dumper::register_data<float,    mipp::allocator<float   >>(const std::vector<float,    mipp::allocator<float   >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
 template void Dumper::register_data<double,   mipp::allocator<double  >>(const std::vector<double,   mipp::allocator<double  >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
 
-template void Dumper::_write_body_text<int8_t >(std::ofstream&, const std::vector<std::vector<char>>&, const unsigned);
-template void Dumper::_write_body_text<int16_t>(std::ofstream&, const std::vector<std::vector<char>>&, const unsigned);
-template void Dumper::_write_body_text<int32_t>(std::ofstream&, const std::vector<std::vector<char>>&, const unsigned);
-template void Dumper::_write_body_text<int64_t>(std::ofstream&, const std::vector<std::vector<char>>&, const unsigned);
-template void Dumper::_write_body_text<float  >(std::ofstream&, const std::vector<std::vector<char>>&, const unsigned);
-template void Dumper::_write_body_text<double >(std::ofstream&, const std::vector<std::vector<char>>&, const unsigned);
+template void Dumper::_write_record_text<int8_t >(std::ofstream&, const char*, const unsigned);
+template void Dumper::_write_record_text<int16_t>(std::ofstream&, const char*, const unsigned);
+template void Dumper::_write_record_text<int32_t>(std::ofstream&, const char*, const unsigned);
+template void Dumper::_write_record_text<int64_t>(std::ofstream&, const char*, const unsigned);
+template void Dumper::_write_record_text<float  >(std::ofstream&, const char*, const unsigned);
+template void Dumper::_write_record_text<double >(std::ofstream&, const char*, const unsigned);
 // ==================================================================================== explicit template instantiation
@@ -6,6 +6,10 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 namespace aff3ct
 {
@@ -31,9 +35,39 @@ protected:
 	std::vector<std::vector<unsigned>> registered_data_head;
 	std::vector<unsigned>              registered_data_n_frames;
 
+	// capture policy (per noise point): keep one eligible frame every 'sampling' ones and stop after 'max_captures'
+	// frames (0 = no limit)
+	const unsigned max_captures;
+	const unsigned sampling;
+	unsigned       n_candidates;
+	unsigned       n_captures;
+
+	// asynchronous capture: 'add' copies the frame in a pre-allocated slot of a bounded single-producer
+	// single-consumer ring (no ring when 'queue_size' = 0) and wakes up the writer thread of the 'sink' (this dumper or
+	// the Dumper_reduction), the writer thread drains the rings of the 'sources' and writes the frames in the 'files'
+	// as they arrive
+	const size_t                   queue_size;
+	std::vector<std::vector<char>> slots;
+	std::vector<int>               slots_frame_id;
+	std::vector<size_t>            slot_offsets;
+	std::atomic<size_t>            q_head;
+	std::atomic<size_t>            q_tail;
+	std::atomic<unsigned>          n_dropped;
+
+	Dumper*                        sink;
+	std::vector<Dumper*>           sources;
+	std::string                    stream_path;
+	std::vector<std::ofstream>     files;
+	std::vector<unsigned>          n_written;
+	std::mutex                     mutex_writer;
+	std::condition_variable        cond_writer;
+	std::condition_variable        cond_flushed;
+	bool                           writer_stop;
+	std::thread                    writer;
+
 public:
-	Dumper(/*const int n_frames = 1*/);
-	virtual ~Dumper() = default;
+	explicit Dumper(const unsigned max_captures = 0, const unsigned sampling = 1, const size_t queue_size = 0);
+	virtual ~Dumper();
 
 	template <typename T>
 	void register_data(const T *ptr, const unsigned size, const unsigned add_threshold = 0,
@@ -48,18 +82,45 @@ public:
 	virtual void add  (const unsigned n_err, const int frame_id = 0);
 	virtual void clear(                                            );
 
+	/*!
+	 * \brief Opens the files of 'base_path' and starts the writer thread which streams the frames captured
+	 *        asynchronously in them (requires a capture queue), 'dump' completes the headers and closes the files.
+	 */
+	virtual void open(const std::string& base_path);
+
+	/*!
+	 * \brief Waits until all the frames captured asynchronously have been written.
+	 */
+	void flush();
+
+	/*!
+	 * \brief Returns the number of frames lost because the capture queue was full (since the last 'clear').
+	 */
+	unsigned get_n_dropped() const;
+
 protected:
 	void write_header_text(std::ofstream &file, const unsigned n_data, const unsigned data_size,
-	                       const std::vector<unsigned> &headers);
+	                       const std::vector<unsigned> &headers, const int n_data_width = 0);
 	void write_body_text(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned size,
 	                     const std::type_index type);
 	void write_header_binary(std::ofstream &file, const unsigned n_data, const unsigned data_size,
 	                         const std::vector<unsigned> &headers);
 	void write_body_binary(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned bytes);
+	void write_record_text(std::ofstream &file, const char *data, const unsigned size, const std::type_index type);
+
+	bool is_streaming() const;
+	void close_stream();
 
 private:
+	void resize_slots();
+	void copy_frame(const int frame_id);
+	void wake_writer();
+	bool is_pending() const;
+	void drain(Dumper &source);
+	void writer_loop();
+
 	template <typename T>
-	void _write_body_text(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned size);
+	void _write_record_text(std::ofstream &file, const char *data, const unsigned size);
 };
 }
 }
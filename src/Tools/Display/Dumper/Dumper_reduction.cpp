@@ -9,10 +9,25 @@
 using namespace aff3ct::tools;
 
 Dumper_reduction
-::Dumper_reduction(std::vector<std::unique_ptr<Dumper>> &dumpers)
-: Dumper(), dumpers(dumpers)
+::Dumper_reduction(std::vector<std::unique_ptr<Dumper>> &dumpers, const unsigned max_captures)
+: Dumper(max_captures), dumpers(dumpers)
 {
 	this->checks();
+
+	// the frames captured asynchronously by the dumpers are all written by the writer thread of the reduction
+	this->sources.clear();
+	for (auto& d : this->dumpers)
+	{
+		d->sink = this;
+		this->sources.push_back(d.get());
+	}
+}
+
+void Dumper_reduction
+::open(const std::string& base_path)
+{
+	this->checks();
+	Dumper::open(base_path);
 }
 
 void Dumper_reduction
@@ -134,6 +149,26 @@ void Dumper_reduction
 	if (base_path.empty())
 		throw invalid_argument(__FILE__, __LINE__, __func__, "'base_path' can't be empty.");
 
+	// the frames have already been written by the writer thread
+	if (this->is_streaming())
+	{
+		Dumper::dump(base_path);
+		return;
+	}
+
+	// each dumper has its own limit, the overall number of frames per noise point is limited here
+	if (this->max_captures)
+		for (auto i = 0; i < (int)dumpers[0]->buffer.size(); i++)
+		{
+			size_t n_left = this->max_captures;
+			for (auto& d : this->dumpers)
+			{
+				if (d->buffer[i].size() > n_left)
+					d->buffer[i].resize(n_left);
+				n_left -= d->buffer[i].size();
+			}
+		}
+
 	this->buffer             .resize(dumpers[0]->buffer.size());
 	this->registered_data_ptr.resize(dumpers[0]->registered_data_ptr.size());
 
@@ -183,6 +218,15 @@ void Dumper_reduction
 	}
 }
 
+unsigned Dumper_reduction
+::get_n_dropped() const
+{
+	unsigned n_dropped = 0;
+	for (auto& d : this->dumpers)
+		n_dropped += d->get_n_dropped();
+	return n_dropped;
+}
+
 void Dumper_reduction
 ::clear()
 {
@@ -17,13 +17,16 @@ protected:
 	std::vector<std::unique_ptr<Dumper>>& dumpers;
 
 public:
-	explicit Dumper_reduction(std::vector<std::unique_ptr<Dumper>> &dumpers);
+	explicit Dumper_reduction(std::vector<std::unique_ptr<Dumper>> &dumpers, const unsigned max_captures = 0);
 	virtual ~Dumper_reduction() = default;
 
+	virtual void open (const std::string& base_path);
 	virtual void dump (const std::string& base_path);
 	virtual void add  (const int frame_id = 0      );
 	virtual void clear(                            );
 
+	unsigned get_n_dropped() const;
+
 private:
 	void checks();
 };
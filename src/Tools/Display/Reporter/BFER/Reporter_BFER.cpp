@@ -69,6 +69,25 @@ typename Reporter_BFER<B>::report_t Reporter_BFER<B>
 	return the_report;
 }
 
+template <typename B>
+typename Reporter_BFER<B>::values_t Reporter_BFER<B>
+::report_values(bool final)
+{
+	assert(this->cols_groups.size() == 1);
+
+	values_t the_values(this->cols_groups.size());
+
+	auto& bfer_values = the_values[0];
+
+	bfer_values.push_back(Reporter::value_t((unsigned long long)this->monitor.get_n_analyzed_fra()));
+	bfer_values.push_back(Reporter::value_t((unsigned long long)this->monitor.get_n_be          ()));
+	bfer_values.push_back(Reporter::value_t((unsigned long long)this->monitor.get_n_fe          ()));
+	bfer_values.push_back(Reporter::value_t((double            )this->monitor.get_ber           ()));
+	bfer_values.push_back(Reporter::value_t((double            )this->monitor.get_fer           ()));
+
+	return the_values;
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
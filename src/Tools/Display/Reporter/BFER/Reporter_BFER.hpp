@@ -15,6 +15,7 @@ public:
 	using Rm = Reporter_monitor<module::Monitor_BFER<B>>;
 	using typename Rm::M;
 	using typename Rm::report_t;
+	using typename Rm::values_t;
 
 	explicit Reporter_BFER(const M &monitor);
 
@@ -22,6 +23,8 @@ public:
 
 	report_t report(bool final = false);
 
+	values_t report_values(bool final = false);
+
 private:
 	void create_groups();
 };
@@ -71,6 +71,33 @@ typename Reporter_EXIT<B,R>::report_t Reporter_EXIT<B,R>
 	return the_report;
 }
 
+template <typename B, typename R>
+typename Reporter_EXIT<B,R>::values_t Reporter_EXIT<B,R>
+::report_values(bool final)
+{
+	assert(this->cols_groups.size() == 1);
+
+	values_t the_values(this->cols_groups.size());
+
+	auto& EXIT_values = the_values[0];
+
+	double sig_a = 0.;
+	try
+	{
+		sig_a = (double)noise_a.get_noise();
+	}
+	catch(tools::runtime_error&)
+	{
+	}
+
+	EXIT_values.push_back(Reporter::value_t(sig_a));
+	EXIT_values.push_back(Reporter::value_t((unsigned long long)this->monitor.get_n_trials()));
+	EXIT_values.push_back(Reporter::value_t((double            )this->monitor.get_I_A     ()));
+	EXIT_values.push_back(Reporter::value_t((double            )this->monitor.get_I_E     ()));
+
+	return the_values;
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -16,6 +16,7 @@ public:
 	using Rm = Reporter_monitor<module::Monitor_EXIT<B,R>>;
 	using typename Rm::M;
 	using typename Rm::report_t;
+	using typename Rm::values_t;
 
 protected:
 	const Noise<R>& noise_a;
@@ -27,6 +28,8 @@ public:
 
 	report_t report(bool final = false);
 
+	values_t report_values(bool final = false);
+
 private:
 	void create_groups();
 };
@@ -62,6 +62,24 @@ typename Reporter_MI<B,R>::report_t Reporter_MI<B,R>
 	return the_report;
 }
 
+template <typename B, typename R>
+typename Reporter_MI<B,R>::values_t Reporter_MI<B,R>
+::report_values(bool final)
+{
+	assert(this->cols_groups.size() == 1);
+
+	values_t the_values(this->cols_groups.size());
+
+	auto& mi_values = the_values[0];
+
+	mi_values.push_back(Reporter::value_t((unsigned long long)this->monitor.get_n_trials()));
+	mi_values.push_back(Reporter::value_t((double            )this->monitor.get_MI      ()));
+	mi_values.push_back(Reporter::value_t((double            )this->monitor.get_MI_min  ()));
+	mi_values.push_back(Reporter::value_t((double            )this->monitor.get_MI_max  ()));
+
+	return the_values;
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -15,6 +15,7 @@ public:
 	using Rm = Reporter_monitor<module::Monitor_MI<B,R>>;
 	using typename Rm::M;
 	using typename Rm::report_t;
+	using typename Rm::values_t;
 
 public:
 	explicit Reporter_MI(const M &monitor);
@@ -23,6 +24,8 @@ public:
 
 	report_t report(bool final = false);
 
+	values_t report_values(bool final = false);
+
 private:
 	void create_groups();
 };
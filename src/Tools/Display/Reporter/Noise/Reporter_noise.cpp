@@ -137,14 +137,7 @@ template <typename R>
 Reporter::report_t Reporter_noise<R>
 ::report(bool final)
 {
-	if (this->saved_noise_type != get_noise_ptr()->get_type())
-	{
-		std::stringstream message;
-		message << "The noise to report has a different noise type '(*noise)->get_type()' than the one saved in"
-		        << " the constructor 'saved_noise_type' ('saved_noise_type' = " << type_to_str(this->saved_noise_type)
-		        << " and '(*noise)->get_type()' = " << type_to_str(get_noise_ptr()->get_type()) << ").";
-		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
-	}
+	this->check_noise_type();
 
 	assert(this->cols_groups.size() == 1);
 
@@ -191,6 +184,56 @@ Reporter::report_t Reporter_noise<R>
 	return the_report;
 }
 
+template <typename R>
+Reporter::values_t Reporter_noise<R>
+::report_values(bool final)
+{
+	this->check_noise_type();
+
+	assert(this->cols_groups.size() == 1);
+
+	values_t the_values(this->cols_groups.size());
+
+	auto& noise_values = the_values[0];
+
+	switch (get_noise_ptr()->get_type())
+	{
+		case Noise_type::SIGMA:
+		{
+			auto sig = dynamic_cast<const tools::Sigma<R>*>(get_noise_ptr());
+
+			if (show_sigma)
+				noise_values.push_back(value_t((double)sig->get_noise()));
+
+			noise_values.push_back(value_t((double)sig->get_esn0()));
+			noise_values.push_back(value_t((double)sig->get_ebn0()));
+			break;
+		}
+		case Noise_type::ROP:
+		case Noise_type::EP:
+		{
+			noise_values.push_back(value_t((double)get_noise_ptr()->get_noise()));
+			break;
+		}
+	}
+
+	return the_values;
+}
+
+template <typename R>
+void Reporter_noise<R>
+::check_noise_type() const
+{
+	if (this->saved_noise_type != get_noise_ptr()->get_type())
+	{
+		std::stringstream message;
+		message << "The noise to report has a different noise type '(*noise)->get_type()' than the one saved in"
+		        << " the constructor 'saved_noise_type' ('saved_noise_type' = " << type_to_str(this->saved_noise_type)
+		        << " and '(*noise)->get_type()' = " << type_to_str(get_noise_ptr()->get_type()) << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
 template <typename R>
 const Noise<R>* Reporter_noise<R>
 ::get_noise_ptr() const
@@ -27,6 +27,8 @@ public:
 
 	report_t report(bool final = false);
 
+	values_t report_values(bool final = false);
+
 private:
 	struct Noise_ptr;
 
@@ -40,6 +42,8 @@ protected:
 
 protected:
 	const Noise<R>* get_noise_ptr() const;
+
+	void check_noise_type() const;
 };
 }
 }
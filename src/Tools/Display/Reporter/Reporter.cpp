@@ -3,13 +3,44 @@
 using namespace aff3ct;
 using namespace aff3ct::tools;
 
+Reporter::value_t
+::value_t(const unsigned long long integer)
+: type(type_t::INTEGER), integer(integer), real((double)integer)
+{
+}
+
+Reporter::value_t
+::value_t(const double real)
+: type(type_t::REAL), integer(0), real(real)
+{
+}
+
+Reporter::value_t
+::value_t(const std::string &text)
+: type(type_t::TEXT), integer(0), real(0.), text(text)
+{
+}
+
 void Reporter
 ::init()
 {
 }
 
+Reporter::values_t Reporter
+::report_values(bool final)
+{
+	const auto the_report = this->report(final);
+
+	values_t the_values(the_report.size());
+	for (size_t g = 0; g < the_report.size(); g++)
+		for (auto &v : the_report[g])
+			the_values[g].push_back(value_t(v));
+
+	return the_values;
+}
+
 const std::vector<Reporter::group_t>& Reporter
 ::get_groups() const
 {
 	return this->cols_groups;
-}
\ No newline at end of file
+}
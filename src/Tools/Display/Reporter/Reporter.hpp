@@ -19,6 +19,25 @@ public:
 
 	using report_t = std::vector<std::vector<std::string>>;
 
+	/*
+	 * Raw value of a column, before its formatting for the text display
+	 */
+	struct value_t
+	{
+		enum class type_t { INTEGER, REAL, TEXT };
+
+		type_t             type;
+		unsigned long long integer;
+		double             real;
+		std::string        text;
+
+		explicit value_t(const unsigned long long integer);
+		explicit value_t(const double             real   );
+		explicit value_t(const std::string       &text   );
+	};
+
+	using values_t = std::vector<std::vector<value_t>>;
+
 protected:
 	std::vector<group_t> cols_groups;
 
@@ -33,6 +52,12 @@ public:
 	 */
 	virtual report_t report(bool final = false) = 0;
 
+	/*
+	 * Same as 'report' but with the raw values (for the machine readable outputs): the integers and the reals are not
+	 * formatted and the durations are in seconds. By default the values are the texts given by 'report'.
+	 */
+	virtual values_t report_values(bool final = false);
+
 	virtual void init(); // do nothing by default
 };
 }
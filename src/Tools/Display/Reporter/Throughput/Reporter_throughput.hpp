@@ -48,7 +48,16 @@ public:
 
 	report_t report(bool final = false);
 
+	values_t report_values(bool final = false);
+
 	void init();
+
+protected:
+	/*
+	 * Computes the simulation throughput (in Mb/s) and the elapsed time (the estimated remaining time for the temporary
+	 * reports if there is a progress limit, in seconds)
+	 */
+	void measure(const bool final, double &simu_thr, double &displayed_time) const;
 };
 }
 }
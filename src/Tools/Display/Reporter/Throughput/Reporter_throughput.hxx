@@ -75,6 +75,45 @@ Reporter::report_t Reporter_throughput<T>
 
 	auto& thgput_report = report[0];
 
+	double simu_thr, displayed_time;
+	this->measure(final, simu_thr, displayed_time);
+
+	std::stringstream str_thr;
+	str_thr << std::setprecision(3) << std::fixed << simu_thr;
+
+	thgput_report.push_back(str_thr.str());
+	thgput_report.push_back(get_time_format(displayed_time));
+
+	if (final)
+		init();
+
+	return report;
+}
+
+template <typename T>
+Reporter::values_t Reporter_throughput<T>
+::report_values(bool final)
+{
+	assert(this->cols_groups.size() == 1);
+
+	values_t the_values(this->cols_groups.size());
+
+	double simu_thr, displayed_time;
+	this->measure(final, simu_thr, displayed_time);
+
+	the_values[0].push_back(value_t(simu_thr));
+	the_values[0].push_back(value_t(displayed_time));
+
+	if (final)
+		init();
+
+	return the_values;
+}
+
+template <typename T>
+void Reporter_throughput<T>
+::measure(const bool final, double &simu_thr, double &displayed_time) const
+{
 	T progress = 0, nbits = 0;
 
 	if (progress_function != nullptr)
@@ -86,25 +125,12 @@ Reporter::report_t Reporter_throughput<T>
 	using namespace std::chrono;
 
 	auto simu_time = (double)duration_cast<microseconds>(steady_clock::now() - t_report).count(); // usec
-	double displayed_time = simu_time * 1e-6; // sec
+	displayed_time = simu_time * 1e-6; // sec
 
 	if (!final && progress != 0 && progress_limit != 0)
 		displayed_time *= (double)progress_limit / (double)progress - 1.;
 
-
-	auto str_time = get_time_format(displayed_time);
-	auto simu_thr = (double)nbits / simu_time; // = Mbps
-
-	std::stringstream str_thr;
-	str_thr << std::setprecision(3) << std::fixed << simu_thr;
-
-	thgput_report.push_back(str_thr.str());
-	thgput_report.push_back(str_time);
-
-	if (final)
-		init();
-
-	return report;
+	simu_thr = (double)nbits / simu_time; // = Mbps
 }
 
 template <typename T>
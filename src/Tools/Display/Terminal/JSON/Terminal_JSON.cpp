@@ -0,0 +1,329 @@
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include <iomanip>
+#include <limits>
+#include <chrono>
+#include <cmath>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Display/Terminal/JSON/Terminal_JSON.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+std::streambuf* aff3ct::tools::Terminal_JSON::stdout_buf = nullptr;
+
+namespace
+{
+// snapshot of the statistics of a timer or of a task, the durations are in seconds
+struct Timer_stats
+{
+	std::string name;
+	uint64_t    n_calls;
+	double      tot;
+	double      min;
+	double      max;
+};
+
+struct Task_stats
+{
+	std::string              module;
+	Timer_stats              task;
+	size_t                   n_elmts;
+	std::vector<Timer_stats> timers;
+};
+
+double to_sec(const std::chrono::nanoseconds d)
+{
+	return (double)d.count() * 1e-9;
+}
+}
+
+Terminal_JSON
+::Terminal_JSON(const std::vector<std::unique_ptr<tools::Reporter>>& reporters)
+: Terminal(),
+  reporters(reporters),
+  out(Terminal_JSON::stdout_buf != nullptr ? Terminal_JSON::stdout_buf : std::cout.rdbuf()),
+  stop_writer(false)
+{
+	for (auto& r : this->reporters)
+		if (r == nullptr)
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, "'this->reporters' contains null pointer.");
+
+	this->writer = std::thread(&Terminal_JSON::write_records, this);
+}
+
+Terminal_JSON
+::~Terminal_JSON()
+{
+	// the terminal thread pushes records
+	this->stop_temp_report();
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex_queue);
+		this->stop_writer = true;
+	}
+	this->cond_queue.notify_one();
+	this->writer.join();
+}
+
+void Terminal_JSON
+::reserve_stdout()
+{
+	if (Terminal_JSON::stdout_buf == nullptr)
+	{
+		std::cout.flush();
+		Terminal_JSON::stdout_buf = std::cout.rdbuf(std::cerr.rdbuf());
+	}
+}
+
+void Terminal_JSON
+::release_stdout()
+{
+	if (Terminal_JSON::stdout_buf != nullptr)
+	{
+		std::cout.rdbuf(Terminal_JSON::stdout_buf);
+		Terminal_JSON::stdout_buf = nullptr;
+	}
+}
+
+void Terminal_JSON
+::push(std::function<void(std::ostream&)> record) const
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mutex_queue);
+		this->queue.push_back(std::move(record));
+	}
+	this->cond_queue.notify_one();
+}
+
+void Terminal_JSON
+::write_records()
+{
+	std::unique_lock<std::mutex> lock(this->mutex_queue);
+	while (true)
+	{
+		this->cond_queue.wait(lock, [this]() { return this->stop_writer || !this->queue.empty(); });
+
+		if (this->queue.empty()) // stop_writer
+			break;
+
+		auto record = std::move(this->queue.front());
+		this->queue.pop_front();
+		const auto last = this->queue.empty();
+
+		// the records are formatted and written without holding the lock
+		lock.unlock();
+		record(this->out);
+		if (last)
+			this->out.flush();
+		lock.lock();
+	}
+}
+
+void Terminal_JSON
+::legend(std::ostream &stream) const
+{
+	this->push([this](std::ostream &out)
+	{
+		out << "{\"type\":\"legend\",\"groups\":[";
+		bool first_group = true;
+		for (auto& r : this->reporters)
+			for (auto& g : r->get_groups())
+			{
+				out << (first_group ? "" : ",") << "{\"title\":[";
+				write_string(out, g.first.first);
+				out << ",";
+				write_string(out, g.first.second);
+				out << "],\"columns\":[";
+
+				for (unsigned c = 0; c < g.second.size(); c++)
+				{
+					out << (c ? "," : "") << "[";
+					write_string(out, g.second[c].first);
+					out << ",";
+					write_string(out, g.second[c].second);
+					out << "]";
+				}
+				out << "]}";
+				first_group = false;
+			}
+		out << "]}\n";
+	});
+}
+
+void Terminal_JSON
+::report(std::ostream &stream, bool final)
+{
+	// only the values are collected here, the writer thread formats them
+	std::vector<Reporter::values_t> values;
+	for (auto& r : this->reporters)
+		values.push_back(r->report_values(final));
+
+	const bool interrupted = final && Terminal::is_interrupt();
+
+	this->push([this, values, final, interrupted](std::ostream &out)
+	{
+		out << "{\"type\":" << (final ? "\"final\"" : "\"temp\"")
+		    << ",\"interrupted\":" << (interrupted ? "true" : "false")
+		    << ",\"groups\":{";
+
+		bool first_group = true;
+		for (size_t r = 0; r < this->reporters.size(); r++)
+		{
+			auto& groups = this->reporters[r]->get_groups();
+
+			assert(values[r].size() == groups.size());
+
+			for (unsigned g = 0; g < groups.size(); g++)
+			{
+				assert(values[r][g].size() == groups[g].second.size());
+
+				out << (first_group ? "" : ",");
+				write_string(out, groups[g].first.first);
+				out << ":{";
+
+				for (unsigned c = 0; c < values[r][g].size(); c++)
+				{
+					out << (c ? "," : "");
+					write_string(out, groups[g].second[c].first);
+					out << ":";
+					write_value(out, values[r][g][c]);
+				}
+				out << "}";
+				first_group = false;
+			}
+		}
+		out << "}}\n";
+	});
+}
+
+void Terminal_JSON
+::statistics(const std::vector<std::vector<const module::Module*>> &modules)
+{
+	std::vector<Task_stats> stats;
+	for (auto &vm : modules)
+	{
+		if (vm.empty() || vm[0] == nullptr)
+			continue;
+
+		auto &m0 = *vm[0];
+		for (size_t t = 0; t < m0.tasks.size(); t++)
+		{
+			auto &t0 = *m0.tasks[t];
+
+			Task_stats ts;
+			ts.module  = m0.get_custom_name().empty() ? m0.get_short_name() : m0.get_custom_name();
+			ts.n_elmts = t0.sockets.empty() ? 0 : t0.sockets.back()->get_n_elmts();
+			ts.task    = {t0.get_name(), 0, 0., std::numeric_limits<double>::max(), 0.};
+			for (auto &name : t0.get_timers_name())
+				ts.timers.push_back({name, 0, 0., std::numeric_limits<double>::max(), 0.});
+
+			// merge the instances of the task (one per thread)
+			for (auto *m : vm)
+			{
+				auto &tk = *m->tasks[t];
+				if (tk.get_n_calls() == 0)
+					continue;
+
+				ts.task.n_calls += tk.get_n_calls();
+				ts.task.tot     += to_sec(tk.get_duration_total());
+				ts.task.min      = std::min(ts.task.min, to_sec(tk.get_duration_min()));
+				ts.task.max      = std::max(ts.task.max, to_sec(tk.get_duration_max()));
+
+				for (size_t i = 0; i < ts.timers.size() && i < tk.get_timers_name().size(); i++)
+				{
+					if (tk.get_timers_n_calls()[i] == 0)
+						continue;
+
+					ts.timers[i].n_calls += tk.get_timers_n_calls()[i];
+					ts.timers[i].tot     += to_sec(tk.get_timers_total()[i]);
+					ts.timers[i].min      = std::min(ts.timers[i].min, to_sec(tk.get_timers_min()[i]));
+					ts.timers[i].max      = std::max(ts.timers[i].max, to_sec(tk.get_timers_max()[i]));
+				}
+			}
+
+			if (ts.task.n_calls != 0)
+				stats.push_back(std::move(ts));
+		}
+	}
+
+	this->push([stats](std::ostream &out)
+	{
+		auto write_timer = [&out](const Timer_stats &ts)
+		{
+			out << "\"calls\":" << ts.n_calls << ",\"time\":";
+			write_real(out, ts.tot);
+			out << ",\"min_latency\":";
+			write_real(out, ts.n_calls ? ts.min : 0.);
+			out << ",\"max_latency\":";
+			write_real(out, ts.max);
+		};
+
+		out << "{\"type\":\"stats\",\"tasks\":[";
+		for (size_t t = 0; t < stats.size(); t++)
+		{
+			out << (t ? "," : "") << "{\"module\":";
+			write_string(out, stats[t].module);
+			out << ",\"task\":";
+			write_string(out, stats[t].task.name);
+			out << ",\"n_elmts\":" << stats[t].n_elmts << ",";
+			write_timer(stats[t].task);
+			out << ",\"timers\":[";
+			for (size_t i = 0; i < stats[t].timers.size(); i++)
+			{
+				out << (i ? "," : "") << "{\"name\":";
+				write_string(out, stats[t].timers[i].name);
+				out << ",";
+				write_timer(stats[t].timers[i]);
+				out << "}";
+			}
+			out << "]}";
+		}
+		out << "]}\n";
+	});
+}
+
+void Terminal_JSON
+::write_string(std::ostream &stream, const std::string &str)
+{
+	stream << "\"";
+	for (auto c : str)
+	{
+		switch (c)
+		{
+			case '"':  stream << "\\\""; break;
+			case '\\': stream << "\\\\"; break;
+			case '\n': stream << "\\n";  break;
+			case '\t': stream << "\\t";  break;
+			default:
+				if ((unsigned char)c < 0x20)
+					stream << " ";
+				else
+					stream << c;
+		}
+	}
+	stream << "\"";
+}
+
+void Terminal_JSON
+::write_value(std::ostream &stream, const Reporter::value_t &value)
+{
+	switch (value.type)
+	{
+		case Reporter::value_t::type_t::INTEGER: stream << value.integer;            break;
+		case Reporter::value_t::type_t::REAL:    write_real  (stream, value.real);   break;
+		case Reporter::value_t::type_t::TEXT:    write_string(stream, value.text);   break;
+	}
+}
+
+void Terminal_JSON
+::write_real(std::ostream &stream, const double real)
+{
+	// JSON has no representation of the infinities and of NaN
+	if (std::isfinite(real))
+		stream << std::setprecision(std::numeric_limits<double>::digits10) << real;
+	else
+		stream << "null";
+}
@@ -0,0 +1,111 @@
+/*!
+ * \file
+ * \brief The terminal_JSON display (machine readable).
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef TERMINAL_JSON_HPP_
+#define TERMINAL_JSON_HPP_
+
+#include <condition_variable>
+#include <functional>
+#include <streambuf>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <deque>
+
+#include "Module/Module.hpp"
+#include "Tools/Display/Reporter/Reporter.hpp"
+#include "Tools/Display/Terminal/Terminal.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Terminal_JSON
+ *
+ * \brief The terminal_JSON display: one JSON object per line (JSON lines format).
+ *
+ * The legend is a record of type "legend" that describes the groups and the columns. The reports are records of type
+ * "temp" or "final" with the raw values of the reporters (Reporter::report_values) indexed by the group and the column
+ * titles, the durations are in seconds. The task statistics are records of type "stats".
+ *
+ * The values are collected in the calling thread and the records are formatted and written by a dedicated writer
+ * thread. All the records are written in the standard output (the 'stream' parameters are ignored): use
+ * Terminal_JSON::reserve_stdout to send the text of the simulation to the error output.
+ */
+class Terminal_JSON : public Terminal
+{
+protected:
+	const std::vector<std::unique_ptr<tools::Reporter>>& reporters;
+
+	std::ostream out; /*!< The stream of the records. */
+
+private:
+	static std::streambuf* stdout_buf; /*!< The standard output when it is reserved to the records. */
+
+	// the writer thread and its queue of records (the legend is enqueued from a const method)
+	mutable std::mutex                                     mutex_queue;
+	mutable std::condition_variable                        cond_queue;
+	mutable std::deque<std::function<void(std::ostream&)>> queue;
+	bool                                                   stop_writer;
+	std::thread                                            writer;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 */
+	explicit Terminal_JSON(const std::vector<std::unique_ptr<tools::Reporter>>& reporters);
+
+	/*!
+	 * \brief Destructor: writes the records which are still in the queue.
+	 */
+	virtual ~Terminal_JSON();
+
+	/*!
+	 * \brief Displays the terminal_JSON legend.
+	 *
+	 * \param stream: ignored, the records are written in the standard output.
+	 */
+	void legend(std::ostream &stream = std::cout) const;
+
+	/*!
+	 * \brief Writes a record with the statistics of the tasks (the tasks of the same module type are merged).
+	 *
+	 * \param modules: the modules, one vector of instances (one per thread) per module type.
+	 */
+	void statistics(const std::vector<std::vector<const module::Module*>> &modules);
+
+	/*!
+	 * \brief Redirects the text written in std::cout (parameters, legends, statistics, ...) to the error output: the
+	 *        standard output is reserved to the records.
+	 */
+	static void reserve_stdout();
+
+	/*!
+	 * \brief Cancels Terminal_JSON::reserve_stdout.
+	 */
+	static void release_stdout();
+
+protected:
+	virtual void report(std::ostream &stream = std::cout, bool final = false);
+
+	void push(std::function<void(std::ostream&)> record) const;
+
+	static void write_string(std::ostream &stream, const std::string &str);
+	static void write_value (std::ostream &stream, const Reporter::value_t &value);
+	static void write_real  (std::ostream &stream, const double real);
+
+private:
+	void write_records();
+};
+}
+}
+
+#endif /* TERMINAL_JSON_HPP_ */
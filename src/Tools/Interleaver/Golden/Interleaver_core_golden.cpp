@@ -16,6 +16,14 @@ Interleaver_core_golden<T>
 	gen.seed(seed);
 }
 
+template <typename T>
+void Interleaver_core_golden<T>
+::set_seed(const int seed)
+{
+	this->gen.seed(seed);
+	this->dist.reset();
+}
+
 template <typename T>
 void Interleaver_core_golden<T>
 ::gen_lut(T *lut, const int frame_id)
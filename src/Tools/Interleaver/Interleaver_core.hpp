@@ -52,6 +52,14 @@ public:
 
 	void refresh();
 
+	/*!
+	 * \brief Sets the seed of the random generator of the LUT (nothing is done if the Interleaver is not random),
+	 *        the LUT is updated at the next 'refresh()' call.
+	 *
+	 * \param seed: the new seed.
+	 */
+	virtual void set_seed(const int seed);
+
 protected:
 	virtual void gen_lut(T *lut, const int frame_id) = 0;
 };
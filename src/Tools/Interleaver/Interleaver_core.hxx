@@ -93,6 +93,12 @@ void Interleaver_core<T>
 	this->initialized = true;
 }
 
+template <typename T>
+void Interleaver_core<T>
+::set_seed(const int seed)
+{
+}
+
 template <typename T>
 void Interleaver_core<T>
 ::refresh()
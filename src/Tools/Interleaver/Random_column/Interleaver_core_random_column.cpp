@@ -25,6 +25,13 @@ Interleaver_core_random_column<T>
 	rd_engine.seed(seed);
 }
 
+template <typename T>
+void Interleaver_core_random_column<T>
+::set_seed(const int seed)
+{
+	this->rd_engine.seed(seed);
+}
+
 template <typename T>
 void Interleaver_core_random_column<T>
 ::gen_lut(T *lut, const int frame_id)
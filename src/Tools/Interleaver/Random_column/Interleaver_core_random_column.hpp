@@ -24,6 +24,8 @@ public:
 	                               const int n_frames = 1);
 	virtual ~Interleaver_core_random_column() = default;
 
+	virtual void set_seed(const int seed);
+
 protected:
 	void gen_lut(T *lut, const int frame_id);
 };
@@ -0,0 +1,32 @@
+#ifndef FFT_H_
+#define FFT_H_
+
+#include <complex>
+#include <vector>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Compute in place the discrete Fourier transform of 'data' (radix-2 decimation in time).
+ * The size of 'data' must be a power of two.
+ * If 'inverse' is true, compute the inverse transform (the result is scaled by 1/data.size()).
+ */
+template <typename R>
+void fft(std::vector<std::complex<R>> &data, const bool inverse = false);
+
+/*
+ * Compute the linear auto-convolutions of 'a' and 'b' (a * a and b * b) with a single pair of FFTs (the two real
+ * sequences are packed in the real and the imaginary parts of a complex sequence).
+ * The rounding errors of the two sequences are mixed: they should have values of the same order of magnitude.
+ * 'a' and 'b' must have the same size, 'aa' and 'bb' are resized to 2 * a.size() -1.
+ */
+template <typename R>
+void auto_convolution(const std::vector<R> &a, const std::vector<R> &b, std::vector<R> &aa, std::vector<R> &bb);
+}
+}
+
+#include "Tools/Math/fft.hxx"
+
+#endif // FFT_H_
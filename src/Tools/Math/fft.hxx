@@ -0,0 +1,132 @@
+#ifndef FFT_HXX_
+#define FFT_HXX_
+
+#include <sstream>
+#include <utility>
+#include <cmath>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/fft.h"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <typename R>
+void fft(std::vector<std::complex<R>> &data, const bool inverse)
+{
+	const auto n = data.size();
+	if (n & (n -1))
+	{
+		std::stringstream message;
+		message << "'data.size()' has to be a power of two ('data.size()' = " << n << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// bit reversal permutation
+	for (size_t i = 1, j = 0; i < n; i++)
+	{
+		auto bit = n >> 1;
+		for (; j & bit; bit >>= 1)
+			j ^= bit;
+		j ^= bit;
+
+		if (i < j)
+			std::swap(data[i], data[j]);
+	}
+
+	// the twiddle factors of the largest stage are kept between the calls (they are shared by all the stages)
+	thread_local std::vector<std::complex<R>> twiddles;
+	if (twiddles.size() != n / 2)
+	{
+		const auto pi = std::acos(-(R)1);
+		twiddles.resize(n / 2);
+		for (size_t k = 0; k < n / 2; k++)
+			twiddles[k] = std::polar((R)1, -(R)2 * pi * (R)k / (R)n);
+	}
+
+	// the butterflies work on the interleaved real and imaginary parts ('std::complex' products check for NaNs)
+	auto d = reinterpret_cast<R*>(data.data());
+	auto w = reinterpret_cast<const R*>(twiddles.data());
+	const R sign = inverse ? (R)-1 : (R)1;
+	for (size_t len = 2; len <= n; len <<= 1)
+	{
+		const auto half   = len >> 1;
+		const auto stride = n / len;
+
+		for (size_t i = 0; i < n; i += len)
+			for (size_t k = 0; k < half; k++)
+			{
+				const auto wr = w[2 * k * stride +0];
+				const auto wi = w[2 * k * stride +1] * sign;
+				auto u = d + 2 * (i + k);
+				auto x = d + 2 * (i + k + half);
+				const auto vr = x[0] * wr - x[1] * wi;
+				const auto vi = x[0] * wi + x[1] * wr;
+				x[0] = u[0] - vr;
+				x[1] = u[1] - vi;
+				u[0] = u[0] + vr;
+				u[1] = u[1] + vi;
+			}
+	}
+
+	if (inverse)
+		for (auto &d : data)
+			d /= (R)n;
+}
+
+template <typename R>
+void auto_convolution(const std::vector<R> &a, const std::vector<R> &b, std::vector<R> &aa, std::vector<R> &bb)
+{
+	if (a.size() != b.size())
+	{
+		std::stringstream message;
+		message << "'a.size()' has to be equal to 'b.size()' ('a.size()' = " << a.size()
+		        << ", 'b.size()' = " << b.size() << ").";
+		throw length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (a.empty())
+	{
+		aa.clear();
+		bb.clear();
+		return;
+	}
+
+	const auto n_c = 2 * a.size() -1;
+	size_t n = 1;
+	while (n < n_c) n <<= 1;
+
+	std::vector<std::complex<R>> f(n);
+	for (size_t i = 0; i < a.size(); i++)
+		f[i] = std::complex<R>(a[i], b[i]);
+
+	fft(f);
+
+	// A[k] = (F[k] + F*[n-k]) / 2 and B[k] = (F[k] - F*[n-k]) / 2i, then F[k] = A[k]^2 + i B[k]^2
+	std::vector<std::complex<R>> g(n);
+	for (size_t k = 0; k < n; k++)
+	{
+		const auto fk = f[k];
+		const auto fc = f[(n - k) & (n -1)];
+		const auto ar = (R)0.5 * (fk.real() + fc.real()), ai = (R)0.5 * (fk.imag() - fc.imag());
+		const auto br = (R)0.5 * (fk.imag() + fc.imag()), bi = (R)0.5 * (fc.real() - fk.real());
+		const auto a2r = ar * ar - ai * ai, a2i = (R)2 * ar * ai;
+		const auto b2r = br * br - bi * bi, b2i = (R)2 * br * bi;
+		g[k] = std::complex<R>(a2r - b2i, a2i + b2r);
+	}
+
+	fft(g, true);
+
+	aa.resize(n_c);
+	bb.resize(n_c);
+	for (size_t i = 0; i < n_c; i++)
+	{
+		aa[i] = g[i].real();
+		bb[i] = g[i].imag();
+	}
+}
+}
+}
+
+#endif // FFT_HXX_
@@ -0,0 +1,20 @@
+#ifndef FHT_H_
+#define FHT_H_
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Compute in place the (unnormalized) Walsh-Hadamard transform of 'data': data[j] = sum_i (-1)^<i,j> data[i].
+ * 'size' must be a power of two. The butterflies of the stages whose half-size is a multiple of the number of elements
+ * in a register are computed with MIPP: 'data' has to be aligned when 'size' is larger than a register.
+ */
+template <typename T>
+void fht(T *data, const int size);
+}
+}
+
+#include "Tools/Math/fht.hxx"
+
+#endif // FHT_H_
@@ -0,0 +1,49 @@
+#ifndef FHT_HXX_
+#define FHT_HXX_
+
+#include <sstream>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/fht.h"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <typename T>
+void fht(T *data, const int size)
+{
+	if (size <= 0 || (size & (size -1)))
+	{
+		std::stringstream message;
+		message << "'size' has to be a positive power of two ('size' = " << size << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the first stages work inside the registers, they are computed sequentially
+	auto half = 1;
+	for (; half < size && half < mipp::nElReg<T>(); half <<= 1)
+		for (auto i = 0; i < size; i += 2 * half)
+			for (auto j = i; j < i + half; j++)
+			{
+				const auto a = data[j       ];
+				const auto b = data[j + half];
+				data[j       ] = a + b;
+				data[j + half] = a - b;
+			}
+
+	for (; half < size; half <<= 1)
+		for (auto i = 0; i < size; i += 2 * half)
+			for (auto j = i; j < i + half; j += mipp::nElReg<T>())
+			{
+				const auto r_a = mipp::Reg<T>(&data[j       ]);
+				const auto r_b = mipp::Reg<T>(&data[j + half]);
+				(r_a + r_b).store(&data[j       ]);
+				(r_a - r_b).store(&data[j + half]);
+			}
+}
+}
+}
+
+#endif // FHT_HXX_
@@ -0,0 +1,114 @@
+#ifdef __AVX512BW__
+
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Transpose/transpose_AVX512.h"
+
+namespace
+{
+// one butterfly stage of the 16x16 transposition inside the 128-bit lanes: the rows are grouped by pairs and the
+// columns are split in two halves, 'W' is the size (in bytes) of the elements moved together
+template <int W>
+inline __m512i unpacklo(const __m512i a, const __m512i b);
+template <int W>
+inline __m512i unpackhi(const __m512i a, const __m512i b);
+
+template <> inline __m512i unpacklo<1>(const __m512i a, const __m512i b) { return _mm512_unpacklo_epi8 (a, b); }
+template <> inline __m512i unpackhi<1>(const __m512i a, const __m512i b) { return _mm512_unpackhi_epi8 (a, b); }
+template <> inline __m512i unpacklo<2>(const __m512i a, const __m512i b) { return _mm512_unpacklo_epi16(a, b); }
+template <> inline __m512i unpackhi<2>(const __m512i a, const __m512i b) { return _mm512_unpackhi_epi16(a, b); }
+template <> inline __m512i unpacklo<4>(const __m512i a, const __m512i b) { return _mm512_unpacklo_epi32(a, b); }
+template <> inline __m512i unpackhi<4>(const __m512i a, const __m512i b) { return _mm512_unpackhi_epi32(a, b); }
+template <> inline __m512i unpacklo<8>(const __m512i a, const __m512i b) { return _mm512_unpacklo_epi64(a, b); }
+template <> inline __m512i unpackhi<8>(const __m512i a, const __m512i b) { return _mm512_unpackhi_epi64(a, b); }
+
+template <int W>
+inline void butterfly_16(const __m512i in[16], __m512i out[16])
+{
+	constexpr int G = 16 / W; // number of row groups before the stage
+	constexpr int C =      W; // number of column groups before the stage
+
+	for (auto c = 0; c < C; c++)
+		for (auto q = 0; q < G / 2; q++)
+		{
+			out[(c * 2 +0) * (G / 2) + q] = unpacklo<W>(in[c * G + 2 * q], in[c * G + 2 * q +1]);
+			out[(c * 2 +1) * (G / 2) + q] = unpackhi<W>(in[c * G + 2 * q], in[c * G + 2 * q +1]);
+		}
+}
+
+// transposes the 16x16 bytes blocks of 16 registers, lane per lane: 'r[t]' lane 'l' = column 'l*16+t' of the rows
+inline void transpose_16x16_lanes(__m512i r[16])
+{
+	__m512i t[16];
+	butterfly_16<1>(r, t);
+	butterfly_16<2>(t, r);
+	butterfly_16<4>(r, t);
+	butterfly_16<8>(t, r);
+}
+
+// transposes the 64x64 bytes block 'r' (64 rows of 64 bytes) and stores the row 'c' of the result in 'dst[c*stride]'
+inline void transpose_64x64(__m512i r[64], __m512i *dst, const int stride)
+{
+	for (auto g = 0; g < 4; g++)
+		transpose_16x16_lanes(r + g * 16);
+
+	// 4x4 transposition of the 128-bit lanes between the 4 groups of 16 rows
+	for (auto t = 0; t < 16; t++)
+	{
+		const auto t0 = _mm512_shuffle_i64x2(r[t +  0], r[t + 16], _MM_SHUFFLE(2,0,2,0));
+		const auto t1 = _mm512_shuffle_i64x2(r[t +  0], r[t + 16], _MM_SHUFFLE(3,1,3,1));
+		const auto t2 = _mm512_shuffle_i64x2(r[t + 32], r[t + 48], _MM_SHUFFLE(2,0,2,0));
+		const auto t3 = _mm512_shuffle_i64x2(r[t + 32], r[t + 48], _MM_SHUFFLE(3,1,3,1));
+
+		_mm512_store_si512(dst + (0 * 16 + t) * stride, _mm512_shuffle_i64x2(t0, t2, _MM_SHUFFLE(2,0,2,0)));
+		_mm512_store_si512(dst + (1 * 16 + t) * stride, _mm512_shuffle_i64x2(t1, t3, _MM_SHUFFLE(2,0,2,0)));
+		_mm512_store_si512(dst + (2 * 16 + t) * stride, _mm512_shuffle_i64x2(t0, t2, _MM_SHUFFLE(3,1,3,1)));
+		_mm512_store_si512(dst + (3 * 16 + t) * stride, _mm512_shuffle_i64x2(t1, t3, _MM_SHUFFLE(3,1,3,1)));
+	}
+}
+
+void check_n(const int n)
+{
+	if (n % 64)
+	{
+		std::stringstream message;
+		message << "'n' has to be divisible by 64 ('n' = " << n << ").";
+		throw aff3ct::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+}
+
+void aff3ct::tools::uchar_transpose_avx512(const __m512i *src, __m512i *dst, int n)
+{
+	check_n(n);
+
+	const int constN = n / 64; // number of 512-bit packets per frame
+	__m512i r[64];
+
+	for (auto i = 0; i < constN; i++)
+	{
+		for (auto f = 0; f < 64; f++)
+			r[f] = _mm512_load_si512(src + f * constN + i);
+
+		transpose_64x64(r, dst + i * 64, 1);
+	}
+}
+
+void aff3ct::tools::uchar_itranspose_avx512(const __m512i *src, __m512i *dst, int n)
+{
+	check_n(n);
+
+	const int constN = n / 64; // number of 512-bit packets per frame
+	__m512i r[64];
+
+	for (auto i = 0; i < constN; i++)
+	{
+		for (auto e = 0; e < 64; e++)
+			r[e] = _mm512_load_si512(src + i * 64 + e);
+
+		transpose_64x64(r, dst + i, constN);
+	}
+}
+
+#endif
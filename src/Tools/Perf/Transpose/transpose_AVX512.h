@@ -0,0 +1,19 @@
+#ifdef __AVX512BW__
+
+#ifndef TRANSPOSE_AVX512_H
+#define	TRANSPOSE_AVX512_H
+
+#include <immintrin.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+void uchar_transpose_avx512 (const __m512i *src, __m512i *dst, int n);
+void uchar_itranspose_avx512(const __m512i *src, __m512i *dst, int n);
+}
+}
+
+#endif	/* TRANSPOSE_AVX512_H */
+
+#endif
@@ -1,7 +1,9 @@
 #include <limits>
 
 #include "Tools/Exception/exception.hpp"
-#ifdef __AVX2__
+#ifdef __AVX512BW__
+#include "Tools/Perf/Transpose/transpose_AVX512.h"
+#elif defined(__AVX2__)
 #include "Tools/Perf/Transpose/transpose_AVX.h"
 #elif defined(__SSE4_1__)
 #include "Tools/Perf/Transpose/transpose_SSE.h"
@@ -13,7 +15,9 @@
 
 bool aff3ct::tools::char_transpose(const signed char *src, signed char *dst, int n)
 {
-#if defined(__MIC__) || defined(__KNCNI__) || defined(__AVX512__) || defined(__AVX512F__)
+#if defined(__AVX512BW__)
+	int min_n = 512;
+#elif defined(__MIC__) || defined(__KNCNI__) || defined(__AVX512__) || defined(__AVX512F__)
 	int min_n = std::numeric_limits<int>::max();
 #elif defined(__AVX2__)
 	int min_n = 256;
@@ -29,7 +33,10 @@ bool aff3ct::tools::char_transpose(const signed char *src, signed char *dst, int
 			throw runtime_error(__FILE__, __LINE__, __func__, "'src' is unaligned memory.");
 		if (((uintptr_t)dst) % (min_n / 8))
 			throw runtime_error(__FILE__, __LINE__, __func__, "'dst' is unaligned memory.");
-#if defined(__MIC__) || defined(__KNCNI__) || defined(__AVX512__) || defined(__AVX512F__)
+#if defined(__AVX512BW__)
+		uchar_transpose_avx512((__m512i*) src, (__m512i*) dst, n);
+		return true;
+#elif defined(__MIC__) || defined(__KNCNI__) || defined(__AVX512__) || defined(__AVX512F__)
 		return false;
 #elif defined(__AVX2__)
 		uchar_transpose_avx((__m256i*) src, (__m256i*) dst, n);
@@ -48,7 +55,9 @@ bool aff3ct::tools::char_transpose(const signed char *src, signed char *dst, int
 
 bool aff3ct::tools::char_itranspose(const signed char *src, signed char *dst, int n)
 {
-#if defined(__MIC__) || defined(__KNCNI__) || defined(__AVX512__) || defined(__AVX512F__)
+#if defined(__AVX512BW__)
+	int min_n = 512;
+#elif defined(__MIC__) || defined(__KNCNI__) || defined(__AVX512__) || defined(__AVX512F__)
 	int min_n = std::numeric_limits<int>::max();
 #elif defined(__AVX2__)
 	int min_n = 256;
@@ -64,7 +73,10 @@ bool aff3ct::tools::char_itranspose(const signed char *src, signed char *dst, in
 			throw runtime_error(__FILE__, __LINE__, __func__, "'src' is unaligned memory.");
 		if (((uintptr_t)dst) % (min_n / 8))
 			throw runtime_error(__FILE__, __LINE__, __func__, "'dst' is unaligned memory.");
-#if defined(__MIC__) || defined(__KNCNI__) || defined(__AVX512__) || defined(__AVX512F__)
+#if defined(__AVX512BW__)
+		uchar_itranspose_avx512((__m512i*) src, (__m512i*) dst, n / 8);
+		return true;
+#elif defined(__MIC__) || defined(__KNCNI__) || defined(__AVX512__) || defined(__AVX512F__)
 		return false;
 #elif defined(__AVX2__)
 		uchar_itranspose_avx((__m256i*) src, (__m256i*) dst, n / 8);
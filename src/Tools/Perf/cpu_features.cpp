@@ -0,0 +1,42 @@
+#include <vector>
+#include <utility>
+
+#include "Tools/Perf/cpu_features.h"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+bool aff3ct::tools::cpu_supports(const simd_isa isa)
+{
+	switch (isa)
+	{
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+		case simd_isa::SSE4_1:   return __builtin_cpu_supports("sse4.1"  );
+		case simd_isa::AVX2:     return __builtin_cpu_supports("avx2"    );
+		case simd_isa::AVX512F:  return __builtin_cpu_supports("avx512f" );
+		case simd_isa::AVX512BW: return __builtin_cpu_supports("avx512bw");
+#elif defined(__SSE4_1__) // no runtime detection: rely on the compilation flags
+		case simd_isa::SSE4_1:   return true;
+#endif
+#if defined(__aarch64__) || defined(__ARM_NEON__) || defined(__ARM_NEON)
+		case simd_isa::NEON:     return true;
+#endif
+		default:                 return false;
+	}
+}
+
+std::string aff3ct::tools::get_cpu_simd_isas()
+{
+	const std::vector<std::pair<simd_isa,std::string>> isas = {{simd_isa::SSE4_1,   "SSE4.1"  },
+	                                                           {simd_isa::AVX2,     "AVX2"    },
+	                                                           {simd_isa::AVX512F,  "AVX512F" },
+	                                                           {simd_isa::AVX512BW, "AVX512BW"},
+	                                                           {simd_isa::NEON,     "NEON"    }};
+
+	std::string list;
+	for (auto &isa : isas)
+		if (cpu_supports(isa.first))
+			list += (list.empty() ? "" : ", ") + isa.second;
+
+	return list.empty() ? "none" : list;
+}
@@ -0,0 +1,25 @@
+#ifndef CPU_FEATURES_H_
+#define CPU_FEATURES_H_
+
+#include <cstdint>
+#include <string>
+
+namespace aff3ct
+{
+namespace tools
+{
+enum class simd_isa : uint8_t { SSE4_1, AVX2, AVX512F, AVX512BW, NEON };
+
+/*
+ * Check at runtime if the CPU supports the 'isa' instruction set (cpuid on x86)
+ */
+bool cpu_supports(const simd_isa isa);
+
+/*
+ * Return the list of the SIMD instruction sets supported by the CPU (for instance "SSE4.1, AVX2")
+ */
+std::string get_cpu_simd_isas();
+}
+}
+
+#endif /* CPU_FEATURES_H_ */
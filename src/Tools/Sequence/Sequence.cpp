@@ -0,0 +1,225 @@
+#include <algorithm>
+#include <exception>
+#include <sstream>
+#include <atomic>
+#include <thread>
+#include <mutex>
+
+#include "Tools/Exception/exception.hpp"
+#include "Module/Module.hpp"
+#include "Tools/Sequence/Sequence.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Sequence
+::Sequence(module::Task &first)
+: Sequence(std::vector<module::Task*>(1, &first))
+{
+}
+
+Sequence
+::Sequence(const std::vector<module::Task*> &firsts)
+: Sequence(std::vector<std::vector<module::Task*>>(1, firsts))
+{
+}
+
+Sequence
+::Sequence(const std::vector<std::vector<module::Task*>> &firsts)
+{
+	if (firsts.empty())
+	{
+		std::stringstream message;
+		message << "'firsts.size()' has to be greater than 0.";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto &f : firsts)
+		this->sequences.push_back(Sequence::compile(f));
+
+	for (size_t tid = 1; tid < this->sequences.size(); tid++)
+		if (this->sequences[tid].size() != this->sequences[0].size())
+		{
+			std::stringstream message;
+			message << "All the threads have to execute the same number of tasks ('sequences[" << tid
+			        << "].size()' = " << this->sequences[tid].size() << ", 'sequences[0].size()' = "
+			        << this->sequences[0].size() << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+}
+
+size_t Sequence
+::get_n_threads() const
+{
+	return this->sequences.size();
+}
+
+const std::vector<module::Task*>& Sequence
+::get_tasks(const size_t tid) const
+{
+	if (tid >= this->sequences.size())
+	{
+		std::stringstream message;
+		message << "'tid' has to be smaller than 'sequences.size()' ('tid' = " << tid
+		        << ", 'sequences.size()' = " << this->sequences.size() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return this->sequences[tid];
+}
+
+void Sequence
+::exec(std::function<bool()> stop_condition)
+{
+	std::atomic<bool> stop(false);
+	std::exception_ptr first_exception;
+	std::mutex mtx;
+
+	auto thread_loop = [&](const size_t tid)
+	{
+		try
+		{
+			while (!stop && !stop_condition())
+				this->exec_seq(tid);
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			if (first_exception == nullptr)
+				first_exception = std::current_exception();
+			stop = true;
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (size_t tid = 1; tid < this->sequences.size(); tid++)
+		threads.push_back(std::thread(thread_loop, tid));
+
+	thread_loop(0);
+
+	for (auto &t : threads)
+		t.join();
+
+	if (first_exception != nullptr)
+		std::rethrow_exception(first_exception);
+}
+
+bool Sequence
+::is_bypassed(const module::Task &task)
+{
+	// a task is bypassed when one of its output sockets is bound to an other socket (c.f. the "NO" modules): executing
+	// it would write in a buffer it does not own, its other outputs are considered as constant data
+	for (auto &s : task.sockets)
+		if (task.get_socket_type(*s) == module::socket_t::SOUT && s->get_bound_socket() != nullptr)
+			return true;
+
+	return false;
+}
+
+module::Task* Sequence
+::get_producer(const module::Socket &s_in)
+{
+	// follow the aliases (bypassed output sockets and input sockets) until the real producer
+	auto s = s_in.get_bound_socket();
+	while (s != nullptr && s != &s_in)
+	{
+		auto &task = s->get_task();
+		auto type = task.get_socket_type(*s);
+
+		if (type == module::socket_t::SIN_SOUT || (type == module::socket_t::SOUT && s->get_bound_socket() == nullptr))
+			return &task;
+
+		s = s->get_bound_socket();
+	}
+
+	return nullptr; // the socket is bound to a raw pointer: external data
+}
+
+std::vector<module::Task*> Sequence
+::compile(const std::vector<module::Task*> &firsts)
+{
+	// discover the graph of tasks (in breadth-first order) by following the socket bindings
+	std::vector<module::Task*> dag;
+	for (auto f : firsts)
+		if (f != nullptr && std::find(dag.begin(), dag.end(), f) == dag.end())
+			dag.push_back(f);
+
+	for (size_t t = 0; t < dag.size(); t++)
+		for (auto &s : dag[t]->sockets)
+			for (auto bs : s->get_bound_sockets())
+			{
+				auto next = &bs->get_task();
+				if (std::find(dag.begin(), dag.end(), next) == dag.end())
+					dag.push_back(next);
+			}
+
+	// list the dependencies of the executed tasks
+	std::vector<module::Task*> to_schedule;
+	std::vector<std::vector<module::Task*>> deps;
+	for (auto t : dag)
+	{
+		if (Sequence::is_bypassed(*t))
+			continue;
+
+		if (!t->can_exec())
+		{
+			std::stringstream message;
+			message << "The task cannot be executed because some of the inputs/outputs are not fed ('task.name' = "
+			        << t->get_name() << ", 'module.name' = " << t->get_module().get_name() << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		std::vector<module::Task*> t_deps;
+		for (auto &s : t->sockets)
+		{
+			auto type = t->get_socket_type(*s);
+			if (type == module::socket_t::SIN || type == module::socket_t::SIN_SOUT)
+			{
+				auto p = Sequence::get_producer(*s);
+				if (p != nullptr && p != t && std::find(dag.begin(), dag.end(), p) != dag.end() &&
+				    !Sequence::is_bypassed(*p))
+					t_deps.push_back(p);
+			}
+		}
+
+		to_schedule.push_back(t);
+		deps.push_back(std::move(t_deps));
+	}
+
+	// topological sort, the discovery order is kept as much as possible
+	std::vector<module::Task*> sequence;
+	std::vector<bool> scheduled(to_schedule.size(), false);
+	while (sequence.size() < to_schedule.size())
+	{
+		auto found = false;
+		for (size_t t = 0; t < to_schedule.size() && !found; t++)
+		{
+			if (scheduled[t])
+				continue;
+
+			auto ready = true;
+			for (auto d : deps[t])
+				if (std::find(sequence.begin(), sequence.end(), d) == sequence.end())
+				{
+					ready = false;
+					break;
+				}
+
+			if (ready)
+			{
+				sequence.push_back(to_schedule[t]);
+				scheduled[t] = true;
+				found = true;
+			}
+		}
+
+		if (!found)
+		{
+			std::stringstream message;
+			message << "The tasks graph contains a cycle, it cannot be executed as a sequence.";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	return sequence;
+}
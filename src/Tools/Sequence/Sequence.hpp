@@ -0,0 +1,98 @@
+/*!
+ * \file
+ * \brief Execute a chain of tasks in the order deduced from the bindings of their sockets.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef SEQUENCE_HPP_
+#define SEQUENCE_HPP_
+
+#include <functional>
+#include <cstddef>
+#include <vector>
+
+#include "Module/Task.hpp"
+#include "Module/Socket.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Sequence
+ *
+ * \brief Execute a chain of tasks in the order deduced from the bindings of their sockets.
+ *
+ * Starting from the first task(s), the Sequence follows the socket bindings ('Socket::bind') to build the graph of the
+ * tasks (DAG), checks that all the input sockets are fed and compiles the graph into a flat list of tasks. A task
+ * with an output socket bound to an other socket (like the "NO" modules) is bypassed: it is not executed and its bound
+ * outputs are aliases of the sockets they are bound to.
+ *
+ * There is one flat list of tasks per thread: each thread owns its own chain of modules, all the chains have to be
+ * bound the same way.
+ */
+class Sequence
+{
+protected:
+	std::vector<std::vector<module::Task*>> sequences; // the compiled lists of tasks (one per thread)
+
+public:
+	/*!
+	 * \brief Constructor (one thread).
+	 *
+	 * \param first: the first task of the chain.
+	 */
+	explicit Sequence(module::Task &first);
+
+	/*!
+	 * \brief Constructor (one thread).
+	 *
+	 * \param firsts: the first tasks of the chain (the roots of the graph).
+	 */
+	explicit Sequence(const std::vector<module::Task*> &firsts);
+
+	/*!
+	 * \brief Constructor (multi-threaded).
+	 *
+	 * \param firsts: for each thread, the first tasks of the chain of the thread.
+	 */
+	explicit Sequence(const std::vector<std::vector<module::Task*>> &firsts);
+
+	virtual ~Sequence() = default;
+
+	size_t get_n_threads() const;
+
+	/*!
+	 * \brief Get the compiled list of tasks of a thread (in the execution order).
+	 */
+	const std::vector<module::Task*>& get_tasks(const size_t tid = 0) const;
+
+	/*!
+	 * \brief Execute the chain of a thread once.
+	 *
+	 * \param tid: the thread id (the chain to execute).
+	 */
+	inline void exec_seq(const size_t tid = 0);
+
+	/*!
+	 * \brief Execute all the chains in parallel (one thread per chain) until the stop condition is true.
+	 *
+	 * If a task raises an exception, all the threads are stopped and the first exception is re-thrown.
+	 *
+	 * \param stop_condition: called by each thread before each execution of its chain.
+	 */
+	void exec(std::function<bool()> stop_condition);
+
+protected:
+	static std::vector<module::Task*> compile(const std::vector<module::Task*> &firsts);
+
+	static bool          is_bypassed (const module::Task   &task);
+	static module::Task* get_producer(const module::Socket &s_in);
+};
+}
+}
+
+#include "Tools/Sequence/Sequence.hxx"
+
+#endif /* SEQUENCE_HPP_ */
@@ -0,0 +1,14 @@
+#include "Tools/Sequence/Sequence.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+void Sequence
+::exec_seq(const size_t tid)
+{
+	for (auto t : this->sequences[tid])
+		t->exec();
+}
+}
+}
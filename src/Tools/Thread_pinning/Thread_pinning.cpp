@@ -0,0 +1,290 @@
+#if defined(__linux__) || defined(linux) || defined(__linux)
+#include <sched.h>
+#include <unistd.h>
+#include <dirent.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <tuple>
+#include <deque>
+#include <map>
+#include <set>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/system_functions.h"
+#include "Tools/Thread_pinning/Thread_pinning.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+#if defined(__linux__) || defined(linux) || defined(__linux)
+static int read_int(const std::string &path, const int def)
+{
+	std::ifstream file(path);
+	int val;
+	if (file.is_open() && file >> val)
+		return val;
+	return def;
+}
+
+// parse a Linux CPU list ("0-3,8,10-11")
+static std::vector<int> read_cpu_list(const std::string &path)
+{
+	std::vector<int> cpus;
+	std::ifstream file(path);
+	std::string list;
+	if (!file.is_open() || !std::getline(file, list))
+		return cpus;
+
+	std::stringstream ss(list);
+	std::string range;
+	while (std::getline(ss, range, ','))
+	{
+		const auto dash = range.find('-');
+		try
+		{
+			const auto first = std::stoi(range.substr(0, dash));
+			const auto last  = dash == std::string::npos ? first : std::stoi(range.substr(dash +1));
+			for (auto c = first; c <= last; c++)
+				cpus.push_back(c);
+		}
+		catch (std::exception const&) { /* ignore the malformed ranges */ }
+	}
+
+	return cpus;
+}
+#endif
+
+std::vector<Processing_unit> Thread_pinning
+::discover()
+{
+	std::vector<Processing_unit> pus;
+
+#if defined(__linux__) || defined(linux) || defined(__linux)
+	std::map<int,int> cpu_node;
+	if (auto dir = opendir("/sys/devices/system/node"))
+	{
+		while (auto entry = readdir(dir))
+		{
+			int node;
+			if (sscanf(entry->d_name, "node%d", &node) == 1)
+				for (auto cpu : read_cpu_list(std::string("/sys/devices/system/node/") + entry->d_name + "/cpulist"))
+					cpu_node[cpu] = node;
+		}
+		closedir(dir);
+	}
+
+	// only the PUs allowed to the process are kept (cgroups, taskset, MPI launchers, ...)
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+	const bool has_mask = sched_getaffinity(0, sizeof(cpu_set_t), &cpuset) == 0;
+
+	const auto n_cpus = (int)sysconf(_SC_NPROCESSORS_CONF);
+	for (auto cpu = 0; cpu < n_cpus && cpu < CPU_SETSIZE; cpu++)
+	{
+		if (has_mask && !CPU_ISSET(cpu, &cpuset))
+			continue;
+
+		const auto path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+
+		Processing_unit pu;
+		pu.id      = cpu;
+		pu.core    = read_int(path + "core_id",             cpu);
+		pu.package = read_int(path + "physical_package_id", 0  );
+		pu.node    = cpu_node.count(cpu) ? cpu_node[cpu] : 0;
+		pus.push_back(pu);
+	}
+#endif
+
+	// unknown topology: one core per PU
+	if (pus.empty())
+	{
+		const auto n_pus = std::thread::hardware_concurrency() ? (int)std::thread::hardware_concurrency() : 1;
+		for (auto i = 0; i < n_pus; i++)
+			pus.push_back({i, i, 0, 0});
+	}
+
+	std::sort(pus.begin(), pus.end(), [](const Processing_unit &a, const Processing_unit &b)
+	{
+		return std::make_tuple(a.node, a.package, a.core, a.id) < std::make_tuple(b.node, b.package, b.core, b.id);
+	});
+
+	return pus;
+}
+
+const std::vector<Processing_unit>& Thread_pinning
+::get_topology()
+{
+	static const std::vector<Processing_unit> topology = Thread_pinning::discover();
+	return topology;
+}
+
+std::vector<size_t> Thread_pinning
+::get_mapping(const std::string &policy, const bool no_smt, const size_t n_threads, const size_t first,
+              const size_t team_size)
+{
+	if (policy != "COMPACT" && policy != "SCATTER")
+	{
+		std::stringstream message;
+		message << "Unknown pinning policy ('policy' = " << policy << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto &topo = Thread_pinning::get_topology();
+
+	// rank of each PU among the SMT siblings of its core
+	std::vector<size_t> smt_rank(topo.size(), 0);
+	for (size_t i = 1; i < topo.size(); i++)
+		if (topo[i].package == topo[i -1].package && topo[i].core == topo[i -1].core)
+			smt_rank[i] = smt_rank[i -1] +1;
+
+	std::vector<size_t> order(topo.size());
+	for (size_t i = 0; i < order.size(); i++)
+		order[i] = i;
+
+	// the SMT siblings are used only when all the cores have a thread
+	if (no_smt)
+		std::stable_sort(order.begin(), order.end(), [&smt_rank](const size_t a, const size_t b)
+		{
+			return smt_rank[a] < smt_rank[b];
+		});
+
+	if (team_size == 0)
+	{
+		std::stringstream message;
+		message << "'team_size' has to be greater than 0.";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the PUs of a team are taken together from the same NUMA node
+	if (policy == "SCATTER")
+	{
+		std::map<int, std::deque<size_t>> per_node;
+		for (auto i : order)
+			per_node[topo[i].node].push_back(i);
+
+		order.clear();
+		while (order.size() < topo.size())
+			for (auto &n : per_node)
+				for (size_t m = 0; m < team_size && !n.second.empty(); m++)
+				{
+					order.push_back(n.second.front());
+					n.second.pop_front();
+				}
+	}
+
+	std::vector<size_t> mapping(n_threads * team_size);
+	for (size_t t = 0; t < mapping.size(); t++)
+		mapping[t] = order[(first + t) % order.size()];
+
+	return mapping;
+}
+
+bool Thread_pinning
+::pin(const size_t pu)
+{
+	const auto &topo = Thread_pinning::get_topology();
+	if (pu >= topo.size())
+	{
+		std::stringstream message;
+		message << "'pu' has to be smaller than the number of PUs ('pu' = " << pu << ", 'topo.size()' = "
+		        << topo.size() << ").";
+		throw out_of_range(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return pin_thread(topo[pu].id);
+}
+
+std::vector<int> Thread_pinning
+::get_affinity()
+{
+	std::vector<int> cpus;
+
+#if defined(__linux__) || defined(linux) || defined(__linux)
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+	if (sched_getaffinity(0, sizeof(cpu_set_t), &cpuset) == 0)
+		for (auto cpu = 0; cpu < CPU_SETSIZE; cpu++)
+			if (CPU_ISSET(cpu, &cpuset))
+				cpus.push_back(cpu);
+#endif
+
+	return cpus;
+}
+
+bool Thread_pinning
+::set_affinity(const std::vector<int> &cpus)
+{
+#if defined(__linux__) || defined(linux) || defined(__linux)
+	if (cpus.empty())
+		return false;
+
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+	for (auto cpu : cpus)
+		CPU_SET(cpu, &cpuset);
+
+	return sched_setaffinity(0, sizeof(cpu_set_t), &cpuset) == 0;
+#else
+	return false;
+#endif
+}
+
+// PUs of the teams created by each thread
+static thread_local std::vector<size_t> team_pus;
+
+void Thread_pinning
+::set_team(const std::vector<size_t> &pus)
+{
+	const auto &topo = Thread_pinning::get_topology();
+	for (auto pu : pus)
+		if (pu >= topo.size())
+		{
+			std::stringstream message;
+			message << "'pu' has to be smaller than the number of PUs ('pu' = " << pu << ", 'topo.size()' = "
+			        << topo.size() << ").";
+			throw out_of_range(__FILE__, __LINE__, __func__, message.str());
+		}
+
+	team_pus = pus;
+}
+
+const std::vector<size_t>& Thread_pinning
+::get_team()
+{
+	return team_pus;
+}
+
+void Thread_pinning
+::show(const std::vector<size_t> &mapping, std::ostream &stream)
+{
+	const auto &topo = Thread_pinning::get_topology();
+
+	std::set<std::pair<int,int>> cores;
+	std::set<int> packages, nodes;
+	for (auto &pu : topo)
+	{
+		cores   .insert(std::make_pair(pu.package, pu.core));
+		packages.insert(pu.package);
+		nodes   .insert(pu.node);
+	}
+
+	stream << "# Topology: " << topo.size() << " PU(s), " << cores.size() << " core(s), " << packages.size()
+	       << " package(s), " << nodes.size() << " NUMA node(s)." << std::endl;
+
+	std::map<int, std::vector<std::pair<size_t,int>>> per_node; // node -> (thread id, PU id)
+	for (size_t t = 0; t < mapping.size(); t++)
+		per_node[topo[mapping[t]].node].push_back(std::make_pair(t, topo[mapping[t]].id));
+
+	for (auto &n : per_node)
+	{
+		stream << "#  * NUMA node " << n.first << ": " << n.second.size() << " thread(s) (thread->PU:";
+		for (auto &tp : n.second)
+			stream << " " << tp.first << "->" << tp.second;
+		stream << ")" << std::endl;
+	}
+}
@@ -0,0 +1,92 @@
+#ifndef THREAD_PINNING_HPP_
+#define THREAD_PINNING_HPP_
+
+#include <iostream>
+#include <vector>
+#include <string>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \brief A processing unit (PU) of the machine (a hardware thread).
+ */
+struct Processing_unit
+{
+	int id;      // index of the PU in the operating system
+	int core;    // index of the physical core (PUs of the same core are SMT siblings)
+	int package; // index of the socket
+	int node;    // index of the NUMA node
+};
+
+class Thread_pinning
+{
+protected:
+	Thread_pinning() = default;
+
+public:
+	virtual ~Thread_pinning() = default;
+
+	/*!
+	 * \brief Discovers the PUs available to the process (the topology is read once).
+	 *
+	 * \return the PUs ordered by NUMA node, package, core and PU index
+	 */
+	static const std::vector<Processing_unit>& get_topology();
+
+	/*!
+	 * \brief Computes the PU of each thread.
+	 *
+	 * \param policy:    "COMPACT" fills the NUMA nodes one after the other, "SCATTER" distributes the threads over
+	 *                   the NUMA nodes in round-robin
+	 * \param no_smt:    use only one PU per physical core (as long as there are enough cores)
+	 * \param n_threads: number of threads
+	 * \param first:     number of PUs to skip in the policy order (PUs already given to other threads)
+	 * \param team_size: number of PUs of each thread, for its team (see Thread_team), they are consecutive in the
+	 *                   policy order and on the same NUMA node (as long as the node has enough PUs)
+	 * \return the index in the topology of the PU of each thread ('n_threads' * 'team_size' PUs, the PUs of the
+	 *         thread 't' are in ['t' * 'team_size'; ('t' +1) * 'team_size'[)
+	 */
+	static std::vector<size_t> get_mapping(const std::string &policy, const bool no_smt, const size_t n_threads,
+	                                       const size_t first = 0, const size_t team_size = 1);
+
+	/*!
+	 * \brief Pins the calling thread on a PU of the topology.
+	 *
+	 * \return true if the thread has been pinned (false if not supported on this system)
+	 */
+	static bool pin(const size_t pu);
+
+	/*!
+	 * \brief Gets the affinity of the calling thread.
+	 *
+	 * \return the OS indexes of the PUs the thread is allowed to run on (empty if not supported on this system)
+	 */
+	static std::vector<int> get_affinity();
+
+	/*!
+	 * \brief Restores an affinity returned by 'get_affinity' on the calling thread.
+	 *
+	 * \return true if the affinity has been set (false if not supported on this system)
+	 */
+	static bool set_affinity(const std::vector<int> &cpus);
+
+	/*!
+	 * \brief Sets the PUs of the thread teams created from now on by the calling thread (see Thread_team).
+	 *
+	 * \param pus: the index in the topology of the PU of each thread of a team (empty to not pin the teams)
+	 */
+	static void set_team(const std::vector<size_t> &pus);
+
+	static const std::vector<size_t>& get_team();
+
+	static void show(const std::vector<size_t> &mapping, std::ostream &stream = std::cout);
+
+private:
+	static std::vector<Processing_unit> discover();
+};
+}
+}
+
+#endif /* THREAD_PINNING_HPP_ */
@@ -0,0 +1,176 @@
+#include <sstream>
+#include <utility>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Thread_pinning/Thread_pinning.hpp"
+#include "Tools/Thread_team/Thread_team.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+// number of active polls before yielding the processor (avoid to starve the other threads in case of oversubscription)
+constexpr int n_spins_before_yield = 1024;
+// number of yields of an idle worker before blocking until the next job
+constexpr int n_yields_before_sleep = 1024;
+
+Spin_barrier
+::Spin_barrier(const size_t n_threads)
+: n_threads   (n_threads   ),
+  count       (0           ),
+  sense       (false       ),
+  local_senses(n_threads, 0)
+{
+	if (n_threads == 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0.";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+size_t Spin_barrier
+::get_n_threads() const
+{
+	return this->n_threads;
+}
+
+void Spin_barrier
+::wait(const size_t tid)
+{
+	const bool cur_sense = !this->local_senses[tid];
+	this->local_senses[tid] = cur_sense;
+
+	if (this->count.fetch_add(1, std::memory_order_acq_rel) == this->n_threads -1)
+	{
+		// last thread to arrive: reset the counter and release the others
+		this->count.store(0, std::memory_order_relaxed);
+		this->sense.store(cur_sense, std::memory_order_release);
+	}
+	else
+	{
+		auto n_spins = 0;
+		while (this->sense.load(std::memory_order_acquire) != cur_sense)
+			if (++n_spins == n_spins_before_yield)
+			{
+				std::this_thread::yield();
+				n_spins = 0;
+			}
+	}
+}
+
+Thread_team
+::Thread_team(const size_t n_threads)
+: n_threads (n_threads                  ),
+  pus       (Thread_pinning::get_team() ),
+  bar       (n_threads                  ),
+  generation(0                          ),
+  stop      (false                      ),
+  n_sleepers(0                          )
+{
+	for (size_t tid = 1; tid < n_threads; tid++)
+		this->workers.push_back(std::thread(&Thread_team::worker_loop, this, tid));
+}
+
+Thread_team
+::~Thread_team()
+{
+	this->stop.store(true, std::memory_order_relaxed);
+	this->generation.fetch_add(1);
+	this->wake_up();
+	for (auto &w : this->workers)
+		w.join();
+}
+
+size_t Thread_team
+::get_n_threads() const
+{
+	return this->n_threads;
+}
+
+void Thread_team
+::run(std::function<void(const size_t)> job)
+{
+	this->job = std::move(job);
+	this->generation.fetch_add(1);
+	this->wake_up();
+
+	this->job(0);
+	this->bar.wait(0);
+}
+
+void Thread_team
+::wake_up()
+{
+	// 'generation' and 'n_sleepers' are sequentially consistent: either the worker sees the new generation before
+	// blocking, or it is counted here and notified
+	if (this->n_sleepers.load() > 0)
+	{
+		std::lock_guard<std::mutex> lock(this->mtx_sleep);
+		this->cv_sleep.notify_all();
+	}
+}
+
+void Thread_team
+::worker_loop(const size_t tid)
+{
+	if (!this->pus.empty())
+		Thread_pinning::pin(this->pus[tid % this->pus.size()]);
+
+	uint64_t seen = 0;
+	while (true)
+	{
+		auto n_spins = 0, n_yields = 0;
+		uint64_t cur;
+		while ((cur = this->generation.load(std::memory_order_acquire)) == seen)
+			if (++n_spins == n_spins_before_yield)
+			{
+				n_spins = 0;
+				if (++n_yields == n_yields_before_sleep)
+				{
+					std::unique_lock<std::mutex> lock(this->mtx_sleep);
+					this->n_sleepers.fetch_add(1);
+					this->cv_sleep.wait(lock, [this, seen]() { return this->generation.load() != seen; });
+					this->n_sleepers.fetch_sub(1);
+					n_yields = 0;
+				}
+				else
+					std::this_thread::yield();
+			}
+		seen = cur;
+
+		if (this->stop.load(std::memory_order_relaxed))
+			break;
+
+		this->job(tid);
+		this->bar.wait(tid);
+	}
+}
+
+std::vector<uint32_t> Thread_team
+::split(const std::vector<std::vector<uint32_t>> &nodes, const size_t first, const size_t last, const size_t n_parts)
+{
+	if (first > last || last > nodes.size())
+	{
+		std::stringstream message;
+		message << "'first' and 'last' have to define a range of 'nodes' ('first' = " << first << ", 'last' = " << last
+		        << ", 'nodes.size()' = " << nodes.size() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	size_t n_connections = 0;
+	for (auto n = first; n < last; n++)
+		n_connections += nodes[n].size();
+
+	std::vector<uint32_t> bounds(n_parts +1, (uint32_t)last);
+	bounds[0] = (uint32_t)first;
+
+	size_t p = 1, acc = 0;
+	for (auto n = first; n < last && p < n_parts; n++)
+	{
+		acc += nodes[n].size();
+		while (p < n_parts && acc * n_parts >= p * n_connections)
+			bounds[p++] = (uint32_t)(n +1);
+	}
+
+	return bounds;
+}
@@ -0,0 +1,109 @@
+#ifndef THREAD_TEAM_HPP_
+#define THREAD_TEAM_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <mutex>
+#include <functional>
+#include <condition_variable>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \brief Sense-reversing barrier based on active waiting (no system call), suited to the very short phases of the
+ *        intra-frame parallel decoders.
+ */
+class Spin_barrier
+{
+protected:
+	const size_t n_threads;
+	std::atomic<size_t> count;
+	std::atomic<bool> sense;
+	std::vector<uint8_t> local_senses; // one per thread, only accessed by its owner
+
+public:
+	explicit Spin_barrier(const size_t n_threads);
+	virtual ~Spin_barrier() = default;
+
+	size_t get_n_threads() const;
+
+	/*!
+	 * \brief Blocks the calling thread until the 'n_threads' threads of the team reach the barrier.
+	 *
+	 * \param tid: id of the calling thread in the team (in [0;n_threads[)
+	 */
+	void wait(const size_t tid);
+};
+
+/*!
+ * \brief Team of persistent threads to split the processing of a single frame.
+ *
+ * The calling thread is the thread 0 of the team, the 'n_threads' -1 other threads are spawned once in the
+ * constructor and actively wait for the next job (the team is designed for latency), they block after a while
+ * without job. When the calling thread has a team affinity (see Thread_pinning::set_team), the thread 't' is pinned on
+ * the PU 't' of the team.
+ */
+class Thread_team
+{
+protected:
+	const size_t n_threads;
+	const std::vector<size_t> pus;
+	std::vector<std::thread> workers;
+	Spin_barrier bar;
+
+	std::function<void(const size_t)> job;
+	std::atomic<uint64_t> generation;
+	std::atomic<bool> stop;
+
+	std::mutex              mtx_sleep;
+	std::condition_variable cv_sleep;
+	std::atomic<size_t>     n_sleepers; // workers blocked on 'cv_sleep'
+
+public:
+	explicit Thread_team(const size_t n_threads);
+	virtual ~Thread_team();
+
+	Thread_team(const Thread_team&) = delete;
+	Thread_team& operator=(const Thread_team&) = delete;
+
+	size_t get_n_threads() const;
+
+	/*!
+	 * \brief Executes 'job' on all the threads of the team and returns when all of them are done.
+	 *
+	 * \param job: the function to execute, its parameter is the id of the thread in the team
+	 */
+	void run(std::function<void(const size_t)> job);
+
+	/*!
+	 * \brief Synchronizes the threads of the team, to call from inside a job.
+	 */
+	inline void barrier(const size_t tid);
+
+	/*!
+	 * \brief Splits a set of nodes in contiguous parts with the same amount of work (the number of connections).
+	 *
+	 * \param nodes:   the connections of each node
+	 * \param first:   the first node to split
+	 * \param last:    the node after the last one to split
+	 * \param n_parts: the number of parts
+	 * \return the 'n_parts' +1 boundaries of the parts
+	 */
+	static std::vector<uint32_t> split(const std::vector<std::vector<uint32_t>> &nodes, const size_t first,
+	                                   const size_t last, const size_t n_parts);
+
+private:
+	void worker_loop(const size_t tid);
+	void wake_up();
+};
+}
+}
+
+#include "Tools/Thread_team/Thread_team.hxx"
+
+#endif /* THREAD_TEAM_HPP_ */
@@ -0,0 +1,13 @@
+#include "Tools/Thread_team/Thread_team.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+void Thread_team
+::barrier(const size_t tid)
+{
+	this->bar.wait(tid);
+}
+}
+}
@@ -0,0 +1,220 @@
+#ifdef AFF3CT_MPI
+
+#include <algorithm>
+#include <sstream>
+#include <cstring>
+#include <chrono>
+#include <thread>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Work_scheduler/Work_scheduler_MPI.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+constexpr int Work_scheduler_MPI::STOP;
+constexpr int Work_scheduler_MPI::NONE;
+
+namespace
+{
+// the requests are sent to the master with this tag, the units are sent back with 'TAG_UNIT + tid'
+constexpr int TAG_REQUEST = 0;
+constexpr int TAG_UNIT    = 1;
+}
+
+Work_scheduler_MPI
+::Work_scheduler_MPI(const int n_threads, const size_t result_size)
+: result_size(result_size), rank(0), n_worker_threads(0), n_stopped(0),
+  buffer(sizeof(Request) + result_size)
+{
+	int size;
+	MPI_Comm_size(MPI_COMM_WORLD, &size);
+	MPI_Comm_rank(MPI_COMM_WORLD, &this->rank);
+
+	if (size < 2)
+	{
+		std::stringstream message;
+		message << "The dynamic scheduling requires at least 2 MPI processes (a master and a worker) ('size' = "
+		        << size << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	int provided;
+	MPI_Query_thread(&provided);
+	if (!this->is_master() && n_threads > 1 && provided < MPI_THREAD_SERIALIZED)
+	{
+		std::stringstream message;
+		message << "The threads of a worker process need the 'MPI_THREAD_SERIALIZED' support of the MPI library "
+		        << "('provided' = " << provided << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	int n_threads_send = this->is_master() ? 0 : n_threads;
+	if (auto ret = MPI_Reduce(&n_threads_send, &this->n_worker_threads, 1, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD))
+	{
+		std::stringstream message;
+		message << "'MPI_Reduce' returned '" << ret << "' error code.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+bool Work_scheduler_MPI
+::is_master() const
+{
+	return this->rank == 0;
+}
+
+void Work_scheduler_MPI
+::serve(const int noise_idx, std::function<void(const uint8_t*)> merge, std::function<bool()> keep_going)
+{
+	int n_given  = 0;
+	int n_merged = 0;
+	std::map<int,std::vector<uint8_t>> received; // results waiting for the results of the previous units
+	std::vector<int> orphans; // units released by the worker threads before being completed
+
+	auto next_unit = [&]() -> Unit
+	{
+		if (orphans.empty())
+			return {noise_idx, n_given++};
+
+		const Unit unit = {noise_idx, orphans.back()};
+		orphans.pop_back();
+		return unit;
+	};
+
+	// the requests left at the end of the previous noise point
+	for (auto &w : this->waiting)
+		this->reply(w.first, w.second, next_unit());
+	this->waiting.clear();
+
+	bool over = !keep_going();
+	while (!over)
+	{
+		int flag;
+		MPI_Status status;
+		MPI_Iprobe(MPI_ANY_SOURCE, TAG_REQUEST, MPI_COMM_WORLD, &flag, &status);
+		if (!flag)
+		{
+			// the master does not simulate: the stop criteria which do not depend on the results (time, interruption)
+			// are checked from time to time
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			over = !keep_going();
+			continue;
+		}
+
+		MPI_Recv(this->buffer.data(), (int)this->buffer.size(), MPI_BYTE, status.MPI_SOURCE, TAG_REQUEST,
+		         MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+		Request req;
+		std::memcpy(&req, this->buffer.data(), sizeof(Request));
+
+		if (req.release)
+		{
+			// the unit of a thread which stops (interruption or error) is given to another thread: the results have
+			// to be merged without gap
+			if (req.noise_idx == noise_idx && req.unit_idx >= n_merged)
+				orphans.push_back(req.unit_idx);
+
+			this->reply(status.MPI_SOURCE, req.tid, {STOP, 0});
+			this->n_stopped++;
+			continue;
+		}
+
+		// the results of the units given for a previous noise point are dropped
+		if (req.noise_idx == noise_idx && req.unit_idx >= n_merged)
+			received[req.unit_idx].assign(this->buffer.begin() + sizeof(Request), this->buffer.end());
+
+		// merge in the order of the units: the stop criteria are checked after each unit
+		while (!over && !received.empty() && received.begin()->first == n_merged)
+		{
+			merge(received.begin()->second.data());
+			received.erase(received.begin());
+			n_merged++;
+			over = !keep_going();
+		}
+
+		if (over)
+			this->waiting.push_back(std::make_pair(status.MPI_SOURCE, req.tid));
+		else
+			this->reply(status.MPI_SOURCE, req.tid, next_unit());
+	}
+}
+
+void Work_scheduler_MPI
+::stop()
+{
+	for (auto &w : this->waiting)
+	{
+		this->reply(w.first, w.second, {STOP, 0});
+		this->n_stopped++;
+	}
+	this->waiting.clear();
+
+	while (this->n_stopped < this->n_worker_threads)
+	{
+		MPI_Status status;
+		MPI_Recv(this->buffer.data(), (int)this->buffer.size(), MPI_BYTE, MPI_ANY_SOURCE, TAG_REQUEST,
+		         MPI_COMM_WORLD, &status);
+
+		Request req;
+		std::memcpy(&req, this->buffer.data(), sizeof(Request));
+
+		this->reply(status.MPI_SOURCE, req.tid, {STOP, 0});
+		this->n_stopped++;
+	}
+}
+
+Work_scheduler_MPI::Unit Work_scheduler_MPI
+::next(const int tid, const Unit &done, const uint8_t *result)
+{
+	return this->request({tid, done.noise_idx, done.unit_idx, 0}, result);
+}
+
+void Work_scheduler_MPI
+::release(const int tid, const Unit &held)
+{
+	this->request({tid, held.noise_idx, held.unit_idx, 1}, nullptr);
+}
+
+Work_scheduler_MPI::Unit Work_scheduler_MPI
+::request(const Request &req, const uint8_t *result)
+{
+	std::vector<uint8_t> msg(sizeof(Request) + this->result_size, 0);
+	std::memcpy(msg.data(), &req, sizeof(Request));
+	if (result != nullptr)
+		std::copy(result, result + this->result_size, msg.begin() + sizeof(Request));
+
+	Unit unit;
+
+	// the lock is kept until the answer is received: the calls to the MPI library are serialized
+	std::lock_guard<std::mutex> lock(this->mtx);
+
+	if (auto ret = MPI_Send(msg.data(), (int)msg.size(), MPI_BYTE, 0, TAG_REQUEST, MPI_COMM_WORLD))
+	{
+		std::stringstream message;
+		message << "'MPI_Send' returned '" << ret << "' error code.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (auto ret = MPI_Recv(&unit, 2, MPI_INT, 0, TAG_UNIT + req.tid, MPI_COMM_WORLD, MPI_STATUS_IGNORE))
+	{
+		std::stringstream message;
+		message << "'MPI_Recv' returned '" << ret << "' error code.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return unit;
+}
+
+void Work_scheduler_MPI
+::reply(const int rank, const int tid, const Unit &unit)
+{
+	if (auto ret = MPI_Send(&unit, 2, MPI_INT, rank, TAG_UNIT + tid, MPI_COMM_WORLD))
+	{
+		std::stringstream message;
+		message << "'MPI_Send' returned '" << ret << "' error code.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+#endif
@@ -0,0 +1,116 @@
+#ifdef AFF3CT_MPI
+
+#ifndef WORK_SCHEDULER_MPI_HPP_
+#define WORK_SCHEDULER_MPI_HPP_
+
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <mutex>
+#include <map>
+#include <mpi.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Work_scheduler_MPI
+ *
+ * \brief Distributes the frames of the noise points between the MPI processes (master/worker).
+ *
+ * The master process (rank 0) does not simulate: it hands out work units (a noise point and the index of a batch of
+ * frames in this noise point) to the threads of the worker processes and merges their results in the order of the
+ * units. A fast process simply pulls more units than a slow one. The result of a unit only depends on the unit (its
+ * seeds are derived from it), so the merged results and the stop decision do not depend on the number of processes,
+ * on their speed or on the arrival order of the messages.
+ */
+class Work_scheduler_MPI
+{
+public:
+	struct Unit
+	{
+		int noise_idx; // index of the noise point, 'STOP' if there is no more work, 'NONE' if not received yet
+		int unit_idx;  // index of the unit in the noise point
+	};
+
+	static constexpr int STOP = -1;
+	static constexpr int NONE = -2;
+
+private:
+	struct Request
+	{
+		int tid;       // thread of the worker process which sends the request
+		int noise_idx; // noise point of the completed (or released) unit, 'NONE' if there is no unit
+		int unit_idx;  // index of the completed (or released) unit
+		int release;   // the thread does not want any more unit
+	};
+
+	const size_t result_size; // size in bytes of the result of a unit
+	int          rank;
+
+	// worker side: the MPI calls of the threads are serialized
+	std::mutex mtx;
+
+	// master side
+	int                              n_worker_threads; // total number of threads in the worker processes
+	int                              n_stopped;        // number of worker threads to which 'STOP' has been sent
+	std::vector<std::pair<int,int>>  waiting;          // requests (rank, tid) kept for the next noise point
+	std::vector<uint8_t>             buffer;
+
+public:
+	/*!
+	 * \brief Constructor (collective operation: all the MPI processes have to call it).
+	 *
+	 * \param n_threads:   number of threads of the calling process (the master threads do not simulate)
+	 * \param result_size: size in bytes of the result of a work unit
+	 */
+	Work_scheduler_MPI(const int n_threads, const size_t result_size);
+	virtual ~Work_scheduler_MPI() = default;
+
+	bool is_master() const;
+
+	/*!
+	 * \brief Master side: hands out the units of a noise point until the stop criteria are reached.
+	 *
+	 * \param noise_idx:  the noise point
+	 * \param merge:      called with the result of each unit, in the order of the units
+	 * \param keep_going: checked after each merged unit (and periodically), the serving stops when it returns false
+	 */
+	void serve(const int noise_idx, std::function<void(const uint8_t*)> merge, std::function<bool()> keep_going);
+
+	/*!
+	 * \brief Master side: answers 'STOP' to the worker threads until all of them are stopped.
+	 */
+	void stop();
+
+	/*!
+	 * \brief Worker side: sends the result of a unit and receives the next unit of the thread (thread-safe).
+	 *
+	 * \param tid:    the calling thread
+	 * \param done:   the completed unit ('NONE' noise point if there is no result)
+	 * \param result: the result of the completed unit ('result_size' bytes)
+	 * \return the next unit of the thread
+	 */
+	Unit next(const int tid, const Unit &done, const uint8_t *result);
+
+	/*!
+	 * \brief Worker side: tells the master that the thread stops (thread-safe).
+	 *
+	 * \param tid:  the calling thread
+	 * \param held: the unit of the thread that will not be completed, the master gives it to another thread
+	 */
+	void release(const int tid, const Unit &held);
+
+private:
+	Unit request(const Request &req, const uint8_t *result);
+	void reply  (const int rank, const int tid, const Unit &unit);
+};
+}
+}
+
+#endif /* WORK_SCHEDULER_MPI_HPP_ */
+
+#endif
@@ -3,6 +3,17 @@
 #include <cxxabi.h>   // __cxa_demangle
 #endif
 
+#if defined(__linux__) || defined(linux) || defined(__linux)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
 #if defined(__linux__) || defined(linux) || defined(__linux) || defined(__FreeBSD__)
 #include <unistd.h>
 #include <string.h>
@@ -244,4 +255,40 @@ void aff3ct::tools::split_path(const std::string& path, std::string &basedir, st
   found = path.find_last_of("/\\");
   basedir = path.substr(0,found);
   filename = path.substr(found+1);
-}
\ No newline at end of file
+}
+
+uint64_t aff3ct::tools::get_cycles()
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	return (uint64_t)__rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+	return (uint64_t)__rdtsc();
+#else
+	return 0;
+#endif
+}
+
+int aff3ct::tools::get_current_core()
+{
+#if defined(__linux__) || defined(linux) || defined(__linux)
+	return sched_getcpu();
+#else
+	return -1;
+#endif
+}
+
+bool aff3ct::tools::pin_thread(const int core)
+{
+#if defined(__linux__) || defined(linux) || defined(__linux)
+	if (core < 0)
+		return false;
+
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+	CPU_SET(core, &cpuset);
+
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) == 0;
+#else
+	return false;
+#endif
+}
@@ -2,6 +2,7 @@
 #define SYSTEM_FUNCTIONS_H_
 
 #include <string>
+#include <cstdint>
 
 namespace aff3ct
 {
@@ -48,6 +49,28 @@ std::string get_binary_path();
  * \param filename is the name of the file without the base directory
  */
 void split_path(const std::string& path, std::string &basedir, std::string &filename);
+
+/*!
+ * \brief read the time stamp counter of the CPU
+ *
+ * \return the number of reference cycles if supported, 0 else
+ */
+uint64_t get_cycles();
+
+/*!
+ * \brief get the index of the CPU core running the calling thread
+ *
+ * \return the core index if supported, -1 else
+ */
+int get_current_core();
+
+/*!
+ * \brief pin the calling thread on a CPU core
+ *
+ * \param core is the index of the core
+ * \return true if the thread has been pinned (false if not supported on this system)
+ */
+bool pin_thread(const int core);
 }
 }
 
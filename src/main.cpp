@@ -13,6 +13,7 @@
 
 #include "Tools/types.h"
 #include "Tools/version.h"
+#include "Tools/Perf/cpu_features.h"
 #include "Tools/Arguments/Argument_handler.hpp"
 #include "Tools/Display/rang_format/rang_format.h"
 #include "Launcher/Launcher.hpp"
@@ -148,6 +149,7 @@ void print_version()
 	std::cout << "  - GSL:               " << gsl                                              << std::endl;
 	std::cout << "  - MKL:               " << mkl                                              << std::endl;
 	std::cout << "  - SystemC:           " << systemc                                          << std::endl;
+	std::cout << "CPU SIMD instruction sets: " << tools::get_cpu_simd_isas()                  << std::endl;
 	std::cout << "Copyright (c) 2016-2019 - MIT license."                                      << std::endl;
 	std::cout << "This is free software; see the source for copying conditions.  There is NO"  << std::endl;
 	std::cout << "warranty; not even for MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE." << std::endl;
@@ -205,7 +207,9 @@ int sc_main(int argc, char **argv)
 {
 	int exit_code = EXIT_SUCCESS;
 #ifdef AFF3CT_MPI
-	MPI_Init(nullptr, nullptr);
+	// the threads of a worker process request their work units to the master (dynamic scheduling)
+	int mpi_thread_support;
+	MPI_Init_thread(nullptr, nullptr, MPI_THREAD_SERIALIZED, &mpi_thread_support);
 #endif
 
 	factory::Launcher::parameters params("sim");